@@ -1,30 +1,15 @@
 #include "ares/aes.hpp"
-#include <chrono>
+#include "ares/cpu_dispatch.hpp"
+#include "bench_harness.hpp"
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <string>
 #include <vector>
-#include <algorithm>
 
 using namespace ares;
-using namespace std::chrono;
 
-// Simple benchmark class
-class Benchmark {
-public:
-    template<typename Func>
-    static double measure(Func func, int iterations = 100) {
-        auto start = high_resolution_clock::now();
-        for (int i = 0; i < iterations; ++i) {
-            func();
-        }
-        auto end = high_resolution_clock::now();
-        auto duration = duration_cast<microseconds>(end - start).count();
-        return duration / static_cast<double>(iterations);
-    }
-};
-
-void benchmark_aes(size_t data_size_kb) {
+void benchmark_aes(bench::Harness& harness, size_t data_size_kb, const char* label) {
     size_t num_blocks = (data_size_kb * 1024) / 16;
     std::vector<uint8_t> plaintext(num_blocks * 16);
     std::vector<uint8_t> ciphertext(num_blocks * 16);
@@ -35,54 +20,54 @@ void benchmark_aes(size_t data_size_kb) {
         plaintext[i] = static_cast<uint8_t>(rand() % 256);
     }
     
-    // Benchmark baseline
-    double baseline_time = Benchmark::measure([&]() {
-        aes_encrypt_baseline(plaintext.data(), ciphertext.data(), key, num_blocks);
-    }, 50);
-    
-    double baseline_throughput = (data_size_kb * 1024.0) / (baseline_time / 1000000.0) / (1024 * 1024);
+    const double bytes = static_cast<double>(plaintext.size());
     
-    printf("  Baseline:  %8.2f μs  |  %6.2f MB/s\n", 
-           baseline_time, baseline_throughput);
+    harness.run({ "aes", "baseline", label, bytes }, [&]() {
+        aes_encrypt_baseline(plaintext.data(), ciphertext.data(), key, num_blocks);
+    });
     
-    // Benchmark SIMD (if available)
-    if (has_aes_ni_support()) {
-        double simd_time = Benchmark::measure([&]() {
-            aes_encrypt_simd(plaintext.data(), ciphertext.data(), key, num_blocks);
-        }, 50);
-        
-        double simd_throughput = (data_size_kb * 1024.0) / (simd_time / 1000000.0) / (1024 * 1024);
-        double speedup = baseline_time / simd_time;
-        
-        printf("  SIMD:      %8.2f μs  |  %6.2f MB/s  |  %.2fx speedup\n",
-               simd_time, simd_throughput, speedup);
-    } else {
+    // Every AES kernel the CPU supports (AES-NI, VAES-256, VAES-512)
+    if (!has_aes_ni_support()) {
         printf("  SIMD:      [AES-NI not supported]\n");
+        return;
     }
+    const char* previous = nullptr;
+    const IsaLevel detected = detected_isa_level();
+    for (int l = static_cast<int>(IsaLevel::SSE42); l <= static_cast<int>(detected); ++l) {
+        set_isa_level(static_cast<IsaLevel>(l));
+        if (previous && std::strcmp(previous, active_aes_kernel()) == 0) {
+            continue;  // Level has no wider AES kernel on this CPU
+        }
+        previous = active_aes_kernel();
+        
+        harness.run({ "aes", active_aes_kernel(), label, bytes }, [&]() {
+            aes_encrypt_simd(plaintext.data(), ciphertext.data(), key, num_blocks);
+        });
+    }
+    set_isa_level(detected);
 }
 
-int main() {
+int main(int argc, char** argv) {
+    bench::Harness harness("aes", argc, argv);
+    
     printf("=== ARES AES Encryption Benchmarks ===\n\n");
     printf("Testing AES-128 encryption performance\n");
-    printf("Format: Time per operation | Throughput | Speedup\n\n");
+    harness.print_context();
     
-    printf("Data Size: 4 KB\n");
-    benchmark_aes(4);
-    
-    printf("\nData Size: 64 KB\n");
-    benchmark_aes(64);
-    
-    printf("\nData Size: 1 MB\n");
-    benchmark_aes(1024);
-    
-    printf("\nData Size: 10 MB\n");
-    benchmark_aes(10240);
+    const struct { size_t kb; const char* label; } sizes[] = {
+        { 4, "4 KB" }, { 64, "64 KB" }, { 1024, "1 MB" }, { 10240, "10 MB" }
+    };
+    for (const auto& s : sizes) {
+        printf("Data Size: %s\n", s.label);
+        benchmark_aes(harness, s.kb, s.label);
+        printf("\n");
+    }
     
-    printf("\n=== Benchmark Complete ===\n");
+    printf("=== Benchmark Complete ===\n");
     printf("\nNotes:\n");
-    printf("- SIMD version uses AES-NI hardware instructions\n");
+    printf("- SIMD kernels use AES-NI, or VAES on 256/512-bit vectors when available\n");
     printf("- Speedup shows performance improvement over baseline\n");
-    printf("- Results may vary based on CPU model and clock speed\n");
+    printf("- Use --json=FILE or --csv=FILE for visualize_performance.py\n");
     
-    return 0;
+    return harness.finish();
 }
@@ -0,0 +1,119 @@
+#include "ares/aes.hpp"
+#include "ares/async.hpp"
+#include "ares/gaussian_blur.hpp"
+#include "bench_harness.hpp"
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace ares;
+
+static const uint8_t KEY[16] = { 0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+                                 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c };
+
+void benchmark_blur_jobs(bench::Harness& harness, AsyncExecutor& executor, size_t count, size_t size) {
+    const std::string label = std::to_string(count) + "x " + std::to_string(size) + "x" + std::to_string(size);
+    const double bytes = static_cast<double>(count * size * size * 4 * sizeof(float) * 2);
+    printf("Jobs: %s\n", label.c_str());
+
+    Image input(size, size);
+    for (size_t i = 0; i < size * size * 4; ++i) {
+        input.data[i] = std::sin(i * 0.001f) * 0.5f + 0.5f;
+    }
+    std::vector<Image> outputs;
+    outputs.reserve(count);
+    std::vector<BlurJob> batch;
+    for (size_t i = 0; i < count; ++i) {
+        outputs.emplace_back(size, size);
+        batch.push_back(BlurJob{ &input, &outputs.back(), 2.0f, BorderMode::Clamp });
+    }
+    std::vector<AsyncJob> jobs(count);
+
+    // One blocking call after another
+    harness.run({ "async-blur", "baseline", label, bytes, static_cast<double>(count), false, "job" }, [&]() {
+        for (Image& output : outputs) {
+            gaussian_blur_tiled(input, output, 2.0f);
+        }
+    });
+
+    harness.run({ "async-blur", "batch", label, bytes, static_cast<double>(count), true, "job" },
+                [&]() { gaussian_blur_batch(batch); });
+
+    // Submit everything, then wait for every handle
+    harness.run({ "async-blur", "async", label, bytes, static_cast<double>(count), true, "job" }, [&]() {
+        for (size_t i = 0; i < count; ++i) {
+            jobs[i] = executor.submit_gaussian_blur(input, outputs[i], 2.0f);
+        }
+        for (AsyncJob& job : jobs) {
+            job.wait();
+        }
+    });
+}
+
+void benchmark_aes_jobs(bench::Harness& harness, AsyncExecutor& executor, size_t count, size_t blocks) {
+    const std::string label = std::to_string(count) + "x " + std::to_string(blocks * 16) + " B";
+    const double bytes = static_cast<double>(count * blocks * 16 * 2);
+    printf("Jobs: %s\n", label.c_str());
+
+    std::vector<uint8_t> plaintext(count * blocks * 16, 0x5a);
+    std::vector<uint8_t> ciphertext(count * blocks * 16);
+    std::vector<AsyncJob> jobs(count);
+
+    harness.run({ "async-aes", "baseline", label, bytes, static_cast<double>(count), false, "job" }, [&]() {
+        for (size_t i = 0; i < count; ++i) {
+            aes_encrypt_simd(plaintext.data() + i * blocks * 16, ciphertext.data() + i * blocks * 16,
+                             KEY, blocks);
+        }
+    });
+
+    harness.run({ "async-aes", "async", label, bytes, static_cast<double>(count), true, "job" }, [&]() {
+        for (size_t i = 0; i < count; ++i) {
+            jobs[i] = executor.submit_aes_encrypt(plaintext.data() + i * blocks * 16,
+                                                  ciphertext.data() + i * blocks * 16, KEY, blocks);
+        }
+        for (AsyncJob& job : jobs) {
+            job.wait();
+        }
+    });
+
+    // Same jobs drained from the completion queue instead of the handles
+    AsyncExecutor polled({ true });
+    std::vector<Completion> completions(count);
+    harness.run({ "async-aes", "async-poll", label, bytes, static_cast<double>(count), true, "job" }, [&]() {
+        for (size_t i = 0; i < count; ++i) {
+            polled.submit_aes_encrypt(plaintext.data() + i * blocks * 16,
+                                      ciphertext.data() + i * blocks * 16, KEY, blocks, i);
+        }
+        size_t received = 0;
+        while (received < count) {
+            received += polled.wait_completions(completions.data() + received, count - received,
+                                                std::chrono::milliseconds(1000));
+        }
+    });
+}
+
+int main(int argc, char** argv) {
+    bench::Harness harness("async", argc, argv);
+    AsyncExecutor executor;
+
+    printf("=== ARES Async Job Benchmarks ===\n\n");
+    printf("Baseline: the blocking call for each job in turn (%u pool threads)\n", executor.workers());
+    harness.print_context();
+    printf("\n");
+
+    benchmark_blur_jobs(harness, executor, 1000, 64);
+    benchmark_blur_jobs(harness, executor, 100, 256);
+    benchmark_blur_jobs(harness, executor, 4, 1920);
+    benchmark_aes_jobs(harness, executor, 10000, 1);
+    benchmark_aes_jobs(harness, executor, 1000, 256);
+    printf("\n");
+
+    printf("=== Benchmark Complete ===\n");
+    printf("\nNotes:\n");
+    printf("- async: submit every job, then wait() on each handle\n");
+    printf("- async-poll: drain the completion queue instead of the handles\n");
+    printf("- Per-job overhead is the async time per job minus the baseline's\n");
+
+    return harness.finish();
+}
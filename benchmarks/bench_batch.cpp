@@ -0,0 +1,71 @@
+#include "ares/gaussian_blur.hpp"
+#include "bench_harness.hpp"
+#include <cstdio>
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace ares;
+
+void benchmark_batch(bench::Harness& harness, size_t count, size_t size, float sigma) {
+    std::vector<Image> inputs;
+    std::vector<Image> outputs;
+    inputs.reserve(count);
+    outputs.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        inputs.emplace_back(size, size);
+        outputs.emplace_back(size, size);
+        Image& img = inputs.back();
+        for (size_t p = 0; p < size * size * 4; ++p) {
+            img.data[p] = std::sin((p + i) * 0.01f) * 0.5f + 0.5f;
+        }
+    }
+    
+    std::vector<BlurJob> jobs;
+    for (size_t i = 0; i < count; ++i) {
+        jobs.push_back(BlurJob{ &inputs[i], &outputs[i], sigma });
+    }
+    
+    const std::string label = std::to_string(count) + "x" + std::to_string(size) + "^2";
+    const double images = static_cast<double>(count);
+    
+    // One call per image on the calling thread; the reference for speedups
+    harness.run({ "batch", "baseline", label, 0.0, images, false, "image" }, [&]() {
+        for (size_t i = 0; i < count; ++i) {
+            gaussian_blur_simd(inputs[i], outputs[i], sigma);
+        }
+    });
+    
+    // One call per image, each spawning and joining its own threads
+    harness.run({ "batch", "multithreaded", label, 0.0, images, true, "image" }, [&]() {
+        for (size_t i = 0; i < count; ++i) {
+            gaussian_blur_multithreaded(inputs[i], outputs[i], sigma);
+        }
+    });
+    
+    // Whole batch on the shared worker pool
+    harness.run({ "batch", "pool", label, 0.0, images, true, "image" }, [&]() {
+        gaussian_blur_batch(jobs);
+    });
+}
+
+int main(int argc, char** argv) {
+    bench::Harness harness("batch", argc, argv);
+    
+    printf("=== ARES Batched Gaussian Blur Benchmarks ===\n\n");
+    printf("Baseline: gaussian_blur_simd per image on one thread\n");
+    harness.print_context();
+    
+    printf("Batch: 2048 x 128x128 (sigma=2.0)\n");
+    benchmark_batch(harness, 2048, 128, 2.0f);
+    
+    printf("\nBatch: 8192 x 64x64 (sigma=1.0)\n");
+    benchmark_batch(harness, 8192, 64, 1.0f);
+    
+    printf("\n=== Benchmark Complete ===\n");
+    printf("\nNotes:\n");
+    printf("- Batch schedules whole images across a persistent worker pool\n");
+    printf("- Each worker reuses its scratch buffer and kernel between images\n");
+    
+    return harness.finish();
+}
@@ -0,0 +1,92 @@
+#include "ares/bilateral_grid.hpp"
+#include "ares/gaussian_blur.hpp"
+#include "bench_harness.hpp"
+#include <cmath>
+#include <cstdio>
+#include <string>
+
+using namespace ares;
+
+static const float BILATERAL_RANGE = 0.1f;
+
+static Image make_frame(size_t width, size_t height) {
+    Image frame(width, height);
+    for (size_t i = 0; i < width * height * 4; ++i) {
+        frame.data[i] = std::sin(i * 0.001f) * 0.5f + 0.5f;
+    }
+    return frame;
+}
+
+static void report_fps(bench::Result* r) {
+    if (r) {
+        const double fps = 1e6 / r->median_us;
+        r->metrics = { { "fps", fps } };
+        printf("    %.1f fps\n", fps);
+    }
+}
+
+// Brute force is O(sigma^2) per pixel: compared on a small frame only
+void benchmark_reference(bench::Harness& harness, size_t width, size_t height, float sigma) {
+    const std::string label = std::to_string(width) + "x" + std::to_string(height) +
+                              " s" + std::to_string(static_cast<int>(sigma));
+    const double pixels = static_cast<double>(width * height);
+    const double bytes = pixels * 4 * sizeof(float) * 2;
+    Image input = make_frame(width, height);
+    Image output(width, height);
+
+    harness.run({ "bilateral", "baseline", label, bytes, pixels, false, "px" },
+                [&]() { bilateral_filter_baseline(input, output, sigma, BILATERAL_RANGE); });
+    BilateralGrid grid(sigma, BILATERAL_RANGE);
+    harness.run({ "bilateral", "grid", label, bytes, pixels, true, "px" },
+                [&]() { grid.apply(input, output); });
+}
+
+void benchmark_frames(bench::Harness& harness, size_t width, size_t height) {
+    const std::string label = std::to_string(width) + "x" + std::to_string(height);
+    const double pixels = static_cast<double>(width * height);
+    const double bytes = pixels * 4 * sizeof(float) * 2;
+    Image input = make_frame(width, height);
+    Image output(width, height);
+
+    // A plain Gaussian of the same spatial sigma, for scale
+    report_fps(harness.run({ "bilateral-frame", "gaussian-s8", label, bytes, pixels, false, "px" },
+                           [&]() { gaussian_blur_tiled(input, output, 8.0f); }));
+    for (float sigma : { 8.0f, 16.0f }) {
+        BilateralGrid grid(sigma, BILATERAL_RANGE);
+        grid.apply(input, output);
+        report_fps(harness.run({ "bilateral-frame", "grid-s" + std::to_string(static_cast<int>(sigma)), label,
+                                 bytes, pixels, true, "px" },
+                               [&]() { grid.apply(input, output); }));
+        printf("    grid %zux%zux%zu cells, %.1f MB\n", grid.grid_width(), grid.grid_height(),
+               grid.grid_depth(), grid.grid_bytes() / 1e6);
+    }
+}
+
+int main(int argc, char** argv) {
+    bench::Harness harness("bilateral", argc, argv);
+
+    printf("=== ARES Bilateral Grid Benchmarks ===\n\n");
+    printf("Baseline: brute-force bilateral (3 sigma window, single thread), sigma_range=%.2f\n",
+           BILATERAL_RANGE);
+    harness.print_context();
+    printf("\n");
+
+    printf("Reference comparison\n");
+    benchmark_reference(harness, 640, 360, 4.0f);
+    benchmark_reference(harness, 640, 360, 8.0f);
+    printf("\n");
+
+    const size_t sizes[][2] = { { 1920, 1080 }, { 3840, 2160 } };
+    for (const auto& size : sizes) {
+        printf("Frame: %zux%zu\n", size[0], size[1]);
+        benchmark_frames(harness, size[0], size[1]);
+        printf("\n");
+    }
+
+    printf("=== Benchmark Complete ===\n");
+    printf("\nNotes:\n");
+    printf("- grid: BilateralGrid::apply() with the grid kept between calls\n");
+    printf("- gaussian-s8: gaussian_blur_tiled at sigma 8, not edge-preserving, for scale\n");
+
+    return harness.finish();
+}
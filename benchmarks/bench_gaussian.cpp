@@ -1,23 +1,15 @@
 #include "ares/gaussian_blur.hpp"
-#include <chrono>
+#include "ares/cpu_dispatch.hpp"
+#include "ares/tile_tuning.hpp"
+#include "bench_harness.hpp"
 #include <cstdio>
 #include <cmath>
+#include <string>
+#include <vector>
 
 using namespace ares;
-using namespace std::chrono;
 
-template<typename Func>
-double measure(Func func, int iterations = 10) {
-    auto start = high_resolution_clock::now();
-    for (int i = 0; i < iterations; ++i) {
-        func();
-    }
-    auto end = high_resolution_clock::now();
-    auto duration = duration_cast<microseconds>(end - start).count();
-    return duration / static_cast<double>(iterations);
-}
-
-void benchmark_gaussian(size_t width, size_t height) {
+void benchmark_gaussian(bench::Harness& harness, size_t width, size_t height) {
     Image input(width, height);
     Image output(width, height);
     
@@ -33,60 +25,125 @@ void benchmark_gaussian(size_t width, size_t height) {
     }
     
     float sigma = 2.0f;
+    const std::string size = std::to_string(width) + "x" + std::to_string(height);
+    const double pixels = static_cast<double>(width * height);
+    const double bytes = pixels * 4 * sizeof(float);
     
-    // Benchmark baseline
-    double baseline_time = measure([&]() {
+    auto make_case = [&](const std::string& variant, bool multithreaded = false) {
+        return bench::Case{ "gaussian", variant, size, bytes, pixels, multithreaded, "px" };
+    };
+    
+    harness.run(make_case("baseline"), [&]() {
         gaussian_blur_baseline(input, output, sigma);
-    }, 5);
+    });
+    
+    // SIMD at every ISA level the CPU supports, widest last
+    const IsaLevel detected = detected_isa_level();
+    for (int l = static_cast<int>(IsaLevel::SSE42); l <= static_cast<int>(detected); ++l) {
+        IsaLevel level = set_isa_level(static_cast<IsaLevel>(l));
+        harness.run(make_case(std::string("simd-") + isa_level_name(level)), [&]() {
+            gaussian_blur_simd(input, output, sigma);
+        });
+    }
+    set_isa_level(detected);
     
-    printf("  Baseline:  %8.2f ms\n", baseline_time / 1000.0);
+    // Widest ISA from here on
+    harness.run(make_case("tiled"), [&]() {
+        gaussian_blur_tiled(input, output, sigma);
+    });
     
-    // Benchmark SIMD
-    double simd_time = measure([&]() {
-        gaussian_blur_simd(input, output, sigma);
-    }, 5);
+    // Fixed 32x32 tiles, as before the cache model
+    const TilePolicy model = tile_policy();
+    TilePolicy fixed;
+    fixed.fixed_width = 32;
+    fixed.fixed_height = 32;
+    set_tile_policy(fixed);
+    harness.run(make_case("tiled-32x32"), [&]() {
+        gaussian_blur_tiled(input, output, sigma);
+    });
+    set_tile_policy(model);
     
-    double simd_speedup = baseline_time / simd_time;
-    printf("  SIMD:      %8.2f ms  |  %.2fx speedup\n",
-           simd_time / 1000.0, simd_speedup);
+    harness.run(make_case("multithreaded", true), [&]() {
+        gaussian_blur_multithreaded(input, output, sigma);
+    });
     
-    // Benchmark tiled
-    double tiled_time = measure([&]() {
+    if (has_avx512_support()) {
+        harness.run(make_case("avx512"), [&]() {
+            gaussian_blur_avx512(input, output, sigma);
+        });
+    } else {
+        printf("  avx512             [AVX-512 not supported]\n");
+    }
+}
+
+// Blur a few face-sized rectangles of a 4K frame vs the whole frame
+void benchmark_roi(bench::Harness& harness) {
+    const size_t width = 3840;
+    const size_t height = 2160;
+    Image input(width, height);
+    Image output(width, height);
+    
+    for (size_t i = 0; i < width * height * 4; ++i) {
+        input.data[i] = static_cast<float>(i % 251) / 250.0f;
+    }
+    
+    float sigma = 2.0f;
+    const std::string size = "3840x2160";
+    
+    // The full frame is the reference the ROI speedups are reported against
+    harness.run({ "gaussian-roi", "baseline", size, 0.0, double(width * height), false, "px" }, [&]() {
         gaussian_blur_tiled(input, output, sigma);
-    }, 5);
+    });
     
-    double tiled_speedup = baseline_time / tiled_time;
-    printf("  Tiled:     %8.2f ms  |  %.2fx speedup\n",
-           tiled_time / 1000.0, tiled_speedup);
+    const Rect one[] = { { 1700, 900, 256, 256 } };
+    harness.run({ "gaussian-roi", "roi-1", size, 0.0, 256.0 * 256.0, true, "px" }, [&]() {
+        gaussian_blur_rois(input, output, one, sigma);
+    });
     
-    // Additional metrics
-    size_t pixels = width * height;
-    double mpixels_per_sec = pixels / (tiled_time / 1000000.0) / 1000000.0;
-    printf("  Best throughput: %.2f Mpixels/s\n", mpixels_per_sec);
+    std::vector<Rect> many;
+    for (size_t i = 0; i < 16; ++i) {
+        many.push_back(Rect{ 100 + (i % 8) * 450, 300 + (i / 8) * 900, 256, 256 });
+    }
+    harness.run({ "gaussian-roi", "rois-16", size, 0.0, 16.0 * 256.0 * 256.0, true, "px" }, [&]() {
+        gaussian_blur_rois(input, output, many, sigma);
+    });
 }
 
-int main() {
+int main(int argc, char** argv) {
+    bench::Harness harness("gaussian", argc, argv);
+    
     printf("=== ARES Gaussian Blur Benchmarks ===\n\n");
     printf("Testing 2D Gaussian blur performance (sigma=2.0)\n");
-    printf("Format: Time per operation | Speedup vs baseline\n\n");
-    
-    printf("Image Size: 512 x 512\n");
-    benchmark_gaussian(512, 512);
+    printf("Default kernel: %s\n", active_gaussian_kernel());
+    const CacheInfo& cache = cache_info();
+    const TileConfig tiles = gaussian_tile_config(6, 1024);
+    printf("Caches (%s): L1d %zu KB, L2 %zu KB; sigma 2 tiles at 1024 wide: %zux%zu, prefetch %d rows\n",
+           cache.source, cache.l1d_bytes >> 10, cache.l2_bytes >> 10,
+           tiles.width, tiles.height, tiles.prefetch_rows);
+    harness.print_context();
     
-    printf("\nImage Size: 1024 x 1024\n");
-    benchmark_gaussian(1024, 1024);
-    
-    printf("\nImage Size: 2048 x 2048\n");
-    benchmark_gaussian(2048, 2048);
+    const struct { size_t width, height; const char* label; } sizes[] = {
+        { 512, 512, "512 x 512" },
+        { 1024, 1024, "1024 x 1024" },
+        { 2048, 2048, "2048 x 2048" },
+        { 3840, 2160, "3840 x 2160 (4K)" },
+    };
+    for (const auto& s : sizes) {
+        printf("Image Size: %s\n", s.label);
+        benchmark_gaussian(harness, s.width, s.height);
+        printf("\n");
+    }
     
-    printf("\nImage Size: 3840 x 2160 (4K)\n");
-    benchmark_gaussian(3840, 2160);
+    printf("Region of interest: 3840 x 2160 (4K), speedup vs full frame\n");
+    benchmark_roi(harness);
     
     printf("\n=== Benchmark Complete ===\n");
     printf("\nOptimization Techniques:\n");
-    printf("- SIMD: AVX2 vectorization (8 floats at a time)\n");
-    printf("- Tiled: 32x32 cache blocking + SIMD + prefetching\n");
-    printf("- Both use separable Gaussian convolution\n");
+    printf("- SIMD: SSE4.2 / AVX2 / AVX-512 kernels selected at runtime\n");
+    printf("- Tiled: tiles sized from L1/L2 (tile_tuning.hpp) + SIMD + prefetching\n");
+    printf("- Multithreaded: row bands of the tiled blur on every core\n");
+    printf("- AVX-512: 16 lanes (4 RGBA pixels) per vector, masked row tails\n");
+    printf("- All use separable Gaussian convolution\n");
     
-    return 0;
+    return harness.finish();
 }
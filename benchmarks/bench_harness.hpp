@@ -0,0 +1,603 @@
+#pragma once
+
+// Small benchmark harness shared by the bench_* executables, in the
+// spirit of Google Benchmark: warm-up, adaptive iteration counts, robust
+// statistics (median, p5/p95, stddev, IQR outliers), optional CPU pinning,
+// hardware counters (perf_counters.hpp) and JSON/CSV output for
+// visualize_performance.py.
+//
+// Command line (every bench_* executable):
+//   --json=FILE       write results as JSON
+//   --csv=FILE        write results as CSV
+//   --min-time=SEC    measure each case for at least SEC seconds (0.25)
+//   --max-time=SEC    stop slow cases after SEC seconds, >= 3 samples (2)
+//   --cpu=N           pin the benchmark thread to CPU N
+//   --filter=TEXT     run only cases whose name contains TEXT
+//   --no-counters     skip the perf_event_open pass
+//   --trace=FILE      trace one extra call per case (ares/trace.hpp) and
+//                     write Chrome trace-event JSON; needs a build with
+//                     -DARES_ENABLE_TRACING=ON for the library's phases
+
+#include "ares/cpu_dispatch.hpp"
+#include "ares/trace.hpp"
+#include "perf_counters.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <deque>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#elif defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+namespace ares {
+namespace bench {
+
+struct Options {
+    double min_time = 0.25;
+    double max_time = 2.0;
+    double warmup_time = 0.05;
+    size_t min_samples = 10;
+    size_t max_samples = 1000;
+    int cpu = -1;
+    std::string json_path;
+    std::string csv_path;
+    std::string filter;
+    bool counters = true;
+    std::string trace_path;
+};
+
+/**
+ * One benchmark case. Results are grouped by (group, size) and compared
+ * against the variant named "baseline" of the same group and size.
+ */
+struct Case {
+    std::string group;            ///< e.g. "aes", "gaussian"
+    std::string variant;          ///< e.g. "baseline", "simd-avx2", "multithreaded"
+    std::string size;             ///< e.g. "1 MB", "1024x1024"
+    double bytes = 0.0;           ///< Bytes processed per call (0: not reported)
+    double items = 0.0;           ///< Items (pixels, images) per call (0: not reported)
+    bool multithreaded = false;   ///< Runs unpinned when --cpu is given
+    std::string item_unit = "item";  ///< For per-item counter metrics, e.g. "px"
+
+    std::string name() const { return group + "/" + variant + "/" + size; }
+};
+
+struct Result {
+    Case c;
+    size_t samples = 0;
+    size_t iterations_per_sample = 0;
+    double median_us = 0.0;
+    double mean_us = 0.0;
+    double stddev_us = 0.0;
+    double min_us = 0.0;
+    double max_us = 0.0;
+    double p5_us = 0.0;
+    double p95_us = 0.0;
+    size_t outliers = 0;          ///< Samples outside 1.5 IQR of the quartiles
+    CounterValues counters;       ///< Per call; calling thread only
+    std::vector<std::pair<std::string, double>> metrics;  ///< Added by the benchmark (JSON only)
+
+    double bytes_per_second() const { return c.bytes > 0 ? c.bytes / (median_us * 1e-6) : 0.0; }
+    double items_per_second() const { return c.items > 0 ? c.items / (median_us * 1e-6) : 0.0; }
+
+    // Derived counter metrics; 0 when the counters involved are missing
+    double ipc() const {
+        return counters.has(Counter::Cycles) && counters.has(Counter::Instructions) &&
+               counters[Counter::Cycles] > 0
+                   ? counters[Counter::Instructions] / counters[Counter::Cycles] : 0.0;
+    }
+    double cycles_per_byte() const {
+        return counters.has(Counter::Cycles) && c.bytes > 0 ? counters[Counter::Cycles] / c.bytes : 0.0;
+    }
+    double cycles_per_item() const {
+        return counters.has(Counter::Cycles) && c.items > 0 ? counters[Counter::Cycles] / c.items : 0.0;
+    }
+    double cache_miss_ratio() const {
+        return counters.has(Counter::CacheMisses) && counters.has(Counter::CacheReferences) &&
+               counters[Counter::CacheReferences] > 0
+                   ? counters[Counter::CacheMisses] / counters[Counter::CacheReferences] : 0.0;
+    }
+};
+
+namespace detail {
+
+// Linear interpolation between closest ranks; v must be sorted
+inline double percentile(const std::vector<double>& v, double p) {
+    if (v.empty()) {
+        return 0.0;
+    }
+    const double pos = p * static_cast<double>(v.size() - 1);
+    const size_t lo = static_cast<size_t>(pos);
+    const size_t hi = std::min(lo + 1, v.size() - 1);
+    return v[lo] + (v[hi] - v[lo]) * (pos - static_cast<double>(lo));
+}
+
+inline std::string json_escape(const std::string& s) {
+    std::string out;
+    for (char ch : s) {
+        if (ch == '"' || ch == '\\') {
+            out.push_back('\\');
+        }
+        out.push_back(ch);
+    }
+    return out;
+}
+
+// Pin / unpin the calling thread. Threads it creates inherit the mask.
+class Affinity {
+public:
+    Affinity() {
+#if defined(__linux__)
+        valid_ = sched_getaffinity(0, sizeof(original_), &original_) == 0;
+#elif defined(_WIN32)
+        DWORD_PTR system_mask;
+        valid_ = GetProcessAffinityMask(GetCurrentProcess(), &original_, &system_mask) != 0;
+#endif
+    }
+
+    bool pin(int cpu) {
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        return sched_setaffinity(0, sizeof(set), &set) == 0;
+#elif defined(_WIN32)
+        return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu) != 0;
+#else
+        (void)cpu;
+        return false;
+#endif
+    }
+
+    void restore() {
+        if (!valid_) {
+            return;
+        }
+#if defined(__linux__)
+        sched_setaffinity(0, sizeof(original_), &original_);
+#elif defined(_WIN32)
+        SetThreadAffinityMask(GetCurrentThread(), original_);
+#endif
+    }
+
+private:
+    bool valid_ = false;
+#if defined(__linux__)
+    cpu_set_t original_;
+#elif defined(_WIN32)
+    DWORD_PTR original_ = 0;
+#endif
+};
+
+} // namespace detail
+
+class Harness {
+public:
+    Harness(const char* suite, int argc, char** argv) : suite_(suite) {
+        for (int i = 1; i < argc; ++i) {
+            const char* arg = argv[i];
+            if (std::strncmp(arg, "--json=", 7) == 0) {
+                options_.json_path = arg + 7;
+            } else if (std::strncmp(arg, "--csv=", 6) == 0) {
+                options_.csv_path = arg + 6;
+            } else if (std::strncmp(arg, "--min-time=", 11) == 0) {
+                options_.min_time = std::atof(arg + 11);
+            } else if (std::strncmp(arg, "--max-time=", 11) == 0) {
+                options_.max_time = std::atof(arg + 11);
+            } else if (std::strncmp(arg, "--cpu=", 6) == 0) {
+                options_.cpu = std::atoi(arg + 6);
+            } else if (std::strncmp(arg, "--filter=", 9) == 0) {
+                options_.filter = arg + 9;
+            } else if (std::strcmp(arg, "--no-counters") == 0) {
+                options_.counters = false;
+            } else if (std::strncmp(arg, "--trace=", 8) == 0) {
+                options_.trace_path = arg + 8;
+            } else {
+                std::fprintf(stderr, "Unknown option %s\n", arg);
+                std::fprintf(stderr, "Options: --json=FILE --csv=FILE --min-time=SEC "
+                                     "--max-time=SEC --cpu=N --filter=TEXT --no-counters --trace=FILE\n");
+                std::exit(2);
+            }
+        }
+        options_.max_time = std::max(options_.max_time, options_.min_time);
+
+        if (options_.cpu >= 0) {
+            pinned_ = affinity_.pin(options_.cpu);
+            if (!pinned_) {
+                std::fprintf(stderr, "warning: could not pin to CPU %d, running unpinned\n",
+                             options_.cpu);
+            }
+        }
+
+        if (options_.counters) {
+            counters_available_ = counters_.open();
+        }
+
+        if (!options_.trace_path.empty()) {
+            if (!tracing_compiled_in()) {
+                std::fprintf(stderr, "warning: library built without ARES_ENABLE_TRACING, "
+                                     "the trace will only show benchmark cases\n");
+            }
+            trace_start();
+            trace_stop();
+        }
+    }
+
+    const Options& options() const { return options_; }
+
+    /**
+     * Extra number for the JSON "context" object, e.g. a measured machine
+     * limit the results should be read against.
+     */
+    void add_context(const std::string& key, double value) {
+        context_.emplace_back(key, value);
+    }
+
+    /**
+     * Measure fn() and print one line. Returns nullptr if the case is
+     * excluded by --filter; benchmarks may append to the result's metrics.
+     */
+    template<typename Fn>
+    Result* run(const Case& c, Fn&& fn) {
+        using clock = std::chrono::steady_clock;
+        const std::string name = c.name();
+        if (!options_.filter.empty() && name.find(options_.filter) == std::string::npos) {
+            return nullptr;
+        }
+
+        // Multithreaded cases need every core; pool threads created here
+        // also start with the full mask
+        if (c.multithreaded && pinned_) {
+            affinity_.restore();
+        }
+
+        // Warm-up: caches, page faults, lazily created pools; at least one call
+        size_t warm_calls = 0;
+        const auto warm_start = clock::now();
+        double warm_elapsed = 0.0;
+        do {
+            fn();
+            ++warm_calls;
+            warm_elapsed = std::chrono::duration<double>(clock::now() - warm_start).count();
+        } while (warm_elapsed < options_.warmup_time);
+        const double per_call = warm_elapsed / static_cast<double>(warm_calls);
+
+        // Batch fast calls so each sample is long enough to time reliably
+        const double target_sample = options_.min_time / static_cast<double>(options_.min_samples);
+        const size_t batch = std::max<size_t>(1, static_cast<size_t>(target_sample / std::max(per_call, 1e-9)));
+
+        std::vector<double> samples;
+        const auto start = clock::now();
+        for (;;) {
+            const auto t0 = clock::now();
+            for (size_t i = 0; i < batch; ++i) {
+                fn();
+            }
+            const auto t1 = clock::now();
+            samples.push_back(std::chrono::duration<double, std::micro>(t1 - t0).count() /
+                              static_cast<double>(batch));
+
+            const double elapsed = std::chrono::duration<double>(t1 - start).count();
+            if (samples.size() >= options_.max_samples) break;
+            if (samples.size() >= options_.min_samples && elapsed >= options_.min_time) break;
+            if (samples.size() >= 3 && elapsed >= options_.max_time) break;
+        }
+
+        // One extra sample under the counters, kept out of the timings
+        CounterValues counted;
+        if (counters_available_) {
+            counters_.start();
+            for (size_t i = 0; i < batch; ++i) {
+                fn();
+            }
+            counted = counters_.stop().per_call(batch);
+        }
+
+        // One traced call under a span named after the case, also kept
+        // out of the timings
+        if (!options_.trace_path.empty()) {
+            const char* span = trace_names_.emplace_back(name).c_str();
+            trace_resume();
+            {
+                ares::detail::TraceScope scope(span);
+                fn();
+            }
+            trace_stop();
+        }
+
+        if (c.multithreaded && pinned_) {
+            affinity_.pin(options_.cpu);
+        }
+
+        results_.push_back(summarize(c, samples, batch));
+        results_.back().counters = counted;
+        Result& r = results_.back();
+        print(r);
+        return &r;
+    }
+
+    /**
+     * Write the requested JSON/CSV files. Returns the process exit code.
+     */
+    int finish() const {
+        int rc = 0;
+        if (!options_.json_path.empty() && !write_json(options_.json_path)) {
+            std::fprintf(stderr, "error: cannot write %s\n", options_.json_path.c_str());
+            rc = 1;
+        }
+        if (!options_.csv_path.empty() && !write_csv(options_.csv_path)) {
+            std::fprintf(stderr, "error: cannot write %s\n", options_.csv_path.c_str());
+            rc = 1;
+        }
+        if (!options_.trace_path.empty() && !write_chrome_trace(options_.trace_path)) {
+            std::fprintf(stderr, "error: cannot write %s\n", options_.trace_path.c_str());
+            rc = 1;
+        }
+        return rc;
+    }
+
+    void print_context() const {
+        std::printf("Dispatch: detected %s, active %s | %u hardware threads | %s\n",
+                    isa_level_name(detected_isa_level()), isa_level_name(active_isa_level()),
+                    std::thread::hardware_concurrency(),
+                    pinned_ ? ("pinned to CPU " + std::to_string(options_.cpu)).c_str() : "unpinned");
+        std::printf("Counters: %s\n", options_.counters ? counters_.status().c_str() : "disabled");
+        std::printf("Columns: median [p5, p95] ±stddev per call | throughput | speedup vs baseline\n\n");
+    }
+
+private:
+    static Result summarize(const Case& c, std::vector<double> samples, size_t batch) {
+        Result r;
+        r.c = c;
+        r.samples = samples.size();
+        r.iterations_per_sample = batch;
+
+        std::sort(samples.begin(), samples.end());
+        double sum = 0.0;
+        for (double s : samples) {
+            sum += s;
+        }
+        r.mean_us = sum / static_cast<double>(samples.size());
+        double var = 0.0;
+        for (double s : samples) {
+            var += (s - r.mean_us) * (s - r.mean_us);
+        }
+        r.stddev_us = samples.size() > 1 ? std::sqrt(var / static_cast<double>(samples.size() - 1)) : 0.0;
+        r.min_us = samples.front();
+        r.max_us = samples.back();
+        r.median_us = detail::percentile(samples, 0.5);
+        r.p5_us = detail::percentile(samples, 0.05);
+        r.p95_us = detail::percentile(samples, 0.95);
+
+        const double q1 = detail::percentile(samples, 0.25);
+        const double q3 = detail::percentile(samples, 0.75);
+        const double fence = 1.5 * (q3 - q1);
+        for (double s : samples) {
+            if (s < q1 - fence || s > q3 + fence) {
+                ++r.outliers;
+            }
+        }
+        return r;
+    }
+
+    const Result* find_baseline(const Case& c) const {
+        for (const Result& r : results_) {
+            if (r.c.group == c.group && r.c.size == c.size && r.c.variant == "baseline") {
+                return &r;
+            }
+        }
+        return nullptr;
+    }
+
+    static void format_time(char* buf, size_t n, double us) {
+        if (us >= 1e6) {
+            std::snprintf(buf, n, "%8.3f s ", us * 1e-6);
+        } else if (us >= 1e3) {
+            std::snprintf(buf, n, "%8.3f ms", us * 1e-3);
+        } else {
+            std::snprintf(buf, n, "%8.3f μs", us);
+        }
+    }
+
+    void print(const Result& r) const {
+        char median[32], p5[32], p95[32];
+        format_time(median, sizeof(median), r.median_us);
+        format_time(p5, sizeof(p5), r.p5_us);
+        format_time(p95, sizeof(p95), r.p95_us);
+
+        char throughput[48] = "";
+        if (r.c.bytes > 0) {
+            std::snprintf(throughput, sizeof(throughput), "%9.1f MB/s", r.bytes_per_second() / (1024.0 * 1024.0));
+        } else if (r.c.items > 0) {
+            const double rate = r.items_per_second();
+            if (rate >= 1e6) {
+                std::snprintf(throughput, sizeof(throughput), "%9.2f M/s ", rate * 1e-6);
+            } else {
+                std::snprintf(throughput, sizeof(throughput), "%9.0f /s  ", rate);
+            }
+        }
+
+        char speedup[32] = "";
+        const Result* base = find_baseline(r.c);
+        if (base && base != &r) {
+            std::snprintf(speedup, sizeof(speedup), "  %6.2fx", base->median_us / r.median_us);
+        }
+
+        std::printf("  %-16s %s [%s, %s] ±%5.1f%%  %s%s%s\n",
+                    r.c.variant.c_str(), median, p5, p95,
+                    r.median_us > 0 ? 100.0 * r.stddev_us / r.median_us : 0.0,
+                    throughput, speedup, r.outliers ? "  (outliers)" : "");
+        print_counters(r);
+    }
+
+    // Second line with derived counter metrics, when there are any
+    static void print_counters(const Result& r) {
+        const CounterValues& v = r.counters;
+        std::string line;
+        char buf[64];
+        auto add = [&](const char* fmt, double value, const char* unit = "") {
+            std::snprintf(buf, sizeof(buf), fmt, value, unit);
+            line += line.empty() ? "" : " | ";
+            line += buf;
+        };
+        if (r.ipc() > 0) add("IPC %.2f", r.ipc());
+        if (r.cycles_per_byte() > 0) add("%.2f cycles/B", r.cycles_per_byte());
+        if (r.cycles_per_item() > 0) add("%.1f cycles/%s", r.cycles_per_item(), r.c.item_unit.c_str());
+        if (v.has(Counter::CacheReferences) && v.has(Counter::CacheMisses)) {
+            add("LLC miss %.1f%%", 100.0 * r.cache_miss_ratio());
+        }
+        if (v.has(Counter::L1DReadMisses) && r.c.bytes > 0) {
+            add("L1D miss %.2f/64B", v[Counter::L1DReadMisses] * 64.0 / r.c.bytes);
+        }
+        if (v.has(Counter::BranchMisses)) add("br-miss %.0f/call", v[Counter::BranchMisses]);
+        if (v.has(Counter::PageFaults) && v[Counter::PageFaults] >= 0.5) {
+            add("page faults %.0f/call", v[Counter::PageFaults]);
+        }
+        if (!line.empty()) {
+            std::printf("  %-16s %s%s\n", "", line.c_str(),
+                        r.c.multithreaded && v.any_hardware() ? "  [calling thread only]" : "");
+        }
+    }
+
+    bool write_json(const std::string& path) const {
+        FILE* f = std::fopen(path.c_str(), "w");
+        if (!f) {
+            return false;
+        }
+        char date[32];
+        std::time_t now = std::time(nullptr);
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+        std::fprintf(f, "{\n  \"context\": {\n");
+        std::fprintf(f, "    \"suite\": \"%s\",\n", detail::json_escape(suite_).c_str());
+        std::fprintf(f, "    \"date\": \"%s\",\n", date);
+        std::fprintf(f, "    \"detected_isa\": \"%s\",\n", isa_level_name(detected_isa_level()));
+        std::fprintf(f, "    \"hardware_threads\": %u,\n", std::thread::hardware_concurrency());
+        std::fprintf(f, "    \"pinned_cpu\": %d,\n", pinned_ ? options_.cpu : -1);
+        std::fprintf(f, "    \"min_time_s\": %g%s\n", options_.min_time, context_.empty() ? "" : ",");
+        for (size_t i = 0; i < context_.size(); ++i) {
+            std::fprintf(f, "    \"%s\": %.6g%s\n", detail::json_escape(context_[i].first).c_str(),
+                         context_[i].second, i + 1 < context_.size() ? "," : "");
+        }
+        std::fprintf(f, "  },\n  \"benchmarks\": [\n");
+        for (size_t i = 0; i < results_.size(); ++i) {
+            const Result& r = results_[i];
+            std::fprintf(f,
+                "    {\"name\": \"%s\", \"group\": \"%s\", \"variant\": \"%s\", \"size\": \"%s\", "
+                "\"multithreaded\": %s, \"samples\": %zu, \"iterations_per_sample\": %zu, "
+                "\"median_us\": %.6g, \"mean_us\": %.6g, \"stddev_us\": %.6g, "
+                "\"min_us\": %.6g, \"max_us\": %.6g, \"p5_us\": %.6g, \"p95_us\": %.6g, "
+                "\"outliers\": %zu, \"bytes\": %.17g, \"items\": %.17g, "
+                "\"bytes_per_second\": %.6g, \"items_per_second\": %.6g%s%s}%s\n",
+                detail::json_escape(r.c.name()).c_str(), detail::json_escape(r.c.group).c_str(),
+                detail::json_escape(r.c.variant).c_str(), detail::json_escape(r.c.size).c_str(),
+                r.c.multithreaded ? "true" : "false", r.samples, r.iterations_per_sample,
+                r.median_us, r.mean_us, r.stddev_us, r.min_us, r.max_us, r.p5_us, r.p95_us,
+                r.outliers, r.c.bytes, r.c.items, r.bytes_per_second(), r.items_per_second(),
+                json_counters(r).c_str(), json_metrics(r).c_str(), i + 1 < results_.size() ? "," : "");
+        }
+        std::fprintf(f, "  ]\n}\n");
+        return std::fclose(f) == 0;
+    }
+
+    // ", \"counters\": {...}" with the available per-call counts and
+    // derived metrics, or nothing
+    static std::string json_counters(const Result& r) {
+        if (!r.counters.any()) {
+            return "";
+        }
+        std::string out = ", \"counters\": {";
+        char buf[96];
+        bool first = true;
+        for (int i = 0; i < COUNTER_COUNT; ++i) {
+            if (r.counters.valid[i]) {
+                std::snprintf(buf, sizeof(buf), "%s\"%s\": %.6g", first ? "" : ", ",
+                              counter_name(static_cast<Counter>(i)), r.counters.value[i]);
+                out += buf;
+                first = false;
+            }
+        }
+        const struct { const char* name; double value; } derived[] = {
+            { "ipc", r.ipc() },
+            { "cycles_per_byte", r.cycles_per_byte() },
+            { "cycles_per_item", r.cycles_per_item() },
+            { "cache_miss_ratio", r.cache_miss_ratio() },
+        };
+        for (const auto& d : derived) {
+            if (d.value > 0) {
+                std::snprintf(buf, sizeof(buf), ", \"%s\": %.6g", d.name, d.value);
+                out += buf;
+            }
+        }
+        return out + "}";
+    }
+
+    static std::string json_metrics(const Result& r) {
+        if (r.metrics.empty()) {
+            return "";
+        }
+        std::string out = ", \"metrics\": {";
+        char buf[32];
+        for (size_t i = 0; i < r.metrics.size(); ++i) {
+            std::snprintf(buf, sizeof(buf), "%.6g", r.metrics[i].second);
+            out += (i ? ", \"" : "\"") + detail::json_escape(r.metrics[i].first) + "\": " + buf;
+        }
+        return out + "}";
+    }
+
+    bool write_csv(const std::string& path) const {
+        FILE* f = std::fopen(path.c_str(), "w");
+        if (!f) {
+            return false;
+        }
+        std::fprintf(f, "name,group,variant,size,multithreaded,samples,iterations_per_sample,"
+                        "median_us,mean_us,stddev_us,min_us,max_us,p5_us,p95_us,outliers,"
+                        "bytes,items,bytes_per_second,items_per_second");
+        for (int i = 0; i < COUNTER_COUNT; ++i) {
+            std::fprintf(f, ",%s", counter_name(static_cast<Counter>(i)));
+        }
+        std::fprintf(f, "\n");
+        for (const Result& r : results_) {
+            std::fprintf(f, "%s,%s,%s,%s,%d,%zu,%zu,%.6g,%.6g,%.6g,%.6g,%.6g,%.6g,%.6g,%zu,%.17g,%.17g,%.6g,%.6g",
+                         r.c.name().c_str(), r.c.group.c_str(), r.c.variant.c_str(), r.c.size.c_str(),
+                         r.c.multithreaded ? 1 : 0, r.samples, r.iterations_per_sample,
+                         r.median_us, r.mean_us, r.stddev_us, r.min_us, r.max_us, r.p5_us, r.p95_us,
+                         r.outliers, r.c.bytes, r.c.items, r.bytes_per_second(), r.items_per_second());
+            // Missing counters are left empty
+            for (int i = 0; i < COUNTER_COUNT; ++i) {
+                if (r.counters.valid[i]) {
+                    std::fprintf(f, ",%.6g", r.counters.value[i]);
+                } else {
+                    std::fprintf(f, ",");
+                }
+            }
+            std::fprintf(f, "\n");
+        }
+        return std::fclose(f) == 0;
+    }
+
+    std::string suite_;
+    Options options_;
+    detail::Affinity affinity_;
+    bool pinned_ = false;
+    PerfCounters counters_;
+    bool counters_available_ = false;
+    std::vector<std::pair<std::string, double>> context_;
+    std::deque<Result> results_;  // stable addresses for run()'s return value
+    std::deque<std::string> trace_names_;  // span names must outlive the trace
+};
+
+} // namespace bench
+} // namespace ares
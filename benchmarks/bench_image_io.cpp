@@ -0,0 +1,60 @@
+#include "ares/gaussian_blur.hpp"
+#include "ares/image_io.hpp"
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+using namespace ares;
+using namespace std::chrono;
+
+template<typename Func>
+double measure(Func func, int iterations = 5) {
+    auto start = high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        func();
+    }
+    auto end = high_resolution_clock::now();
+    auto duration = duration_cast<microseconds>(end - start).count();
+    return duration / static_cast<double>(iterations);
+}
+
+void benchmark_io(size_t size) {
+    Image img = create_test_image(size, size);
+    Image loaded(size, size);
+    Image blurred(size, size);
+    const std::string ppm = "ares_bench_io.ppm";
+    const std::string pfm = "ares_bench_io.pfm";
+    
+    double save_ppm = measure([&]() { save_image_ppm(img, ppm); });
+    double load_ppm = measure([&]() { load_image(ppm, loaded); });
+    double save_pfm = measure([&]() { save_image_pfm(img, pfm); });
+    double load_pfm = measure([&]() { load_image(pfm, loaded); });
+    double blur = measure([&]() { gaussian_blur_simd(img, blurred, 2.0f); });
+    
+    std::remove(ppm.c_str());
+    std::remove(pfm.c_str());
+    
+    // Throughput in terms of the in-memory float RGBA image
+    double mb = img.size_bytes() / (1024.0 * 1024.0);
+    auto mbps = [&](double us) { return mb / (us / 1000000.0); };
+    
+    printf("  Save PPM:   %9.2f μs  |  %8.2f MB/s\n", save_ppm, mbps(save_ppm));
+    printf("  Load PPM:   %9.2f μs  |  %8.2f MB/s\n", load_ppm, mbps(load_ppm));
+    printf("  Save PFM:   %9.2f μs  |  %8.2f MB/s\n", save_pfm, mbps(save_pfm));
+    printf("  Load PFM:   %9.2f μs  |  %8.2f MB/s\n", load_pfm, mbps(load_pfm));
+    printf("  Blur (ref): %9.2f μs  |  %8.2f MB/s\n", blur, mbps(blur));
+}
+
+int main() {
+    printf("=== ARES Image I/O Benchmarks ===\n\n");
+    printf("Format: Time per call | Throughput (float RGBA image size)\n\n");
+    
+    printf("Image: 1024x1024\n");
+    benchmark_io(1024);
+    
+    printf("\nImage: 4096x4096\n");
+    benchmark_io(4096);
+    
+    printf("\n=== Benchmark Complete ===\n");
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include "bench_harness.hpp"
+#include "ares/gaussian_incremental.hpp"
+#include "ares/gaussian_blur.hpp"
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace ares;
+
+static const float INCREMENTAL_SIGMA = 2.0f;
+
+// Damage pattern of one compositor frame: `count` rectangles of w x h
+// spread over the image
+struct Damage {
+    const char* name;
+    size_t count;
+    size_t width;
+    size_t height;
+};
+
+static std::vector<Rect> spread_rects(const Damage& d, size_t image_width, size_t image_height) {
+    std::vector<Rect> rects;
+    for (size_t i = 0; i < d.count; ++i) {
+        const size_t x = (i * 7919 + 101) % (image_width - d.width);
+        const size_t y = (i * 6271 + 53) % (image_height - d.height);
+        rects.push_back({ x, y, d.width, d.height });
+    }
+    return rects;
+}
+
+void benchmark_incremental(bench::Harness& harness, size_t width, size_t height) {
+    const std::string label = std::to_string(width) + "x" + std::to_string(height);
+    const double pixels = static_cast<double>(width * height);
+    const double bytes = pixels * 4 * sizeof(float);
+
+    Image frame(width, height);
+    for (size_t i = 0; i < width * height * 4; ++i) {
+        frame.data[i] = std::sin(i * 0.001f) * 0.5f + 0.5f;
+    }
+    Image output(width, height);
+
+    // Single-threaded full re-blur, as every frame costs today
+    harness.run({ "incremental", "baseline", label, bytes, pixels, false, "px" },
+                [&]() { gaussian_blur_tiled(frame, output, INCREMENTAL_SIGMA); });
+
+    IncrementalBlur blur(INCREMENTAL_SIGMA);
+    blur.reset(frame);
+    const Damage patterns[] = {
+        { "cursor", 1, 32, 32 },
+        { "widgets", 16, 96, 48 },
+        { "windows", 4, 640, 480 },
+    };
+    for (const Damage& d : patterns) {
+        const std::vector<Rect> rects = spread_rects(d, width, height);
+        blur.update(frame, rects);
+        const size_t recomputed = blur.recomputed_pixels();
+        // Throughput counts the whole frame kept up to date per call
+        harness.run({ "incremental", std::string("update-") + d.name, label, bytes, pixels, false, "px" },
+                    [&]() { blur.update(frame, rects); });
+        printf("    %zu x %zux%zu dirty: %.2f%% of the frame, %zu pixels filtered (both passes)\n",
+               d.count, d.width, d.height, 100.0 * d.count * d.width * d.height / pixels, recomputed);
+    }
+}
+
+int main(int argc, char** argv) {
+    bench::Harness harness("incremental", argc, argv);
+
+    printf("=== ARES Incremental Blur Benchmarks ===\n\n");
+    printf("Baseline: gaussian_blur_tiled of the whole frame (sigma=%.1f, single thread)\n", INCREMENTAL_SIGMA);
+    harness.print_context();
+    printf("\n");
+
+    const size_t sizes[][2] = { { 1920, 1080 }, { 3840, 2160 } };
+    for (const auto& size : sizes) {
+        printf("Frame: %zux%zu\n", size[0], size[1]);
+        benchmark_incremental(harness, size[0], size[1]);
+        printf("\n");
+    }
+
+    printf("=== Benchmark Complete ===\n");
+    printf("\nNotes:\n");
+    printf("- update-*: IncrementalBlur::update() with the listed dirty rectangles\n");
+    printf("- Throughput counts every pixel of the frame, so it is the equivalent full-blur rate\n");
+
+    return harness.finish();
+}
@@ -0,0 +1,160 @@
+#include "bench_harness.hpp"
+#include "ares/frame_pipeline.hpp"
+#include "ares/gaussian_blur.hpp"
+#include "ares/image_io.hpp"
+#include "ares/pixel_format.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ares;
+
+static const size_t FRAMES_PER_CALL = 8;
+static const float PIPELINE_SIGMA = 2.0f;
+
+// Print and attach sustained fps and latency percentiles to one result
+static void report_latency(bench::Result* r, double p50, double p95, double p99) {
+    if (r == nullptr) {
+        return;
+    }
+    printf("    %.1f fps, latency p50 %.1f ms, p95 %.1f ms, p99 %.1f ms\n",
+           r->items_per_second(), p50, p95, p99);
+    r->metrics = {
+        { "fps", r->items_per_second() },
+        { "latency_p50_ms", p50 },
+        { "latency_p95_ms", p95 },
+        { "latency_p99_ms", p99 },
+    };
+}
+
+// Nearest-rank percentile, as FramePipelineStats reports them
+static double percentile(std::vector<double> ms, double p) {
+    if (ms.empty()) {
+        return 0.0;
+    }
+    std::sort(ms.begin(), ms.end());
+    const size_t rank = static_cast<size_t>(std::ceil(p * ms.size()));
+    return ms[std::min(std::max(rank, size_t{1}), ms.size()) - 1];
+}
+
+// Load and store stages of one frame source
+struct FrameIo {
+    const char* name;
+    FrameLoader load;
+    FrameStorer store;
+};
+
+// The serial loop the pipeline replaces: load, blur, store, next frame
+static void run_serial(const FrameIo& io, Image& input, Image& output, std::vector<double>& latencies_ms) {
+    using clock = std::chrono::steady_clock;
+    latencies_ms.clear();
+    for (size_t frame = 0; frame < FRAMES_PER_CALL; ++frame) {
+        const auto start = clock::now();
+        io.load(frame, input);
+        gaussian_blur_tiled(input, output, PIPELINE_SIGMA);
+        io.store(frame, output);
+        latencies_ms.push_back(std::chrono::duration<double, std::milli>(clock::now() - start).count());
+    }
+}
+
+static FramePipelineStats run_pipelined(const FrameIo& io, FramePipeline& pipeline) {
+    return pipeline.run(
+        [&](size_t frame, Image& image) { return frame < FRAMES_PER_CALL && io.load(frame, image); },
+        io.store, PIPELINE_SIGMA);
+}
+
+void benchmark_pipeline(bench::Harness& harness, const FrameIo& io, size_t width, size_t height) {
+    const std::string group = std::string("frames-") + io.name;
+    const std::string label = std::to_string(width) + "x" + std::to_string(height);
+    const double frames = static_cast<double>(FRAMES_PER_CALL);
+    const double bytes = frames * width * height * 4 * sizeof(float);
+
+    Image input(width, height);
+    Image output(width, height);
+    std::vector<double> latencies_ms;
+    bench::Result* r = harness.run({ group, "baseline", label, bytes, frames, true, "frame" },
+                                   [&]() { run_serial(io, input, output, latencies_ms); });
+    report_latency(r, percentile(latencies_ms, 0.50), percentile(latencies_ms, 0.95),
+                   percentile(latencies_ms, 0.99));
+
+    std::vector<unsigned int> worker_counts = { 1 };
+    const unsigned int cores = std::thread::hardware_concurrency();
+    if (cores > 1) {
+        worker_counts.push_back(std::min(cores, 4u));
+    }
+    for (unsigned int workers : worker_counts) {
+        FramePipelineOptions options;
+        options.filter_workers = workers;
+        FramePipeline pipeline(width, height, options);
+        FramePipelineStats stats;
+        const std::string variant = workers == 1 ? "pipeline" : "pipeline-" + std::to_string(workers) + "w";
+        r = harness.run({ group, variant, label, bytes, frames, true, "frame" },
+                        [&]() { stats = run_pipelined(io, pipeline); });
+        report_latency(r, stats.latency_p50_ms, stats.latency_p95_ms, stats.latency_p99_ms);
+    }
+}
+
+int main(int argc, char** argv) {
+    bench::Harness harness("pipeline", argc, argv);
+
+    printf("=== ARES Frame Pipeline Benchmarks ===\n\n");
+    printf("Baseline: serial load, gaussian_blur_tiled (sigma=%.1f), store; %zu frames per call\n",
+           PIPELINE_SIGMA, FRAMES_PER_CALL);
+    harness.print_context();
+    printf("\n");
+
+    const size_t sizes[][2] = { { 1920, 1080 }, { 3840, 2160 } };
+    for (const auto& size : sizes) {
+        const size_t width = size[0];
+        const size_t height = size[1];
+        const Image source = create_test_image(width, height);
+
+        // Memory: 8-bit RGBA frames decoded to float and encoded back, as a
+        // capture card or video codec hands them over
+        std::vector<uint8_t> encoded_in(pixel_format_size(PixelFormat::RGBA_U8, width, height));
+        std::vector<uint8_t> encoded_out(encoded_in.size());
+        convert_from_rgba_f32(source.data, encoded_in.data(), PixelFormat::RGBA_U8, width, height);
+        const FrameIo memory = {
+            "memory",
+            [&](size_t, Image& image) {
+                convert_to_rgba_f32(encoded_in.data(), PixelFormat::RGBA_U8, image.data, width, height);
+                return true;
+            },
+            [&](size_t, const Image& image) {
+                convert_from_rgba_f32(image.data, encoded_out.data(), PixelFormat::RGBA_U8, width, height);
+                return true;
+            },
+        };
+
+        // Files: PPM read and write per frame, as demo.cpp saves its output
+        const std::string in_path = "ares_bench_pipeline_in.ppm";
+        const std::string out_path = "ares_bench_pipeline_out.ppm";
+        save_image_ppm(source, in_path);
+        const FrameIo files = {
+            "ppm",
+            [&](size_t, Image& image) { return load_image(in_path, image); },
+            [&](size_t, const Image& image) { return save_image_ppm(image, out_path); },
+        };
+
+        printf("Frames: %zux%zu\n", width, height);
+        benchmark_pipeline(harness, memory, width, height);
+        benchmark_pipeline(harness, files, width, height);
+        printf("\n");
+
+        std::remove(in_path.c_str());
+        std::remove(out_path.c_str());
+    }
+
+    printf("=== Benchmark Complete ===\n");
+    printf("\nNotes:\n");
+    printf("- Throughput is in frames; fps is sustained over a call of %zu frames\n", FRAMES_PER_CALL);
+    printf("- Latency runs from the start of a frame's load to the end of its store\n");
+    printf("- pipeline: FramePipeline with one filter worker (load, blur and store overlap)\n");
+    printf("- pipeline-Nw: N filter workers blurring different frames at once\n");
+
+    return harness.finish();
+}
@@ -0,0 +1,94 @@
+#include "ares/pixel_format.hpp"
+#include "ares/cpu_dispatch.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace ares;
+using namespace std::chrono;
+
+template<typename Func>
+double measure(Func func, int iterations = 10) {
+    auto start = high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        func();
+    }
+    auto end = high_resolution_clock::now();
+    auto duration = duration_cast<microseconds>(end - start).count();
+    return duration / static_cast<double>(iterations);
+}
+
+struct FormatCase {
+    PixelFormat format;
+    const char* name;
+};
+
+static const FormatCase formats[] = {
+    { PixelFormat::RGBA_U8,    "rgba-u8" },
+    { PixelFormat::RGB_U8,     "rgb-u8" },
+    { PixelFormat::Planar_F32, "planar-f32" },
+    { PixelFormat::RGBA_F16,   "rgba-f16" },
+};
+
+void benchmark_conversions(size_t width, size_t height) {
+    const size_t pixels = width * height;
+    std::vector<float> image(pixels * 4);
+    for (size_t i = 0; i < image.size(); ++i) {
+        image[i] = static_cast<float>(i % 1000) / 999.0f;
+    }
+    std::vector<uint8_t> packed(pixels * 4 * sizeof(float));
+    std::vector<float> back(pixels * 4);
+    
+    // Rate in terms of the float RGBA side
+    double mb = pixels * 4 * sizeof(float) / (1024.0 * 1024.0);
+    auto mbps = [&](double us) { return mb / (us / 1000000.0); };
+    const IsaLevel detected = detected_isa_level();
+    
+    for (const FormatCase& fc : formats) {
+        double from_base = measure([&]() {
+            convert_from_rgba_f32_baseline(image.data(), packed.data(), fc.format, width, height);
+        });
+        double to_base = measure([&]() {
+            convert_to_rgba_f32_baseline(packed.data(), fc.format, back.data(), width, height);
+        });
+        printf("  %-10s baseline     from %8.2f μs (%7.0f MB/s)  to %8.2f μs (%7.0f MB/s)\n",
+               fc.name, from_base, mbps(from_base), to_base, mbps(to_base));
+        
+        for (int l = static_cast<int>(IsaLevel::SSE42); l <= static_cast<int>(detected); ++l) {
+            IsaLevel level = set_isa_level(static_cast<IsaLevel>(l));
+            double from_simd = measure([&]() {
+                convert_from_rgba_f32(image.data(), packed.data(), fc.format, width, height);
+            });
+            double to_simd = measure([&]() {
+                convert_to_rgba_f32(packed.data(), fc.format, back.data(), width, height);
+            });
+            // Level, and the kernel set it maps to when they differ
+            const char* kernel = active_pixel_convert_kernel();
+            const bool same = std::strcmp(isa_level_name(level), kernel) == 0;
+            char label[32];
+            std::snprintf(label, sizeof(label), "%s%s%s", isa_level_name(level),
+                          same ? "" : "->", same ? "" : kernel);
+            printf("  %-10s %-12s from %8.2f μs (%5.1fx)         to %8.2f μs (%5.1fx)\n",
+                   fc.name, label,
+                   from_simd, from_base / from_simd, to_simd, to_base / to_simd);
+        }
+        set_isa_level(detected);
+    }
+}
+
+int main() {
+    printf("=== ARES Pixel Format Conversion Benchmarks ===\n\n");
+    printf("Format: Time per frame (float RGBA MB/s) | Speedup vs baseline\n");
+    printf("Frames of 1 Mpixel or more use the shared worker pool\n\n");
+    
+    printf("Image Size: 640 x 480\n");
+    benchmark_conversions(640, 480);
+    
+    printf("\nImage Size: 3840 x 2160 (4K)\n");
+    benchmark_conversions(3840, 2160);
+    
+    printf("\n=== Benchmark Complete ===\n");
+    return 0;
+}
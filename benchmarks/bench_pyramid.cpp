@@ -0,0 +1,98 @@
+#include "ares/gaussian_blur.hpp"
+#include "ares/gaussian_pyramid.hpp"
+#include "bench_harness.hpp"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace ares;
+
+constexpr size_t PYRAMID_LEVELS = 6;
+constexpr float PYRAMID_SIGMA = 1.0f;
+
+// Today's API: blur each level at full resolution, then keep every other
+// row and column. Buffers are allocated up front, so only the work differs.
+struct NaivePyramid {
+    std::vector<Image> blurred;
+    std::vector<Image> levels;
+
+    explicit NaivePyramid(const Image& base) {
+        size_t w = base.width, h = base.height;
+        for (size_t n = 1; n < PYRAMID_LEVELS; ++n) {
+            blurred.emplace_back(w, h);
+            w = (w + 1) / 2;
+            h = (h + 1) / 2;
+            levels.emplace_back(w, h);
+        }
+    }
+
+    void build(const Image& base) {
+        const Image* src = &base;
+        for (size_t n = 0; n + 1 < PYRAMID_LEVELS; ++n) {
+            gaussian_blur_simd(*src, blurred[n], PYRAMID_SIGMA);
+            Image& dst = levels[n];
+            for (size_t y = 0; y < dst.height; ++y) {
+                const float* row = blurred[n].data + 2 * y * src->width * 4;
+                for (size_t x = 0; x < dst.width; ++x) {
+                    std::memcpy(dst.data + (y * dst.width + x) * 4, row + 2 * x * 4, 4 * sizeof(float));
+                }
+            }
+            src = &dst;
+        }
+    }
+};
+
+void benchmark_pyramid(bench::Harness& harness, size_t width, size_t height) {
+    const std::string label = std::to_string(width) + "x" + std::to_string(height);
+    // Every level is read once, in pixels of the base
+    const double pixels = static_cast<double>(width * height);
+    const double bytes = pixels * 4 * sizeof(float);
+
+    Image base(width, height);
+    for (size_t i = 0; i < width * height * 4; ++i) {
+        base.data[i] = std::sin(i * 0.001f) * 0.5f + 0.5f;
+    }
+
+    NaivePyramid naive(base);
+    harness.run({ "pyramid", "baseline", label, bytes, pixels, true, "px" },
+                [&]() { naive.build(base); });
+
+    GaussianPyramid pyramid;
+    pyramid.build(base, PYRAMID_LEVELS, PYRAMID_SIGMA);  // sizes the arena
+    harness.run({ "pyramid", "fused", label, bytes, pixels, true, "px" },
+                [&]() { pyramid.build(base, PYRAMID_LEVELS, PYRAMID_SIGMA); });
+    printf("    arena: %.1f MB for %zu levels\n", pyramid.arena_bytes() / (1024.0 * 1024.0), pyramid.levels());
+
+    // Fresh object per call: includes the arena allocation and page faults
+    harness.run({ "pyramid", "fused-cold", label, bytes, pixels, true, "px" }, [&]() {
+        GaussianPyramid cold;
+        cold.build(base, PYRAMID_LEVELS, PYRAMID_SIGMA);
+    });
+}
+
+int main(int argc, char** argv) {
+    bench::Harness harness("pyramid", argc, argv);
+
+    printf("=== ARES Gaussian Pyramid Benchmarks ===\n\n");
+    printf("Baseline: gaussian_blur_simd per level, then 2x decimation (%zu levels, sigma=%.1f)\n",
+           PYRAMID_LEVELS, PYRAMID_SIGMA);
+    harness.print_context();
+    printf("\n");
+
+    const size_t sizes[][2] = { { 1920, 1080 }, { 3840, 2160 } };
+    for (const auto& size : sizes) {
+        printf("Pyramid: %zux%zu\n", size[0], size[1]);
+        benchmark_pyramid(harness, size[0], size[1]);
+        printf("\n");
+    }
+
+    printf("=== Benchmark Complete ===\n");
+    printf("\nNotes:\n");
+    printf("- Times are per pyramid; throughput counts base-level pixels\n");
+    printf("- fused: GaussianPyramid::build() reusing its arena\n");
+    printf("- fused-cold: new GaussianPyramid per call (arena allocated each time)\n");
+
+    return harness.finish();
+}
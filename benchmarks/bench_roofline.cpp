@@ -0,0 +1,347 @@
+#include "ares/gaussian_blur.hpp"
+#include "ares/cpu_dispatch.hpp"
+#include "bench_harness.hpp"
+#include "roofline_kernels.hpp"
+#include <immintrin.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ares;
+
+// Roofline characterization of the blur variants:
+//   1. memory roof: STREAM-style read / write / copy / triad bandwidth
+//   2. compute ceilings: peak multiply-add throughput per ISA level
+//   3. each gaussian_blur_* variant and sigma placed against them
+//
+// Traffic is counted the STREAM way (bytes the code reads plus bytes it
+// writes, no write-allocate), so the copy bandwidth is the matching roof
+// for the blur, which also reads and writes in equal amounts.
+
+namespace {
+
+// Arrays far larger than any last-level cache
+constexpr size_t STREAM_FLOATS = size_t(16) << 20;  // 64 MiB per array
+constexpr size_t FMA_ITERATIONS = size_t(1) << 20;
+constexpr size_t IMAGE_WIDTH = 3840;
+constexpr size_t IMAGE_HEIGHT = 2160;
+
+volatile float g_sink;
+
+// Run fn(begin, end) over [0, n) split across `threads` std::threads
+template<typename Fn>
+void parallel_ranges(unsigned int threads, size_t n, Fn fn) {
+    if (threads <= 1) {
+        fn(size_t(0), n);
+        return;
+    }
+    std::vector<std::thread> workers;
+    const size_t chunk = (n + threads - 1) / threads;
+    for (unsigned int t = 0; t < threads; ++t) {
+        const size_t begin = std::min(n, t * chunk);
+        const size_t end = std::min(n, begin + chunk);
+        workers.emplace_back([=] { fn(begin, end); });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+}
+
+struct StreamArrays {
+    float* a;
+    float* b;
+    float* c;
+
+    explicit StreamArrays(unsigned int threads) {
+        a = static_cast<float*>(_mm_malloc(STREAM_FLOATS * sizeof(float), 64));
+        b = static_cast<float*>(_mm_malloc(STREAM_FLOATS * sizeof(float), 64));
+        c = static_cast<float*>(_mm_malloc(STREAM_FLOATS * sizeof(float), 64));
+        // Touch pages from the threads that will use them
+        parallel_ranges(threads, STREAM_FLOATS, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                a[i] = 1.0f;
+                b[i] = 2.0f;
+                c[i] = 0.0f;
+            }
+        });
+    }
+    ~StreamArrays() {
+        _mm_free(a);
+        _mm_free(b);
+        _mm_free(c);
+    }
+    StreamArrays(const StreamArrays&) = delete;
+    StreamArrays& operator=(const StreamArrays&) = delete;
+};
+
+std::string thread_label(unsigned int threads) {
+    return std::to_string(threads) + (threads == 1 ? " thread" : " threads");
+}
+
+// Returns copy bandwidth in bytes/s (0 if filtered out)
+double benchmark_stream(bench::Harness& harness, unsigned int threads) {
+    StreamArrays s(threads);
+    const std::string size = thread_label(threads);
+    const double bytes = static_cast<double>(STREAM_FLOATS * sizeof(float));
+    const bool mt = threads > 1;
+
+    harness.run({ "stream", "read", size, bytes, 0.0, mt }, [&]() {
+        std::vector<float> partial(threads);
+        parallel_ranges(threads, STREAM_FLOATS, [&](size_t begin, size_t end) {
+            float sum = 0.0f;
+            for (size_t i = begin; i < end; ++i) {
+                sum += s.a[i];
+            }
+            partial[begin / ((STREAM_FLOATS + threads - 1) / threads)] = sum;
+        });
+        g_sink = partial[0];
+    });
+
+    harness.run({ "stream", "write", size, bytes, 0.0, mt }, [&]() {
+        parallel_ranges(threads, STREAM_FLOATS, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                s.c[i] = 3.0f;
+            }
+        });
+    });
+
+    bench::Result* copy = harness.run({ "stream", "copy", size, 2 * bytes, 0.0, mt }, [&]() {
+        parallel_ranges(threads, STREAM_FLOATS, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                s.c[i] = s.a[i];
+            }
+        });
+    });
+
+    harness.run({ "stream", "triad", size, 3 * bytes, 0.0, mt }, [&]() {
+        parallel_ranges(threads, STREAM_FLOATS, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                s.a[i] = s.b[i] + 3.0f * s.c[i];
+            }
+        });
+    });
+
+    return copy ? copy->bytes_per_second() : 0.0;
+}
+
+struct ComputeCeilings {
+    double sse2 = 0.0;    // FLOP/s, no FMA, 4 lanes
+    double avx2 = 0.0;    // FMA3, 8 lanes
+    double avx512 = 0.0;  // FMA, 16 lanes
+
+    double widest() const { return std::max({ sse2, avx2, avx512 }); }
+};
+
+ComputeCeilings benchmark_fma(bench::Harness& harness, unsigned int threads) {
+    ComputeCeilings ceilings;
+    const std::string size = thread_label(threads);
+    const bool mt = threads > 1;
+
+    auto peak = [&](const char* variant, int lanes, float (*loop)(size_t)) {
+        const double flops = 2.0 * bench::ROOFLINE_CHAINS * lanes *
+                             static_cast<double>(FMA_ITERATIONS) * threads;
+        bench::Result* r = harness.run({ "fma", variant, size, 0.0, flops, mt, "flop" }, [&]() {
+            parallel_ranges(threads, threads, [&](size_t, size_t) {
+                g_sink = loop(FMA_ITERATIONS);
+            });
+        });
+        return r ? r->items_per_second() : 0.0;
+    };
+
+    const IsaLevel detected = detected_isa_level();
+    ceilings.sse2 = peak("sse2", 4, bench::fma_loop_sse2);
+    if (detected >= IsaLevel::AVX2) {
+        ceilings.avx2 = peak("avx2", 8, bench::fma_loop_avx2);
+    }
+#ifdef ARES_ENABLE_AVX512
+    if (detected >= IsaLevel::AVX512) {
+        ceilings.avx512 = peak("avx512", 16, bench::fma_loop_avx512);
+    }
+#endif
+    return ceilings;
+}
+
+struct Roof {
+    double bandwidth = 0.0;  // bytes/s
+    double compute = 0.0;    // FLOP/s
+};
+
+// Attach the roofline metrics to one blur result
+void add_roofline_metrics(bench::Result* r, double flops, double bytes, const Roof& roof) {
+    if (!r) {
+        return;
+    }
+    const double intensity = flops / bytes;
+    const double achieved = flops / (r->median_us * 1e-6);
+    const double memory_bound = intensity * roof.bandwidth;
+    const double bound = std::min(roof.compute, memory_bound);
+    r->metrics = {
+        { "flops", flops },
+        { "model_bytes", bytes },
+        { "arithmetic_intensity", intensity },
+        { "gflops", achieved * 1e-9 },
+        { "compute_ceiling_gflops", roof.compute * 1e-9 },
+        { "bandwidth_gbs", roof.bandwidth * 1e-9 },
+        { "roof_gflops", bound * 1e-9 },
+        { "roof_fraction", bound > 0 ? achieved / bound : 0.0 },
+        { "compute_bound", memory_bound >= roof.compute ? 1.0 : 0.0 },
+    };
+}
+
+struct RooflineRow {
+    std::string variant;
+    float sigma;
+    const bench::Result* r;
+};
+
+void benchmark_blur(bench::Harness& harness, float sigma,
+                    const Roof& scalar_roof, const Roof& sse_roof, const Roof& avx2_roof,
+                    const Roof& widest_roof, const Roof& all_cores_roof,
+                    std::vector<RooflineRow>& rows) {
+    Image input(IMAGE_WIDTH, IMAGE_HEIGHT);
+    Image output(IMAGE_WIDTH, IMAGE_HEIGHT);
+    for (size_t i = 0; i < IMAGE_WIDTH * IMAGE_HEIGHT * 4; ++i) {
+        input.data[i] = static_cast<float>(i % 251) / 250.0f;
+    }
+
+    // Model shared by all variants: a separable pass pair, every tap a
+    // multiply-add on 4 channels; traffic is input + temp write + temp
+    // read + output, 16 bytes each per pixel
+    const int radius = static_cast<int>(std::ceil(3.0f * sigma));
+    const double taps = 2.0 * radius + 1.0;
+    const double pixels = static_cast<double>(IMAGE_WIDTH * IMAGE_HEIGHT);
+    const double flops = pixels * 2.0 * 4.0 * taps * 2.0;
+    const double bytes = pixels * 64.0;
+    // The tiled temp also holds the radius apron rows above and below
+    const double tiled_bytes = bytes + 32.0 * (2.0 * radius) * IMAGE_WIDTH;
+
+    char group[32];
+    std::snprintf(group, sizeof(group), "blur-sigma%g", sigma);
+    const std::string size = std::to_string(IMAGE_WIDTH) + "x" + std::to_string(IMAGE_HEIGHT);
+    const double image_bytes = pixels * 4 * sizeof(float);
+
+    auto run = [&](const std::string& variant, bool mt, double model_bytes, const Roof& roof,
+                   auto&& fn) {
+        bench::Result* r = harness.run({ group, variant, size, image_bytes, pixels, mt, "px" }, fn);
+        add_roofline_metrics(r, flops, model_bytes, roof);
+        if (r) {
+            rows.push_back({ variant, sigma, r });
+        }
+    };
+
+    // Built without -m flags: scalar or SSE2 at best
+    run("baseline", false, bytes, scalar_roof, [&]() {
+        gaussian_blur_baseline(input, output, sigma);
+    });
+
+    const IsaLevel detected = detected_isa_level();
+    for (int l = static_cast<int>(IsaLevel::SSE42); l <= static_cast<int>(detected); ++l) {
+        IsaLevel level = set_isa_level(static_cast<IsaLevel>(l));
+        const Roof& roof = level == IsaLevel::SSE42 ? sse_roof
+                         : level == IsaLevel::AVX2 ? avx2_roof : widest_roof;
+        run(std::string("simd-") + isa_level_name(level), false, bytes, roof, [&]() {
+            gaussian_blur_simd(input, output, sigma);
+        });
+    }
+    set_isa_level(detected);
+
+    run("tiled", false, tiled_bytes, widest_roof, [&]() {
+        gaussian_blur_tiled(input, output, sigma);
+    });
+    run("multithreaded", true, bytes, all_cores_roof, [&]() {
+        gaussian_blur_multithreaded(input, output, sigma);
+    });
+    if (has_avx512_support()) {
+        run("avx512", false, bytes, widest_roof, [&]() {
+            gaussian_blur_avx512(input, output, sigma);
+        });
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    bench::Harness harness("roofline", argc, argv);
+    const unsigned int threads = std::max(1u, std::thread::hardware_concurrency());
+
+    printf("=== ARES Roofline Characterization ===\n\n");
+    harness.print_context();
+
+    printf("Memory bandwidth (STREAM-style, %zu MiB arrays)\n", STREAM_FLOATS * sizeof(float) >> 20);
+    const double bw_1 = benchmark_stream(harness, 1);
+    double bw_n = bw_1;
+    if (threads > 1) {
+        bw_n = benchmark_stream(harness, threads);
+    }
+
+    printf("\nCompute peak (%d independent multiply-add chains)\n", bench::ROOFLINE_CHAINS);
+    const ComputeCeilings peak_1 = benchmark_fma(harness, 1);
+    ComputeCeilings peak_n = peak_1;
+    if (threads > 1) {
+        peak_n = benchmark_fma(harness, threads);
+    }
+
+    harness.add_context("bandwidth_gbs", bw_1 * 1e-9);
+    harness.add_context("bandwidth_all_cores_gbs", bw_n * 1e-9);
+    harness.add_context("peak_gflops_sse2", peak_1.sse2 * 1e-9);
+    harness.add_context("peak_gflops_avx2", peak_1.avx2 * 1e-9);
+    harness.add_context("peak_gflops_avx512", peak_1.avx512 * 1e-9);
+    harness.add_context("peak_gflops_all_cores", peak_n.widest() * 1e-9);
+
+    // Ceilings per variant: the ISA its inner loops are built for, and
+    // every core for the multithreaded one
+    // (the baseline is plain C++ built for baseline x86-64: one lane)
+    const Roof scalar_roof{ bw_1, peak_1.sse2 / 4 };
+    const Roof sse_roof{ bw_1, peak_1.sse2 };
+    const Roof avx2_roof{ bw_1, peak_1.avx2 > 0 ? peak_1.avx2 : peak_1.sse2 };
+    const Roof widest_roof{ bw_1, peak_1.widest() };
+    const Roof all_cores_roof{ bw_n, peak_n.widest() };
+
+    std::vector<RooflineRow> rows;
+    const float sigmas[] = { 1.0f, 2.0f, 4.0f };
+    for (float sigma : sigmas) {
+        printf("\nGaussian blur %zux%zu, sigma=%g\n", IMAGE_WIDTH, IMAGE_HEIGHT, sigma);
+        benchmark_blur(harness, sigma, scalar_roof, sse_roof, avx2_roof,
+                       widest_roof, all_cores_roof, rows);
+    }
+
+    printf("\n=== Roofline ===\n");
+    printf("Memory roof: copy %.1f GB/s (1 thread)", bw_1 * 1e-9);
+    if (threads > 1) {
+        printf(", %.1f GB/s (%u threads)", bw_n * 1e-9, threads);
+    }
+    printf("\nCompute ceilings (1 thread): sse2 %.1f, avx2 %.1f, avx512 %.1f GFLOP/s",
+           peak_1.sse2 * 1e-9, peak_1.avx2 * 1e-9, peak_1.avx512 * 1e-9);
+    if (threads > 1) {
+        printf("; all cores %.1f", peak_n.widest() * 1e-9);
+    }
+    printf("\n");
+    if (bw_1 > 0) {
+        printf("Ridge point (widest ISA, 1 thread): %.1f FLOP/B\n\n", peak_1.widest() / bw_1);
+    }
+    printf("  %-16s %5s  %9s  %9s  %9s  %6s  %s\n",
+           "variant", "sigma", "FLOP/B", "GFLOP/s", "roof", "%roof", "bound by");
+    for (const RooflineRow& row : rows) {
+        auto metric = [&](const char* key) {
+            for (const auto& m : row.r->metrics) {
+                if (m.first == key) return m.second;
+            }
+            return 0.0;
+        };
+        printf("  %-16s %5g  %9.2f  %9.2f  %9.2f  %5.1f%%  %s\n",
+               row.variant.c_str(), row.sigma, metric("arithmetic_intensity"), metric("gflops"),
+               metric("roof_gflops"), 100.0 * metric("roof_fraction"),
+               metric("compute_bound") > 0 ? "compute" : "memory");
+    }
+
+    printf("\nNotes:\n");
+    printf("- FLOPs: 2 passes x 4 channels x (2r+1) taps x multiply-add per pixel\n");
+    printf("- Bytes: input + temp write + temp read + output, 16 B/pixel each\n");
+    printf("- Far below the roof: latency or overhead bound, worth optimizing\n");
+    printf("- Near a memory roof: only less traffic (fusion, fewer passes) helps\n");
+
+    return harness.finish();
+}
@@ -0,0 +1,92 @@
+#include "ares/gaussian_blur.hpp"
+#include "ares/gaussian_scale_space.hpp"
+#include "bench_harness.hpp"
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace ares;
+
+// Octave of sigmas, sigma0 * 2^(i / 3) from sigma0 = 1.6 (SIFT-style)
+static std::vector<float> octave_sigmas(size_t count) {
+    std::vector<float> sigmas;
+    for (size_t i = 0; i < count; ++i) {
+        sigmas.push_back(1.6f * std::pow(2.0f, static_cast<float>(i) / 3.0f));
+    }
+    return sigmas;
+}
+
+void benchmark_scales(bench::Harness& harness, size_t width, size_t height, size_t count) {
+    const std::string label = std::to_string(width) + "x" + std::to_string(height) +
+                              " x" + std::to_string(count);
+    const double pixels = static_cast<double>(width * height);
+    const std::vector<float> sigmas = octave_sigmas(count);
+
+    Image input(width, height);
+    for (size_t i = 0; i < width * height * 4; ++i) {
+        input.data[i] = std::sin(i * 0.001f) * 0.5f + 0.5f;
+    }
+    std::vector<std::unique_ptr<Image>> images;
+    std::vector<Image*> outputs;
+    for (size_t i = 0; i < count; ++i) {
+        images.push_back(std::make_unique<Image>(width, height));
+        outputs.push_back(images.back().get());
+    }
+
+    // Bytes the separate calls move: per sigma one input read, one output
+    // write (temps excluded)
+    const double bytes = pixels * 4 * sizeof(float) * 2 * count;
+
+    harness.run({ "scale-space", "baseline", label, bytes, pixels, true, "px" }, [&]() {
+        for (size_t i = 0; i < count; ++i) {
+            gaussian_blur_tiled(input, *outputs[i], sigmas[i]);
+        }
+    });
+    harness.run({ "scale-space", "multi", label, bytes, pixels, true, "px" },
+                [&]() { gaussian_blur_multi(input, outputs, sigmas); });
+
+    // DoG: separate blurs, then one subtraction pass per pair
+    harness.run({ "scale-space", "dog-separate", label, bytes, pixels, true, "px" }, [&]() {
+        for (size_t i = 0; i < count; ++i) {
+            gaussian_blur_tiled(input, *outputs[i], sigmas[i]);
+        }
+        for (size_t i = 0; i + 1 < count; ++i) {
+            float* lower = outputs[i]->data;
+            const float* upper = outputs[i + 1]->data;
+            for (size_t p = 0; p < width * height * 4; ++p) {
+                lower[p] = upper[p] - lower[p];
+            }
+        }
+    });
+    harness.run({ "scale-space", "dog-fused", label, bytes, pixels, true, "px" }, [&]() {
+        difference_of_gaussians(input, std::span<Image* const>(outputs.data(), count - 1), sigmas);
+    });
+}
+
+int main(int argc, char** argv) {
+    bench::Harness harness("scale_space", argc, argv);
+
+    printf("=== ARES Scale Space Benchmarks ===\n\n");
+    printf("Baseline: one gaussian_blur_tiled call per sigma (sigma = 1.6 * 2^(i/3))\n");
+    harness.print_context();
+    printf("\n");
+
+    const size_t sizes[][2] = { { 1920, 1080 }, { 3840, 2160 } };
+    for (const auto& size : sizes) {
+        for (size_t count : { 4, 8 }) {
+            printf("%zux%zu, %zu sigmas\n", size[0], size[1], count);
+            benchmark_scales(harness, size[0], size[1], count);
+            printf("\n");
+        }
+    }
+
+    printf("=== Benchmark Complete ===\n");
+    printf("\nNotes:\n");
+    printf("- Throughput counts the bytes the separate calls would move\n");
+    printf("- multi: gaussian_blur_multi(), each input row read once for all sigmas\n");
+    printf("- dog-*: count - 1 difference images; dog-fused never writes the blurs\n");
+
+    return harness.finish();
+}
@@ -0,0 +1,85 @@
+#include "ares/gaussian_blur.hpp"
+#include "ares/gaussian_sharpen.hpp"
+#include "bench_harness.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <string>
+
+using namespace ares;
+
+static const float SHARPEN_SIGMA = 1.5f;
+static const float SHARPEN_AMOUNT = 0.8f;
+static const float SHARPEN_THRESHOLD = 0.02f;
+
+void benchmark_sharpen(bench::Harness& harness, size_t width, size_t height) {
+    const std::string label = std::to_string(width) + "x" + std::to_string(height);
+    const double pixels = static_cast<double>(width * height);
+    const size_t floats = width * height * 4;
+    // One input read and one output write
+    const double bytes = pixels * 4 * sizeof(float) * 2;
+
+    Image input(width, height);
+    for (size_t i = 0; i < floats; ++i) {
+        input.data[i] = std::sin(i * 0.001f) * 0.5f + 0.5f;
+    }
+    Image blurred(width, height);
+    Image output(width, height);
+
+    // Blur, then subtract, scale and clamp as separate passes over the image
+    harness.run({ "sharpen", "baseline", label, bytes, pixels, false, "px" }, [&]() {
+        gaussian_blur_tiled(input, blurred, SHARPEN_SIGMA);
+        float* detail = blurred.data;
+        for (size_t i = 0; i < floats; ++i) {
+            detail[i] = input.data[i] - detail[i];
+        }
+        for (size_t i = 0; i < floats; ++i) {
+            const bool sharpen = i % 4 != 3 && std::fabs(detail[i]) >= SHARPEN_THRESHOLD;
+            output.data[i] = input.data[i] + (sharpen ? SHARPEN_AMOUNT * detail[i] : 0.0f);
+        }
+        for (size_t i = 0; i < floats; ++i) {
+            output.data[i] = std::clamp(output.data[i], 0.0f, 1.0f);
+        }
+    });
+
+    // Blur, then one combined pass
+    harness.run({ "sharpen", "blur+1pass", label, bytes, pixels, false, "px" }, [&]() {
+        gaussian_blur_tiled(input, blurred, SHARPEN_SIGMA);
+        for (size_t i = 0; i < floats; ++i) {
+            const float detail = input.data[i] - blurred.data[i];
+            const bool sharpen = i % 4 != 3 && std::fabs(detail) >= SHARPEN_THRESHOLD;
+            output.data[i] = std::clamp(input.data[i] + (sharpen ? SHARPEN_AMOUNT * detail : 0.0f), 0.0f, 1.0f);
+        }
+    });
+
+    // The blur on its own: the floor for the fused kernel
+    harness.run({ "sharpen", "blur-only", label, bytes, pixels, false, "px" },
+                [&]() { gaussian_blur_tiled(input, output, SHARPEN_SIGMA); });
+
+    harness.run({ "sharpen", "fused", label, bytes, pixels, true, "px" },
+                [&]() { unsharp_mask(input, output, SHARPEN_SIGMA, SHARPEN_AMOUNT, SHARPEN_THRESHOLD); });
+}
+
+int main(int argc, char** argv) {
+    bench::Harness harness("sharpen", argc, argv);
+
+    printf("=== ARES Sharpen Benchmarks ===\n\n");
+    printf("Baseline: gaussian_blur_tiled, then subtract, scale and clamp passes "
+           "(sigma=%.1f, amount=%.1f, threshold=%.2f)\n", SHARPEN_SIGMA, SHARPEN_AMOUNT, SHARPEN_THRESHOLD);
+    harness.print_context();
+    printf("\n");
+
+    const size_t sizes[][2] = { { 1920, 1080 }, { 3840, 2160 }, { 7680, 4320 } };
+    for (const auto& size : sizes) {
+        printf("Image: %zux%zu\n", size[0], size[1]);
+        benchmark_sharpen(harness, size[0], size[1]);
+        printf("\n");
+    }
+
+    printf("=== Benchmark Complete ===\n");
+    printf("\nNotes:\n");
+    printf("- fused: unsharp_mask(), the arithmetic in the vertical pass epilogue\n");
+    printf("- Throughput counts one input read and one output write per pixel\n");
+
+    return harness.finish();
+}
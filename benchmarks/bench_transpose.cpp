@@ -0,0 +1,61 @@
+#include "ares/gaussian_blur.hpp"
+#include "bench_harness.hpp"
+#include <cmath>
+#include <cstdio>
+#include <string>
+
+using namespace ares;
+
+void benchmark_vertical_strategy(bench::Harness& harness, size_t width, size_t height, float sigma) {
+    char label[64];
+    snprintf(label, sizeof(label), "%zux%zu s%g", width, height, sigma);
+    const double pixels = static_cast<double>(width * height);
+    const size_t floats = width * height * 4;
+    // One input read and one output write
+    const double bytes = pixels * 4 * sizeof(float) * 2;
+
+    Image input(width, height);
+    for (size_t i = 0; i < floats; ++i) {
+        input.data[i] = std::sin(i * 0.001f) * 0.5f + 0.5f;
+    }
+    Image output(width, height);
+    printf(" sigma=%g\n", sigma);
+
+    // Direct vertical convolution, tiled
+    harness.run({ "vertical", "baseline", label, bytes, pixels, false, "px" },
+                [&]() { gaussian_blur_tiled(input, output, sigma); });
+
+    // Direct vertical convolution over the whole image
+    harness.run({ "vertical", "direct", label, bytes, pixels, false, "px" },
+                [&]() { gaussian_blur_simd(input, output, sigma); });
+
+    harness.run({ "vertical", "transposed", label, bytes, pixels, false, "px" },
+                [&]() { gaussian_blur_transposed(input, output, sigma); });
+}
+
+int main(int argc, char** argv) {
+    bench::Harness harness("transpose", argc, argv);
+
+    printf("=== ARES Transposed Vertical Pass Benchmarks ===\n\n");
+    printf("Baseline: gaussian_blur_tiled (direct vertical convolution)\n");
+    harness.print_context();
+    printf("\n");
+
+    const size_t sizes[][2] = { { 512, 512 }, { 1920, 1080 }, { 3840, 2160 }, { 7680, 4320 } };
+    const float sigmas[] = { 1.0f, 3.0f, 8.0f };
+    for (const auto& size : sizes) {
+        printf("Image: %zux%zu\n", size[0], size[1]);
+        for (float sigma : sigmas) {
+            benchmark_vertical_strategy(harness, size[0], size[1], sigma);
+        }
+        printf("\n");
+    }
+
+    printf("=== Benchmark Complete ===\n");
+    printf("\nNotes:\n");
+    printf("- direct: gaussian_blur_simd, untiled horizontal then vertical pass\n");
+    printf("- transposed: vertical taps run by the horizontal kernel on transposed L2 tiles\n");
+    printf("- Throughput counts one input read and one output write per pixel\n");
+
+    return harness.finish();
+}
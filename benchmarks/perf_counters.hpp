@@ -0,0 +1,232 @@
+#pragma once
+
+// Hardware performance counters for the benchmarks, read through Linux
+// perf_event_open(2). Every event is opened on its own so that a missing
+// one (no PMU in a VM, cache events unsupported, perf_event_paranoid, a
+// seccomp filter in a container) only drops that event. Counts cover the
+// calling thread, user space only, and are scaled when the kernel had to
+// multiplex them.
+//
+//   PerfCounters counters;
+//   if (counters.open()) {
+//       CounterValues v = counters.measure([&] { kernel(...); });
+//       if (v.has(Counter::Cycles)) ...
+//   }
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace ares {
+namespace bench {
+
+enum class Counter {
+    Cycles,
+    Instructions,
+    CacheReferences,   ///< Last-level cache accesses
+    CacheMisses,       ///< Last-level cache misses
+    BranchMisses,
+    L1DReadMisses,
+    TaskClock,         ///< Software: nanoseconds on the CPU
+    PageFaults,        ///< Software
+};
+
+constexpr int COUNTER_COUNT = 8;
+
+inline const char* counter_name(Counter c) {
+    switch (c) {
+        case Counter::Cycles:          return "cycles";
+        case Counter::Instructions:    return "instructions";
+        case Counter::CacheReferences: return "cache_references";
+        case Counter::CacheMisses:     return "cache_misses";
+        case Counter::BranchMisses:    return "branch_misses";
+        case Counter::L1DReadMisses:   return "l1d_read_misses";
+        case Counter::TaskClock:       return "task_clock_ns";
+        case Counter::PageFaults:      return "page_faults";
+    }
+    return "unknown";
+}
+
+/**
+ * Counter readings; events that could not be opened are absent.
+ */
+struct CounterValues {
+    double value[COUNTER_COUNT] = {};
+    bool valid[COUNTER_COUNT] = {};
+
+    bool has(Counter c) const { return valid[static_cast<int>(c)]; }
+    double operator[](Counter c) const { return value[static_cast<int>(c)]; }
+
+    bool any() const {
+        for (bool v : valid) {
+            if (v) return true;
+        }
+        return false;
+    }
+
+    bool any_hardware() const {
+        return has(Counter::Cycles) || has(Counter::Instructions) ||
+               has(Counter::CacheReferences) || has(Counter::CacheMisses) ||
+               has(Counter::BranchMisses) || has(Counter::L1DReadMisses);
+    }
+
+    // Values per call when `calls` calls were measured together
+    CounterValues per_call(size_t calls) const {
+        CounterValues r = *this;
+        for (double& v : r.value) {
+            v /= static_cast<double>(calls);
+        }
+        return r;
+    }
+};
+
+class PerfCounters {
+public:
+    PerfCounters() {
+        for (int& fd : fds_) {
+            fd = -1;
+        }
+    }
+    ~PerfCounters() { close(); }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    /**
+     * Open every event the kernel allows. Returns true if at least one
+     * is available; status() explains what is missing.
+     */
+    bool open() {
+        close();
+#if defined(__linux__)
+        const uint64_t l1d_read_miss = PERF_COUNT_HW_CACHE_L1D |
+                                       (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                       (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        const struct { uint32_t type; uint64_t config; } events[COUNTER_COUNT] = {
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+            { PERF_TYPE_HW_CACHE, l1d_read_miss },
+            { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK },
+            { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS },
+        };
+
+        int first_error = 0;
+        for (int i = 0; i < COUNTER_COUNT; ++i) {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = events[i].type;
+            attr.config = events[i].config;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;  // allowed with perf_event_paranoid <= 2
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            fds_[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+            if (fds_[i] < 0 && first_error == 0) {
+                first_error = errno;
+            }
+        }
+
+        CounterValues probe;
+        for (int i = 0; i < COUNTER_COUNT; ++i) {
+            probe.valid[i] = fds_[i] >= 0;
+        }
+        if (!probe.any()) {
+            status_ = std::string("unavailable (perf_event_open: ") + std::strerror(first_error) + ")";
+        } else if (!probe.any_hardware()) {
+            status_ = std::string("software only, no hardware events (") + std::strerror(first_error) + ")";
+        } else {
+            status_.clear();
+            for (int i = 0; i < COUNTER_COUNT; ++i) {
+                if (probe.valid[i]) {
+                    status_ += status_.empty() ? "" : ", ";
+                    status_ += counter_name(static_cast<Counter>(i));
+                }
+            }
+        }
+        return probe.any();
+#else
+        status_ = "unavailable (perf_event_open is Linux only)";
+        return false;
+#endif
+    }
+
+    void close() {
+#if defined(__linux__)
+        for (int& fd : fds_) {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+            fd = -1;
+        }
+#endif
+    }
+
+    const std::string& status() const { return status_; }
+
+    void start() {
+#if defined(__linux__)
+        for (int fd : fds_) {
+            if (fd >= 0) {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+    }
+
+    CounterValues stop() {
+        CounterValues v;
+#if defined(__linux__)
+        for (int fd : fds_) {
+            if (fd >= 0) {
+                ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            }
+        }
+        for (int i = 0; i < COUNTER_COUNT; ++i) {
+            uint64_t data[3];  // value, time enabled, time running
+            if (fds_[i] < 0 || ::read(fds_[i], data, sizeof(data)) != sizeof(data)) {
+                continue;
+            }
+            if (data[2] == 0) {
+                continue;  // never scheduled on the PMU
+            }
+            v.value[i] = static_cast<double>(data[0]);
+            if (data[2] < data[1]) {
+                v.value[i] *= static_cast<double>(data[1]) / static_cast<double>(data[2]);
+            }
+            v.valid[i] = true;
+        }
+#endif
+        return v;
+    }
+
+    /**
+     * Count one call of fn()
+     */
+    template<typename Fn>
+    CounterValues measure(Fn&& fn) {
+        start();
+        fn();
+        return stop();
+    }
+
+private:
+    int fds_[COUNTER_COUNT];
+    std::string status_ = "not opened";
+};
+
+} // namespace bench
+} // namespace ares
@@ -0,0 +1,31 @@
+#include "roofline_kernels.hpp"
+#include <immintrin.h>
+
+// FMA3 on 256-bit vectors
+
+namespace ares {
+namespace bench {
+
+float fma_loop_avx2(size_t iterations) {
+    const __m256 m = _mm256_set1_ps(0.999999f);
+    const __m256 a = _mm256_set1_ps(1e-7f);
+    __m256 acc[ROOFLINE_CHAINS];
+    for (int c = 0; c < ROOFLINE_CHAINS; ++c) {
+        acc[c] = _mm256_set1_ps(1.0f + static_cast<float>(c));
+    }
+    for (size_t i = 0; i < iterations; ++i) {
+        for (int c = 0; c < ROOFLINE_CHAINS; ++c) {
+            acc[c] = _mm256_fmadd_ps(acc[c], m, a);
+        }
+    }
+    __m256 sum = acc[0];
+    for (int c = 1; c < ROOFLINE_CHAINS; ++c) {
+        sum = _mm256_add_ps(sum, acc[c]);
+    }
+    float lanes[8];
+    _mm256_storeu_ps(lanes, sum);
+    return lanes[0];
+}
+
+} // namespace bench
+} // namespace ares
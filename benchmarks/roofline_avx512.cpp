@@ -0,0 +1,31 @@
+#include "roofline_kernels.hpp"
+#include <immintrin.h>
+
+// FMA on 512-bit vectors
+
+namespace ares {
+namespace bench {
+
+float fma_loop_avx512(size_t iterations) {
+    const __m512 m = _mm512_set1_ps(0.999999f);
+    const __m512 a = _mm512_set1_ps(1e-7f);
+    __m512 acc[ROOFLINE_CHAINS];
+    for (int c = 0; c < ROOFLINE_CHAINS; ++c) {
+        acc[c] = _mm512_set1_ps(1.0f + static_cast<float>(c));
+    }
+    for (size_t i = 0; i < iterations; ++i) {
+        for (int c = 0; c < ROOFLINE_CHAINS; ++c) {
+            acc[c] = _mm512_fmadd_ps(acc[c], m, a);
+        }
+    }
+    __m512 sum = acc[0];
+    for (int c = 1; c < ROOFLINE_CHAINS; ++c) {
+        sum = _mm512_add_ps(sum, acc[c]);
+    }
+    float lanes[16];
+    _mm512_storeu_ps(lanes, sum);
+    return lanes[0];
+}
+
+} // namespace bench
+} // namespace ares
@@ -0,0 +1,25 @@
+#pragma once
+
+// Compute-peak loops for bench_roofline, one translation unit per ISA
+// level (roofline_*.cpp) like the library kernels. Each runs
+// ROOFLINE_CHAINS independent multiply-add chains so that the FMA ports,
+// not the dependency latency, are the limit.
+
+#include <cstddef>
+
+namespace ares {
+namespace bench {
+
+constexpr int ROOFLINE_CHAINS = 12;
+
+// Each returns a value derived from every chain so nothing is optimized
+// away. One iteration is ROOFLINE_CHAINS vector multiply-adds, i.e.
+// 2 * ROOFLINE_CHAINS * lanes FLOPs.
+float fma_loop_sse2(size_t iterations);    // 4 lanes, separate mul + add
+float fma_loop_avx2(size_t iterations);    // 8 lanes, FMA3
+#ifdef ARES_ENABLE_AVX512
+float fma_loop_avx512(size_t iterations);  // 16 lanes, FMA
+#endif
+
+} // namespace bench
+} // namespace ares
@@ -0,0 +1,31 @@
+#include "roofline_kernels.hpp"
+#include <emmintrin.h>
+
+// Baseline x86-64: no FMA, so each step is a multiply and a dependent add
+
+namespace ares {
+namespace bench {
+
+float fma_loop_sse2(size_t iterations) {
+    const __m128 m = _mm_set1_ps(0.999999f);
+    const __m128 a = _mm_set1_ps(1e-7f);
+    __m128 acc[ROOFLINE_CHAINS];
+    for (int c = 0; c < ROOFLINE_CHAINS; ++c) {
+        acc[c] = _mm_set1_ps(1.0f + static_cast<float>(c));
+    }
+    for (size_t i = 0; i < iterations; ++i) {
+        for (int c = 0; c < ROOFLINE_CHAINS; ++c) {
+            acc[c] = _mm_add_ps(_mm_mul_ps(acc[c], m), a);
+        }
+    }
+    __m128 sum = acc[0];
+    for (int c = 1; c < ROOFLINE_CHAINS; ++c) {
+        sum = _mm_add_ps(sum, acc[c]);
+    }
+    float lanes[4];
+    _mm_storeu_ps(lanes, sum);
+    return lanes[0];
+}
+
+} // namespace bench
+} // namespace ares
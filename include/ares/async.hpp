@@ -0,0 +1,244 @@
+#pragma once
+
+#include "gaussian_blur.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ares {
+
+/**
+ * @brief Where an asynchronous job is in its life
+ */
+enum class JobStatus {
+    Pending,    ///< Queued, no part of it started yet
+    Running,    ///< At least one part started
+    Completed,  ///< Every part ran; the output is complete
+    Cancelled,  ///< Cancelled before every part started; output is partial
+    Rejected    ///< Invalid arguments; nothing was written
+};
+
+/**
+ * @brief Entry of an executor's completion queue
+ */
+struct Completion {
+    uint64_t tag;      ///< Tag given at submission
+    JobStatus status;  ///< Completed, Cancelled or Rejected
+};
+
+namespace detail {
+struct AsyncJobState;
+struct AsyncItem {
+    std::shared_ptr<AsyncJobState> job;
+    size_t index;
+};
+} // namespace detail
+
+/**
+ * @brief Handle to a job submitted to an AsyncExecutor
+ *
+ * Copies refer to the same job. The job's buffers must stay valid until
+ * it is finished (done() is true), whether or not a handle is kept.
+ *
+ * A handle is also a C++20 awaitable: `co_await job` suspends the
+ * coroutine until the job finishes and yields its final JobStatus. The
+ * coroutine is resumed on the executor's dispatch thread (or at once if
+ * the job has already finished), so it should hand long work back to its
+ * own event loop.
+ */
+class AsyncJob {
+public:
+    AsyncJob() = default;
+
+    /**
+     * @brief false for a default-constructed handle
+     */
+    bool valid() const { return state_ != nullptr; }
+
+    uint64_t tag() const;
+    JobStatus status() const;
+
+    /**
+     * @brief Completed, Cancelled or Rejected
+     */
+    bool done() const;
+
+    /**
+     * @brief Block the calling thread until the job finishes
+     */
+    JobStatus wait() const;
+
+    /**
+     * @brief Skip the parts of the job that have not started
+     *
+     * Parts already running finish. The job ends Cancelled if any part
+     * was skipped, otherwise Completed.
+     *
+     * @return false if the job had already finished
+     */
+    bool cancel();
+
+    // Awaitable interface
+    bool await_ready() const { return done(); }
+    bool await_suspend(std::coroutine_handle<> continuation);
+    JobStatus await_resume() const { return status(); }
+
+private:
+    friend class AsyncExecutor;
+    explicit AsyncJob(std::shared_ptr<detail::AsyncJobState> state) : state_(std::move(state)) {}
+
+    std::shared_ptr<detail::AsyncJobState> state_;
+};
+
+struct AsyncExecutorOptions {
+    /// Post a Completion for every finished job, for poll_completions()
+    /// and wait_completions(). Leave off if nothing drains the queue.
+    bool completion_queue = false;
+};
+
+/**
+ * @brief Non-blocking submit / complete front-end for blur and AES jobs
+ *
+ * submit_*() splits a job into parts and appends them to a submission
+ * queue, then returns at once with a handle: blurs above 512x512 are cut
+ * into row bands (as in gaussian_blur_batch()), AES runs into ranges of
+ * 16384 blocks.
+ *
+ * The executor owns a single dispatch thread and no workers. It takes
+ * the oldest queued parts, two per pool thread, and runs them as one
+ * parallel_for() on the shared pool behind the multithreaded and batched
+ * blurs, with itself as the calling thread, then repeats. Parts are
+ * handed out in submission order, so many small jobs and a few large
+ * ones share the pool, and the process never runs more busy threads than
+ * cores. Rounds are short, so a blocking call that uses the pool waits
+ * for at most one round, and so does a part submitted while one runs.
+ * Each pool thread keeps its blur scratch across jobs.
+ *
+ * When a job's last part finishes, the job is marked finished, threads in
+ * AsyncJob::wait() are woken and, if the completion queue is enabled, a
+ * Completion with the job's tag is posted. An event loop can drain that
+ * queue with poll_completions() instead of dedicating a thread to each
+ * call. Awaiting coroutines are resumed once the round is over, outside
+ * the pool, so they may call the blocking entry points themselves.
+ *
+ * Destroying the executor skips every part that has not started (those
+ * jobs end Cancelled), waits for the running parts and joins the
+ * dispatch thread.
+ */
+class AsyncExecutor {
+public:
+    explicit AsyncExecutor(const AsyncExecutorOptions& options = {});
+    ~AsyncExecutor();
+
+    AsyncExecutor(const AsyncExecutor&) = delete;
+    AsyncExecutor& operator=(const AsyncExecutor&) = delete;
+
+    /**
+     * @brief Queue gaussian_blur_tiled(input, output, sigma, border)
+     *
+     * Rejected at once if the sizes differ or the image is empty.
+     * Output is bitwise identical to the blocking call.
+     */
+    AsyncJob submit_gaussian_blur(
+        const Image& input,
+        Image& output,
+        float sigma = 2.0f,
+        BorderMode border = BorderMode::Clamp,
+        uint64_t tag = 0
+    );
+
+    /**
+     * @brief Queue aes_encrypt_simd(plaintext, ciphertext, key, num_blocks)
+     *
+     * The key is copied at submission. Rejected at once if a pointer is
+     * null or num_blocks is 0.
+     */
+    AsyncJob submit_aes_encrypt(
+        const uint8_t* plaintext,
+        uint8_t* ciphertext,
+        const uint8_t* key,
+        size_t num_blocks,
+        uint64_t tag = 0
+    );
+
+    /**
+     * @brief Move up to `max` completions into `out` without blocking
+     *
+     * @return Number of completions written
+     */
+    size_t poll_completions(Completion* out, size_t max);
+
+    /**
+     * @brief poll_completions(), waiting up to `timeout` for the first one
+     */
+    size_t wait_completions(Completion* out, size_t max, std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Jobs submitted and not finished yet
+     */
+    size_t jobs_in_flight() const;
+
+    /**
+     * @brief Threads that run parts: the shared pool's workers plus the
+     *        dispatch thread
+     */
+    unsigned int workers() const;
+
+    /**
+     * @brief Process-wide executor (default options) behind the free
+     *        *_async() functions
+     */
+    static AsyncExecutor& shared();
+
+private:
+    AsyncJob enqueue(std::shared_ptr<detail::AsyncJobState> state, size_t parts);
+    void dispatch_loop();
+    void finish(detail::AsyncJobState& job, std::vector<std::coroutine_handle<>>& resume);
+    void post_completion(uint64_t tag, JobStatus status, bool counted);
+
+    bool completion_queue_enabled_;
+
+    // Submission queue
+    std::mutex submit_mutex_;
+    std::condition_variable work_ready_;
+    std::deque<detail::AsyncItem> submissions_;
+    std::atomic<bool> stop_{ false };  // set under submit_mutex_
+
+    std::thread dispatcher_;
+
+    // Completion queue
+    mutable std::mutex complete_mutex_;
+    std::condition_variable completion_ready_;
+    std::deque<Completion> completions_;
+    size_t in_flight_ = 0;
+};
+
+/**
+ * @brief AsyncExecutor::shared().submit_gaussian_blur()
+ */
+AsyncJob gaussian_blur_async(
+    const Image& input,
+    Image& output,
+    float sigma = 2.0f,
+    BorderMode border = BorderMode::Clamp
+);
+
+/**
+ * @brief AsyncExecutor::shared().submit_aes_encrypt()
+ */
+AsyncJob aes_encrypt_async(
+    const uint8_t* plaintext,
+    uint8_t* ciphertext,
+    const uint8_t* key,
+    size_t num_blocks
+);
+
+} // namespace ares
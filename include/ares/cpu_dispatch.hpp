@@ -0,0 +1,69 @@
+#pragma once
+
+namespace ares {
+
+/**
+ * @brief Instruction-set levels the SIMD kernels are built for
+ *
+ * Every Gaussian and AES kernel is compiled once per level in its own
+ * translation unit. Pixel conversion kernels exist for Scalar, SSE42 and
+ * AVX2 only; at AVX512 they use the AVX2 set, which
+ * active_pixel_convert_kernel() reports. The highest level supported by
+ * the CPU is selected at first use from CPUID, so one binary runs on
+ * every x86-64 host.
+ */
+enum class IsaLevel {
+    Scalar = 0,  ///< Portable C++ (no intrinsics)
+    SSE42  = 1,  ///< SSE4.2 (+ AES-NI for AES)
+    AVX2   = 2,  ///< AVX2 + FMA + F16C (+ VAES for AES)
+    AVX512 = 3   ///< AVX-512F (+ VAES for AES)
+};
+
+/**
+ * @brief Human-readable name of an ISA level ("scalar", "sse4.2", "avx2", "avx512")
+ */
+const char* isa_level_name(IsaLevel level);
+
+/**
+ * @brief Highest level supported by both the CPU/OS and this build
+ */
+IsaLevel detected_isa_level();
+
+/**
+ * @brief Level currently used by the dispatched kernels
+ *
+ * Defaults to detected_isa_level(). The environment variable
+ * ARES_FORCE_ISA (scalar, sse4.2, avx2, avx512) lowers it at startup,
+ * which is how tests exercise the older code paths on new hardware.
+ */
+IsaLevel active_isa_level();
+
+/**
+ * @brief Re-resolve the dispatched kernels for a different level
+ *
+ * Requests above detected_isa_level() are clamped, so this can never
+ * select instructions the CPU lacks. Not meant to be called while other
+ * threads are inside a kernel.
+ *
+ * @param level Requested level
+ * @return Level actually applied
+ */
+IsaLevel set_isa_level(IsaLevel level);
+
+/**
+ * @brief Name of the separable filter kernel set chosen by dispatch (e.g.
+ *        "avx512"), which every Gaussian variant runs on
+ */
+const char* active_gaussian_kernel();
+
+/**
+ * @brief Name of the AES kernel chosen by dispatch (e.g. "vaes-avx512")
+ */
+const char* active_aes_kernel();
+
+/**
+ * @brief Name of the pixel conversion kernel set chosen by dispatch (e.g. "avx2")
+ */
+const char* active_pixel_convert_kernel();
+
+} // namespace ares
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "gaussian_blur.hpp"
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace ares {
+
+/**
+ * @brief Fills `image` with frame `frame` (0, 1, 2, ...)
+ *
+ * The image is a recycled pipeline buffer of the pipeline's dimensions
+ * holding an older frame. Return false at the end of the stream.
+ */
+using FrameLoader = std::function<bool(size_t frame, Image& image)>;
+
+/**
+ * @brief Computes the output frame from the input frame
+ *
+ * input and output have the pipeline's dimensions and never alias.
+ */
+using FrameFilter = std::function<void(const Image& input, Image& output)>;
+
+/**
+ * @brief Consumes output frame `frame`; frames arrive strictly in order
+ *
+ * The image is only valid during the call. Return false to stop the
+ * pipeline.
+ */
+using FrameStorer = std::function<bool(size_t frame, const Image& image)>;
+
+struct FramePipelineOptions {
+    /// Threads running the filter stage, each on its own frames
+    unsigned int filter_workers = 1;
+    /// Images per buffer pool (inputs and outputs each); raised to
+    /// filter_workers + 2 so the reader, every filter worker and one
+    /// queued frame always have a buffer
+    size_t buffers = 3;
+};
+
+struct FramePipelineStats {
+    size_t frames = 0;           ///< Frames stored
+    bool completed = false;      ///< false if the storer stopped the pipeline
+    double seconds = 0.0;        ///< Wall time of run()
+    double fps = 0.0;            ///< frames / seconds
+    // Latency from the start of a frame's load to the end of its store
+    double latency_p50_ms = 0.0;
+    double latency_p95_ms = 0.0;
+    double latency_p99_ms = 0.0;
+    double latency_max_ms = 0.0;
+};
+
+/**
+ * @brief Overlapped load -> filter -> store over a stream of frames
+ *
+ * One reader thread loads frames, filter_workers threads filter them and
+ * the calling thread stores them, so loading frame n + 2 and storing frame
+ * n run while frame n + 1 is being filtered. Frames are dealt round-robin
+ * to the filter workers through one bounded lock-free SPSC queue per
+ * worker in each direction, so the storer receives them in order without
+ * a reorder buffer. Input and output Images come from two fixed pools
+ * (triple-buffered by default) that are recycled through lock-free MPMC
+ * queues: nothing is allocated per frame.
+ *
+ * A stage that finds its queue empty or full spins briefly, then sleeps
+ * on a futex until another stage moves a frame, so an idle stage does not
+ * hold a core another stage needs.
+ */
+class FramePipeline {
+public:
+    /**
+     * @param width Frame width in pixels
+     * @param height Frame height in pixels
+     * @param options Worker and buffer counts
+     */
+    FramePipeline(size_t width, size_t height, const FramePipelineOptions& options = {});
+
+    FramePipeline(const FramePipeline&) = delete;
+    FramePipeline& operator=(const FramePipeline&) = delete;
+
+    /**
+     * @brief Run until the loader reports the end of the stream or the
+     *        storer stops the pipeline
+     *
+     * The buffer pools are kept between calls.
+     */
+    FramePipelineStats run(const FrameLoader& load, const FrameFilter& filter, const FrameStorer& store);
+
+    /**
+     * @brief run() with gaussian_blur_tiled() as the filter stage
+     */
+    FramePipelineStats run(
+        const FrameLoader& load,
+        const FrameStorer& store,
+        float sigma = 2.0f,
+        BorderMode border = BorderMode::Clamp
+    );
+
+    size_t width() const { return width_; }
+    size_t height() const { return height_; }
+    unsigned int filter_workers() const { return filter_workers_; }
+    size_t buffer_count() const { return inputs_.size(); }
+
+    /**
+     * @brief Image of the input pool (index < buffer_count()), for
+     *        checking that buffers are recycled
+     */
+    const Image& input_buffer(size_t index) const { return inputs_[index]; }
+    const Image& output_buffer(size_t index) const { return outputs_[index]; }
+
+private:
+    size_t width_;
+    size_t height_;
+    unsigned int filter_workers_;
+    std::vector<Image> inputs_;
+    std::vector<Image> outputs_;
+};
+
+} // namespace ares
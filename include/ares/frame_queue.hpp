@@ -0,0 +1,188 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace ares {
+
+namespace detail {
+
+// Producer and consumer indices live on separate cache lines
+inline constexpr size_t QUEUE_CACHE_LINE = 64;
+
+inline size_t queue_capacity(size_t requested) {
+    size_t capacity = 2;
+    while (capacity < requested) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+} // namespace detail
+
+/**
+ * @brief Bounded lock-free queue for one producer and one consumer thread
+ *
+ * A ring of capacity() slots (the requested size rounded up to a power of
+ * two). try_push() is only called by the producer and try_pop() only by
+ * the consumer; each side publishes its index with a release store and
+ * keeps a private copy of the other side's, so the shared lines are only
+ * re-read when the ring looks full or empty.
+ *
+ * T must be default-constructible and movable.
+ */
+template<class T>
+class SpscQueue {
+public:
+    explicit SpscQueue(size_t capacity)
+        : capacity_(detail::queue_capacity(capacity)),
+          mask_(capacity_ - 1),
+          slots_(std::make_unique<T[]>(capacity_)) {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    size_t capacity() const { return capacity_; }
+
+    /**
+     * @return false (and value untouched) if the queue is full
+     */
+    bool try_push(T& value) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_cache_ == capacity_) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if (tail - head_cache_ == capacity_) {
+                return false;
+            }
+        }
+        slots_[tail & mask_] = std::move(value);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @return false if the queue is empty
+     */
+    bool try_pop(T& value) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_cache_) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if (head == tail_cache_) {
+                return false;
+            }
+        }
+        value = std::move(slots_[head & mask_]);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<T[]> slots_;
+
+    // Consumer side
+    alignas(detail::QUEUE_CACHE_LINE) std::atomic<size_t> head_{0};
+    size_t tail_cache_ = 0;
+
+    // Producer side
+    alignas(detail::QUEUE_CACHE_LINE) std::atomic<size_t> tail_{0};
+    size_t head_cache_ = 0;
+};
+
+/**
+ * @brief Bounded lock-free queue for any number of producers and consumers
+ *
+ * Every slot carries a sequence number that says whether it is free for
+ * the push at its position or holds the value for the pop at it, so
+ * producers and consumers only contend on their own position counter
+ * (one compare-exchange per operation) and never on each other's.
+ * Capacity is rounded up to a power of two.
+ *
+ * T must be default-constructible and movable.
+ */
+template<class T>
+class MpmcQueue {
+public:
+    explicit MpmcQueue(size_t capacity)
+        : capacity_(detail::queue_capacity(capacity)),
+          mask_(capacity_ - 1),
+          cells_(std::make_unique<Cell[]>(capacity_)) {
+        for (size_t i = 0; i < capacity_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    size_t capacity() const { return capacity_; }
+
+    /**
+     * @return false (and value untouched) if the queue is full
+     */
+    bool try_push(T& value) {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // Slot still holds the value from one lap ago
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @return false if the queue is empty
+     */
+    bool try_pop(T& value) {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // Push at this position has not completed
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->value);
+        cell->sequence.store(pos + capacity_, std::memory_order_release);
+        return true;
+    }
+
+private:
+    struct alignas(detail::QUEUE_CACHE_LINE) Cell {
+        std::atomic<size_t> sequence{0};
+        T value{};
+    };
+
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+
+    alignas(detail::QUEUE_CACHE_LINE) std::atomic<size_t> enqueue_pos_{0};
+    alignas(detail::QUEUE_CACHE_LINE) std::atomic<size_t> dequeue_pos_{0};
+};
+
+} // namespace ares
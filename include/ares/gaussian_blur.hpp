@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <span>
 
 namespace ares {
 
@@ -16,6 +17,13 @@ struct Image {
     Image(size_t w, size_t h);
     ~Image();
     
+    /**
+     * Allocate without zero-filling; every pixel must be written before it
+     * is read. Pages are then first touched by whichever thread writes them
+     * (see numa.hpp).
+     */
+    static Image uninitialized(size_t w, size_t h);
+    
     // Disable copy, enable move
     Image(const Image&) = delete;
     Image& operator=(const Image&) = delete;
@@ -23,6 +31,34 @@ struct Image {
     Image& operator=(Image&& other) noexcept;
     
     size_t size_bytes() const { return width * height * 4 * sizeof(float); }
+    
+private:
+    struct NoFill {};
+    Image(size_t w, size_t h, NoFill);
+};
+
+/**
+ * @brief How samples beyond the image edge are produced
+ * 
+ * Border handling is resolved outside the inner loops: each row/column is
+ * split into left-border, interior and right-border segments, and only the
+ * border segments look at the mode.
+ */
+enum class BorderMode {
+    Clamp,     ///< Repeat the edge pixel: aaa|abcd|ddd (default)
+    Mirror,    ///< Reflect without repeating the edge: cb|abcd|cb
+    Wrap,      ///< Tile the image: cd|abcd|ab
+    Constant   ///< Zero outside the image: 00|abcd|00
+};
+
+/**
+ * @brief Axis-aligned pixel rectangle (region of interest)
+ */
+struct Rect {
+    size_t x;
+    size_t y;
+    size_t width;
+    size_t height;
 };
 
 /**
@@ -34,45 +70,147 @@ struct Image {
  * @param input Source image
  * @param output Destination image (must be same size as input)
  * @param sigma Gaussian kernel standard deviation (controls blur strength)
+ * @param border Edge handling
  */
 void gaussian_blur_baseline(
     const Image& input,
     Image& output,
-    float sigma = 2.0f
+    float sigma = 2.0f,
+    BorderMode border = BorderMode::Clamp
 );
 
 /**
- * @brief SIMD-optimized Gaussian blur using AVX2
+ * @brief SIMD-optimized Gaussian blur, dispatched at runtime
  * 
- * Vectorized implementation processing 8 floats simultaneously.
- * Requires aligned memory for optimal performance.
+ * Horizontal then vertical pass through a full-size temporary, using the
+ * separable row kernels of the active ISA level (scalar, SSE4.2, AVX2 or
+ * AVX-512; see active_isa_level() in ares/cpu_dispatch.hpp). Rows are read
+ * and written with unaligned loads and stores, so no alignment is
+ * required of the image data.
  * 
- * @param input Source image (data should be 32-byte aligned)
+ * @param input Source image
  * @param output Destination image
  * @param sigma Gaussian kernel standard deviation
+ * @param border Edge handling
  */
 void gaussian_blur_simd(
     const Image& input,
     Image& output,
-    float sigma = 2.0f
+    float sigma = 2.0f,
+    BorderMode border = BorderMode::Clamp
 );
 
 /**
  * @brief Cache-optimized Gaussian blur using tiling
  * 
- * Processes image in 32x32 tiles to maximize L1 cache utilization.
- * Combines SIMD vectorization with cache-aware blocking.
+ * Processes the image in tiles sized from the detected L1 and L2 caches
+ * by gaussian_tile_config(): the vertical kernel window of a tile fits
+ * in L1 and a band of tile rows plus its apron in L2, with rows
+ * prefetched ahead of the tile loops. The policy, the persisted tuner
+ * and streaming stores for large outputs are in ares/tile_tuning.hpp.
  * 
  * @param input Source image
  * @param output Destination image
  * @param sigma Gaussian kernel standard deviation
+ * @param border Edge handling
  */
 void gaussian_blur_tiled(
     const Image& input,
     Image& output,
-    float sigma = 2.0f
+    float sigma = 2.0f,
+    BorderMode border = BorderMode::Clamp
 );
 
+/**
+ * @brief Gaussian blur with the vertical pass run on transposed columns
+ *
+ * Alternative strategy to gaussian_blur_tiled(): each L2-sized tile of the
+ * horizontally blurred image is transposed in register blocks, blurred
+ * along its rows by the horizontal row kernel and transposed back. Two
+ * in-cache transposes replace a vertical pass that streams 2r + 1 rows
+ * per output row. Output is bitwise identical to gaussian_blur_tiled();
+ * bench_transpose maps the sizes and sigmas where it is faster on a given
+ * machine.
+ *
+ * @param input Source image
+ * @param output Destination image (same size as input, must not alias it)
+ * @param sigma Gaussian kernel standard deviation
+ * @param border Edge handling
+ */
+void gaussian_blur_transposed(
+    const Image& input,
+    Image& output,
+    float sigma = 2.0f,
+    BorderMode border = BorderMode::Clamp
+);
+
+/**
+ * @brief Gaussian blur of a single rectangle of the image
+ * 
+ * Reads only the rectangle expanded by the kernel radius (the apron;
+ * Mirror/Wrap borders map apron rows that leave the image back inside it)
+ * and writes only the rectangle; the rest of output is left untouched. Cost is
+ * proportional to the ROI area, not the image size. Pixels inside the ROI
+ * are identical to what gaussian_blur_tiled() produces for the full image.
+ * 
+ * @param input Source image
+ * @param output Destination image (same size as input, must not alias it)
+ * @param roi Rectangle to blur (clipped to the image)
+ * @param sigma Gaussian kernel standard deviation
+ * @param border Edge handling
+ */
+void gaussian_blur_roi(
+    const Image& input,
+    Image& output,
+    const Rect& roi,
+    float sigma = 2.0f,
+    BorderMode border = BorderMode::Clamp
+);
+
+/**
+ * @brief Gaussian blur of many rectangles in one call
+ * 
+ * ROIs are distributed across the shared worker pool, each worker
+ * reusing its own scratch buffer. Rectangles should not overlap;
+ * overlapping ones would be written concurrently.
+ * 
+ * @param input Source image
+ * @param output Destination image (same size as input, must not alias it)
+ * @param rois Rectangles to blur (each clipped to the image)
+ * @param sigma Gaussian kernel standard deviation
+ * @param border Edge handling
+ */
+void gaussian_blur_rois(
+    const Image& input,
+    Image& output,
+    std::span<const Rect> rois,
+    float sigma = 2.0f,
+    BorderMode border = BorderMode::Clamp
+);
+
+/**
+ * @brief One image of a batched blur
+ */
+struct BlurJob {
+    const Image* input;
+    Image* output;                          ///< Same size as input, must not alias it
+    float sigma = 2.0f;
+    BorderMode border = BorderMode::Clamp;
+};
+
+/**
+ * @brief Blur many images (of any sizes and sigmas) in one call
+ * 
+ * Small images are scheduled whole, large ones in row bands, across a
+ * persistent worker pool. Each worker keeps its scratch buffer and last
+ * kernel between images, so a batch of thousands of thumbnails does no
+ * per-image thread creation and almost no allocation. Jobs whose input
+ * and output sizes differ are skipped.
+ * 
+ * @param jobs Images to blur
+ */
+void gaussian_blur_batch(std::span<const BlurJob> jobs);
+
 /**
  * @brief Multi-threaded Gaussian blur using SIMD and threading
  * 
@@ -82,11 +220,40 @@ void gaussian_blur_tiled(
  * @param input Source image
  * @param output Destination image
  * @param sigma Gaussian kernel standard deviation
+ * @param border Edge handling
  */
 void gaussian_blur_multithreaded(
     const Image& input,
     Image& output,
-    float sigma = 2.0f
+    float sigma = 2.0f,
+    BorderMode border = BorderMode::Clamp
+);
+
+/**
+ * @brief AVX-512 Gaussian blur with masked row tails
+ * 
+ * Vectorizes across pixels: each 512-bit register holds 4 RGBA pixels
+ * (16 floats). Row tails use masked loads/stores instead of scalar
+ * cleanup loops. Selected at runtime; on hosts without AVX-512F (or when
+ * the compiler lacks AVX-512 support) this falls back to
+ * gaussian_blur_simd(), so the same binary runs on AVX2-only machines.
+ * 
+ * @param input Source image
+ * @param output Destination image
+ * @param sigma Gaussian kernel standard deviation
+ * @param border Edge handling
+ */
+void gaussian_blur_avx512(
+    const Image& input,
+    Image& output,
+    float sigma = 2.0f,
+    BorderMode border = BorderMode::Clamp
 );
 
+/**
+ * @brief Check if CPU and OS support AVX-512F instructions
+ * @return true if the AVX-512 kernels can run, false otherwise
+ */
+bool has_avx512_support();
+
 } // namespace ares
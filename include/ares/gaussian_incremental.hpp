@@ -0,0 +1,99 @@
+#pragma once
+
+#include "gaussian_blur.hpp"
+#include "separable_filter.hpp"
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace ares {
+
+/**
+ * @brief Blur that is kept up to date by re-filtering only what changed
+ *
+ * Holds the last input, the horizontally filtered intermediate and the
+ * output. After reset() with a full frame, update() takes the next frame
+ * together with the rectangles that differ from the previous one and
+ * recomputes only:
+ *   - the intermediate over the dirty rows, widened by the horizontal
+ *     radius on each side;
+ *   - the output over those columns, over the dirty rows widened by the
+ *     vertical radius.
+ * Work is proportional to (w + 2 * rx) * (h + 2 * ry) per rectangle
+ * instead of to the image size. The output stays bitwise identical to
+ * separable_filter_simd() of the current input.
+ *
+ * With BorderMode::Wrap (or a radius longer than the image under Mirror)
+ * a rectangle whose apron leaves the image also dirties the far edge, and
+ * the affected rows or columns are recomputed across the whole image.
+ *
+ * Everything runs on the calling thread: the regions are meant to be
+ * small, and a full-frame change is cheaper through the other front-ends.
+ */
+class IncrementalBlur {
+public:
+    /**
+     * @param sigma Gaussian kernel standard deviation
+     * @param border Edge handling
+     */
+    explicit IncrementalBlur(float sigma = 2.0f, BorderMode border = BorderMode::Clamp);
+
+    /**
+     * @param filter Any valid separable filter
+     * @param border Edge handling
+     */
+    explicit IncrementalBlur(const SeparableFilter& filter, BorderMode border = BorderMode::Clamp);
+
+    IncrementalBlur(const IncrementalBlur&) = delete;
+    IncrementalBlur& operator=(const IncrementalBlur&) = delete;
+
+    /**
+     * @brief Filter a whole frame and keep it as the state to update
+     *
+     * Sizes the state to the frame; does nothing for an empty image or an
+     * invalid filter.
+     */
+    void reset(const Image& input);
+
+    /**
+     * @brief Bring the state up to date with the next frame
+     *
+     * Pixels of `input` outside `dirty` must equal those of the previous
+     * frame; only the rectangles (clipped to the image) are read.
+     * Rectangles may overlap.
+     *
+     * @return false, changing nothing, if reset() has not been called or
+     *         input has a different size
+     */
+    bool update(const Image& input, std::span<const Rect> dirty);
+
+    bool valid() const { return output_.width > 0; }
+
+    const Image& input() const { return input_; }
+    const Image& intermediate() const { return intermediate_; }
+    const Image& output() const { return output_; }
+
+    /**
+     * @brief Pixels filtered by the last reset() or update(), counting the
+     *        horizontal and the vertical pass separately
+     */
+    size_t recomputed_pixels() const { return recomputed_pixels_; }
+
+private:
+    void filter_rows(const Rect& region);
+    void filter_columns(const Rect& region);
+
+    SeparableFilter filter_;
+    BorderMode border_;
+
+    Image input_;
+    Image intermediate_;
+    Image output_;
+
+    std::vector<Rect> vertical_regions_;
+    std::vector<const float*> tap_rows_;
+    std::vector<float> zero_row_;
+    size_t recomputed_pixels_ = 0;
+};
+
+} // namespace ares
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "gaussian_blur.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace ares {
+
+/**
+ * @brief Read-only view of one pyramid level (RGBA interleaved)
+ */
+struct PyramidLevel {
+    size_t width;
+    size_t height;
+    const float* data;
+
+    size_t size_bytes() const { return width * height * 4 * sizeof(float); }
+};
+
+/**
+ * @brief Gaussian pyramid with the blur fused into the 2x downsampling
+ *
+ * Level n + 1 is level n blurred with a Gaussian of `sigma` and decimated
+ * by two in each direction, but only the retained pixels are computed:
+ * the horizontal pass evaluates every other column and the vertical pass
+ * every other row, both with the dispatched SIMD row kernels. Output
+ * matches gaussian_blur_simd() followed by keeping the even rows and
+ * columns, at about 3/8 of its arithmetic and without the full-size
+ * intermediate.
+ *
+ * All levels and the horizontal-pass scratch live in one arena that is
+ * kept across build() calls and only grows, so rebuilding for frames of
+ * the same size does not allocate. Rows of each level are split across
+ * the shared worker pool; levels depend on one another and are built in
+ * order, and levels too small to be worth splitting run on the caller.
+ */
+class GaussianPyramid {
+public:
+    GaussianPyramid() = default;
+    ~GaussianPyramid();
+
+    GaussianPyramid(const GaussianPyramid&) = delete;
+    GaussianPyramid& operator=(const GaussianPyramid&) = delete;
+    GaussianPyramid(GaussianPyramid&& other) noexcept;
+    GaussianPyramid& operator=(GaussianPyramid&& other) noexcept;
+
+    /**
+     * @brief Build up to `levels` levels from `base`
+     *
+     * Level 0 is `base` itself (not copied; it must outlive the use of
+     * level(0)). Level n is ((w + 1) / 2) x ((h + 1) / 2) of level n - 1.
+     * Stops early once a level reaches 1x1 pixel. Builds nothing (no
+     * levels) if sigma is not positive.
+     *
+     * @param base Full-resolution image
+     * @param levels Number of levels including the base
+     * @param sigma Gaussian applied before each decimation (taps of
+     *        SeparableFilter::gaussian(sigma))
+     * @param border Edge handling
+     */
+    void build(
+        const Image& base,
+        size_t levels,
+        float sigma = 1.0f,
+        BorderMode border = BorderMode::Clamp
+    );
+
+    /**
+     * @brief Levels produced by the last build()
+     */
+    size_t levels() const { return levels_.size(); }
+
+    /**
+     * @brief Level `index`; 0 is the base image
+     */
+    const PyramidLevel& level(size_t index) const { return levels_[index]; }
+
+    /**
+     * @brief Bytes currently reserved for levels and scratch
+     */
+    size_t arena_bytes() const { return arena_floats_ * sizeof(float); }
+
+private:
+    std::vector<PyramidLevel> levels_;
+    float* arena_ = nullptr;
+    size_t arena_floats_ = 0;
+};
+
+} // namespace ares
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "gaussian_blur.hpp"
+#include <span>
+
+namespace ares {
+
+/**
+ * @brief Blur one image at several sigmas in a single pass over the input
+ *
+ * Equivalent to gaussian_blur_tiled(input, *outputs[i], sigmas[i], border)
+ * for every i, but each band of input rows is loaded once and run
+ * through all the horizontal kernels while it is in cache, and the
+ * intermediate rows live in per-band scratch instead of one full-size
+ * temp image per sigma. Input traffic is the same for 1 or 8 sigmas.
+ * Bands are spread across the shared worker pool.
+ *
+ * Nothing is written if the counts differ or any output is a different
+ * size from the input.
+ *
+ * @param input Source image
+ * @param outputs One destination per sigma (must not alias the input)
+ * @param sigmas Gaussian standard deviations, in any order
+ * @param border Edge handling
+ */
+void gaussian_blur_multi(
+    const Image& input,
+    std::span<Image* const> outputs,
+    std::span<const float> sigmas,
+    BorderMode border = BorderMode::Clamp
+);
+
+/**
+ * @brief Difference-of-Gaussians stack in a single pass over the input
+ *
+ * outputs[i] = blur(sigmas[i + 1]) - blur(sigmas[i]), computed like
+ * gaussian_blur_multi() but with the differences formed per row in cache:
+ * the blurred images themselves are never written, so memory traffic is
+ * one input read and sigmas.size() - 1 output writes.
+ *
+ * Nothing is written unless outputs.size() == sigmas.size() - 1 and every
+ * output is the size of the input.
+ *
+ * @param input Source image
+ * @param outputs sigmas.size() - 1 destinations (must not alias the input)
+ * @param sigmas Gaussian standard deviations, usually increasing
+ * @param border Edge handling
+ */
+void difference_of_gaussians(
+    const Image& input,
+    std::span<Image* const> outputs,
+    std::span<const float> sigmas,
+    BorderMode border = BorderMode::Clamp
+);
+
+} // namespace ares
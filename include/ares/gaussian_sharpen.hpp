@@ -0,0 +1,38 @@
+#pragma once
+
+#include "gaussian_blur.hpp"
+
+namespace ares {
+
+/**
+ * @brief Unsharp mask: sharpen by the difference from a Gaussian blur
+ *
+ * Per colour channel, out = in + amount * (in - blur(in, sigma)) where
+ * |in - blur| >= threshold, and out = in elsewhere, clamped to [0, 1].
+ * Alpha is copied (and clamped). Equivalent to gaussian_blur_tiled() into
+ * a temporary followed by the subtract, scale and clamp passes, but the
+ * arithmetic runs in the epilogue of the vertical pass on the blurred
+ * value still in a register: the blurred image is never written, so the
+ * only full-image traffic is the input read and the output write.
+ * Bands of rows are spread across the shared worker pool.
+ *
+ * Nothing is written if the sizes differ.
+ *
+ * @param input Source image
+ * @param output Destination image (same size as input, must not alias it)
+ * @param sigma Standard deviation of the blur that defines "detail"
+ * @param amount Detail gain (0 copies the input, 1 doubles the detail)
+ * @param threshold Smallest |in - blur| that is sharpened, to keep noise
+ *        and flat gradients untouched (0 sharpens everything)
+ * @param border Edge handling of the blur
+ */
+void unsharp_mask(
+    const Image& input,
+    Image& output,
+    float sigma = 1.0f,
+    float amount = 1.0f,
+    float threshold = 0.0f,
+    BorderMode border = BorderMode::Clamp
+);
+
+} // namespace ares
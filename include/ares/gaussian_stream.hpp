@@ -0,0 +1,70 @@
+#pragma once
+
+#include "gaussian_blur.hpp"
+#include "image_io.hpp"
+#include <cstddef>
+#include <functional>
+
+namespace ares {
+
+/**
+ * @brief Supplies the next input row (top to bottom)
+ * 
+ * Must fill width * 4 RGBA floats; return false to abort the blur.
+ */
+using RowSource = std::function<bool(float* row)>;
+
+/**
+ * @brief Receives the next output row (top to bottom)
+ * 
+ * The row (width * 4 RGBA floats) is only valid during the call;
+ * return false to abort the blur.
+ */
+using RowSink = std::function<bool(const float* row)>;
+
+/**
+ * @brief Streaming Gaussian blur for images that do not fit in memory
+ * 
+ * Pulls input rows from `source` and pushes output rows to `sink`, both
+ * strictly in order. Only a rolling window of 2 * radius + 1
+ * horizontally blurred rows is kept, so memory use is
+ * O(width * radius) regardless of height. Output is identical to
+ * gaussian_blur_simd() on the whole image.
+ * 
+ * BorderMode::Wrap is not supported (the first rows would need the last
+ * ones) and makes the call fail without reading anything.
+ * 
+ * @param width Image width in pixels
+ * @param height Image height in pixels
+ * @param source Input rows
+ * @param sink Output rows
+ * @param sigma Gaussian kernel standard deviation
+ * @param border Edge handling (Clamp, Mirror or Constant)
+ * @return true if every row was read and written, false otherwise
+ */
+bool gaussian_blur_stream(
+    size_t width,
+    size_t height,
+    const RowSource& source,
+    const RowSink& sink,
+    float sigma = 2.0f,
+    BorderMode border = BorderMode::Clamp
+);
+
+/**
+ * @brief Streaming Gaussian blur from one image file to another
+ * 
+ * @param reader Open reader positioned at the first row
+ * @param writer Open writer with the same dimensions as the reader
+ * @param sigma Gaussian kernel standard deviation
+ * @param border Edge handling (Clamp, Mirror or Constant)
+ * @return true if successful, false otherwise
+ */
+bool gaussian_blur_stream(
+    ImageRowReader& reader,
+    ImageRowWriter& writer,
+    float sigma = 2.0f,
+    BorderMode border = BorderMode::Clamp
+);
+
+} // namespace ares
@@ -1,14 +1,28 @@
 #pragma once
 
 #include "gaussian_blur.hpp"
+#include <fstream>
 #include <string>
+#include <vector>
 
 namespace ares {
 
+
+/**
+ * @brief On-disk formats understood by the row reader/writer
+ */
+enum class ImageFileFormat {
+    PPM,   ///< P6, 8-bit RGB (maxval 255)
+    PFM    ///< PF, 32-bit float RGB, stored bottom row first
+};
+
 /**
  * @brief Save image to PPM format (simple, no dependencies)
  * 
  * PPM is a simple image format that can be opened by most image viewers.
+ * Values are clamped to [0, 1] and rounded to 8 bits; alpha is dropped.
+ * Rows are converted straight into large blocks that are handed to the
+ * OS in sequential writes.
  * 
  * @param image Image to save
  * @param filename Output filename (should end with .ppm)
@@ -16,6 +30,113 @@ namespace ares {
  */
 bool save_image_ppm(const Image& image, const std::string& filename);
 
+/**
+ * @brief Save image to PFM format (32-bit float RGB, lossless)
+ * 
+ * Same write path as save_image_ppm(); alpha is dropped.
+ * 
+ * @param image Image to save
+ * @param filename Output filename (should end with .pfm)
+ * @return true if successful, false otherwise
+ */
+bool save_image_pfm(const Image& image, const std::string& filename);
+
+/**
+ * @brief Load a PPM (P6, 8-bit) or PFM (PF) file
+ * 
+ * The format is taken from the file's magic number. The file is memory
+ * mapped and converted straight into image, which is reallocated only if
+ * its dimensions differ. PPM values are scaled to [0, 1]; alpha is set
+ * to 1.
+ * 
+ * @param filename Input filename
+ * @param image Destination image
+ * @return true if successful, false otherwise (image is left unchanged
+ *         unless the header was valid)
+ */
+bool load_image(const std::string& filename, Image& image);
+
+/**
+ * @brief Reads a PPM or PFM file one row at a time
+ * 
+ * Only one row of file data is buffered, so arbitrarily tall images can
+ * be processed in bounded memory. The format is taken from the file's
+ * magic number.
+ */
+class ImageRowReader {
+public:
+    /**
+     * @brief Open a file and parse its header
+     * @return true if the file is a supported PPM/PFM, false otherwise
+     */
+    bool open(const std::string& filename);
+    
+    size_t width() const { return width_; }
+    size_t height() const { return height_; }
+    ImageFileFormat format() const { return format_; }
+    
+    /**
+     * @brief Read the next row (top to bottom) as RGBA floats
+     * 
+     * PPM values are scaled to [0, 1]; alpha is set to 1.
+     * 
+     * @param rgba Destination, width() * 4 floats
+     * @return true if a row was read, false on I/O error or past the end
+     */
+    bool read_row(float* rgba);
+    
+private:
+    std::ifstream file_;
+    std::vector<unsigned char> buffer_;
+    ImageFileFormat format_ = ImageFileFormat::PPM;
+    size_t width_ = 0;
+    size_t height_ = 0;
+    size_t next_row_ = 0;
+    std::streamoff data_offset_ = 0;
+    bool little_endian_ = true;  // PFM sample byte order
+};
+
+/**
+ * @brief Writes a PPM or PFM file one row at a time
+ */
+class ImageRowWriter {
+public:
+    /**
+     * @brief Create a file and write its header
+     * @return true if successful, false otherwise
+     */
+    bool open(const std::string& filename, size_t width, size_t height,
+              ImageFileFormat format);
+    
+    size_t width() const { return width_; }
+    size_t height() const { return height_; }
+    
+    /**
+     * @brief Write the next row (top to bottom) from RGBA floats
+     * 
+     * Alpha is dropped; PPM values are clamped to [0, 1] first.
+     * 
+     * @param rgba Source, width() * 4 floats
+     * @return true if successful, false on I/O error or past the end
+     */
+    bool write_row(const float* rgba);
+    
+    /**
+     * @brief Flush and close the file
+     * @return true if every row was written successfully
+     */
+    bool close();
+    
+private:
+    std::ofstream file_;
+    std::vector<unsigned char> buffer_;
+    ImageFileFormat format_ = ImageFileFormat::PPM;
+    size_t width_ = 0;
+    size_t height_ = 0;
+    size_t next_row_ = 0;
+    std::streamoff data_offset_ = 0;
+};
+
 /**
  * @brief Create a simple test image (gradient pattern)
  * 
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "gaussian_blur.hpp"
+#include <cstddef>
+#include <span>
+
+namespace ares {
+
+/**
+ * @brief Summed-area table of an RGBA float image, in double precision
+ *
+ * Entry (x, y) holds, per channel, the sum of every pixel above and to the
+ * left of pixel (x, y): a (width + 1) x (height + 1) table whose first row
+ * and column are zero. The sum over any rectangle is then four lookups,
+ * whatever its size.
+ *
+ * build() splits the rows into one band per worker of the shared pool.
+ * Each band runs a prefix sum along each row (the four channels of a
+ * pixel are the lanes of the running sum) and adds it to the row above
+ * while that is still in cache; a second pass then carries the last row
+ * of each band into the next, by blocks of columns. Sums are
+ * accumulated in double, so a 4K table of values in [0, 1] is exact to
+ * about 1e-9 relative instead of losing all fractional digits in float.
+ *
+ * The table is kept across build() calls and only grows, so rebuilding
+ * for frames of the same size does not allocate.
+ */
+class IntegralImage {
+public:
+    IntegralImage() = default;
+    ~IntegralImage();
+
+    IntegralImage(const IntegralImage&) = delete;
+    IntegralImage& operator=(const IntegralImage&) = delete;
+    IntegralImage(IntegralImage&& other) noexcept;
+    IntegralImage& operator=(IntegralImage&& other) noexcept;
+
+    /**
+     * @brief Build the table of `image` (empty for an empty image)
+     */
+    void build(const Image& image);
+
+    size_t width() const { return width_; }
+    size_t height() const { return height_; }
+
+    /**
+     * @brief Per-channel sums over `rect` clipped to the image (zero if
+     *        nothing is left)
+     */
+    void box_sum(const Rect& rect, double sum[4]) const;
+
+    /**
+     * @brief box_sum() of every rectangle; sums holds 4 doubles per rect
+     *
+     * Large batches are split across the shared worker pool.
+     */
+    void box_sums(std::span<const Rect> rects, double* sums) const;
+
+    /**
+     * @brief Per-channel means over each rectangle clipped to the image;
+     *        means holds 4 floats per rect (zero for an empty rectangle)
+     */
+    void box_means(std::span<const Rect> rects, float* means) const;
+
+    /**
+     * @brief Table entry (x, y), x <= width(), y <= height(): 4 doubles
+     */
+    const double* at(size_t x, size_t y) const { return table_ + (y * (width_ + 1) + x) * 4; }
+
+    /**
+     * @brief Bytes currently reserved for the table
+     */
+    size_t table_bytes() const { return table_doubles_ * sizeof(double); }
+
+private:
+    double* table_ = nullptr;
+    size_t table_doubles_ = 0;
+    size_t width_ = 0;
+    size_t height_ = 0;
+};
+
+/**
+ * @brief Box blur: mean over the (2 * radius + 1)^2 neighbourhood
+ *
+ * Matches separable_filter_simd() with SeparableFilter::box(radius) to
+ * float rounding, including every BorderMode, but reads each output from
+ * an IntegralImage instead of running the taps: the cost per pixel does
+ * not depend on the radius. Pixels whose box leaves the image split it
+ * into border-mapped runs of rows and columns, a handful of lookups each.
+ * Rows are split across the shared worker pool.
+ *
+ * This is the box mode of the blur API. It lives here rather than beside
+ * the Gaussian front-ends because it is built on the table: this overload
+ * builds a temporary one per call, which at 4K is about 265 MB. Callers
+ * blurring a stream of frames, or querying the same image for other
+ * boxes, should keep an IntegralImage and use the overload below.
+ *
+ * @param input Source image
+ * @param output Destination image (same size as input, must not alias it)
+ * @param radius Box half-size in pixels
+ * @param border Edge handling
+ */
+void box_blur(
+    const Image& input,
+    Image& output,
+    int radius,
+    BorderMode border = BorderMode::Clamp
+);
+
+/**
+ * @brief box_blur() reusing a table already built from the input
+ */
+void box_blur(
+    const IntegralImage& integral,
+    Image& output,
+    int radius,
+    BorderMode border = BorderMode::Clamp
+);
+
+} // namespace ares
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "ares/gaussian_blur.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace ares {
+
+/**
+ * @brief One NUMA node and the CPUs attached to it
+ */
+struct NumaNode {
+    int id;
+    std::vector<unsigned int> cpus;
+};
+
+/**
+ * @brief NUMA nodes of the host, detected once on first use
+ *
+ * Read from /sys/devices/system/node on Linux. Elsewhere, or if sysfs is
+ * unavailable, the host is reported as a single node holding every CPU.
+ */
+const std::vector<NumaNode>& numa_nodes();
+
+/**
+ * @brief Whether gaussian_blur_multithreaded() places its workers by node
+ *
+ * Defaults to on when the host has more than one node. The environment
+ * variable ARES_NUMA (0 or 1) overrides the default at startup.
+ */
+bool numa_placement();
+
+/**
+ * @brief Turn worker placement on or off for subsequent blurs
+ *
+ * Not meant to be called while other threads are inside a blur.
+ */
+void set_numa_placement(bool enabled);
+
+/**
+ * @brief CPUs the multithreaded blur pins its workers to, in band order
+ *
+ * Worker t processes row band t and runs on entry t. CPUs are taken from
+ * the calling thread's affinity mask, grouped node by node, so adjacent
+ * bands share a node and restricting the caller (taskset, numactl
+ * --cpunodebind) restricts the blur. Empty when placement is off: the
+ * blur then starts one unpinned worker per hardware thread.
+ */
+std::vector<unsigned int> blur_worker_cpus();
+
+/**
+ * @brief Zero-filled image whose pages are first-touched per row band
+ *
+ * Each band is zeroed by a thread pinned where the matching
+ * gaussian_blur_multithreaded() worker will run, so with the kernel's
+ * default first-touch policy every band's pages land on the node that
+ * processes it. Equivalent to Image(width, height) when placement is off.
+ */
+Image make_numa_image(size_t width, size_t height);
+
+/**
+ * @brief Node holding the page that contains `p`
+ *
+ * @return Node id, or -1 if the page is not resident yet or the query is
+ *         unsupported (non-Linux, or move_pages blocked by the sandbox)
+ */
+int numa_node_of(const void* p);
+
+} // namespace ares
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ares {
+
+/**
+ * @brief Pixel layouts that float RGBA images convert to and from
+ */
+enum class PixelFormat {
+    RGBA_F32,     ///< Interleaved float RGBA (the Image layout)
+    RGBA_U8,      ///< Interleaved 8-bit RGBA, 0..255
+    RGB_U8,       ///< Packed 8-bit RGB; alpha dropped, or 1 when read back
+    Planar_F32,   ///< Four float planes R, G, B, A of width * height each
+    RGBA_F16      ///< Interleaved IEEE 754 half-precision RGBA
+};
+
+/**
+ * @brief Bytes needed for a width x height image in the given format
+ */
+size_t pixel_format_size(PixelFormat format, size_t width, size_t height);
+
+/**
+ * @brief Convert float RGBA pixels to another format (SIMD, multithreaded)
+ * 
+ * Float -> 8-bit clamps to [0, 1], scales by 255 and rounds to nearest;
+ * float -> half rounds to nearest even. Uses the kernels chosen by ISA
+ * dispatch (AVX2 pack/shuffle/convert with saturation on current CPUs);
+ * frames of a megapixel or more are split across the shared worker pool.
+ * 
+ * @param src Source pixels, width * height * 4 floats
+ * @param dst Destination, pixel_format_size(dst_format, width, height) bytes
+ * @param dst_format Destination format
+ * @param width Image width in pixels
+ * @param height Image height in pixels
+ */
+void convert_from_rgba_f32(
+    const float* src,
+    void* dst,
+    PixelFormat dst_format,
+    size_t width,
+    size_t height
+);
+
+/**
+ * @brief Convert pixels in another format to float RGBA (SIMD, multithreaded)
+ * 
+ * 8-bit values are scaled by 1/255; formats without alpha get alpha = 1.
+ * 
+ * @param src Source, pixel_format_size(src_format, width, height) bytes
+ * @param src_format Source format
+ * @param dst Destination pixels, width * height * 4 floats
+ * @param width Image width in pixels
+ * @param height Image height in pixels
+ */
+void convert_to_rgba_f32(
+    const void* src,
+    PixelFormat src_format,
+    float* dst,
+    size_t width,
+    size_t height
+);
+
+/**
+ * @brief Scalar reference for convert_from_rgba_f32()
+ * 
+ * Single-threaded and free of intrinsics; 8-bit results may differ from the
+ * SIMD path by one step where FMA rounding differs.
+ */
+void convert_from_rgba_f32_baseline(
+    const float* src,
+    void* dst,
+    PixelFormat dst_format,
+    size_t width,
+    size_t height
+);
+
+/**
+ * @brief Scalar reference for convert_to_rgba_f32()
+ */
+void convert_to_rgba_f32_baseline(
+    const void* src,
+    PixelFormat src_format,
+    float* dst,
+    size_t width,
+    size_t height
+);
+
+} // namespace ares
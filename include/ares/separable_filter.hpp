@@ -0,0 +1,192 @@
+#pragma once
+
+#include "gaussian_blur.hpp"
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace ares {
+
+/**
+ * @brief Shape of a 1-D kernel, detected from its taps
+ *
+ * Symmetric kernels are folded in the row loops: mirrored taps are added
+ * (Even) or subtracted (Odd) before the multiply, so a kernel of n taps
+ * costs n / 2 + 1 multiplies per output instead of n.
+ */
+enum class TapSymmetry {
+    None,   ///< No usable structure
+    Even,   ///< w[k] == w[n - 1 - k] (Gaussian, box, smoothing)
+    Odd     ///< w[k] == -w[n - 1 - k], zero centre (derivatives)
+};
+
+/**
+ * @brief Pixel layout of the buffers a filter runs over
+ */
+enum class ChannelLayout {
+    RGBA,   ///< 4 interleaved floats per pixel (Image)
+    Plane   ///< 1 float per pixel
+};
+
+/**
+ * @brief Separable 2-D filter: one kernel along rows, one along columns
+ *
+ * The kernels are correlated with the image (out[x] = sum of w[k] *
+ * in[x - radius + k]) by the dispatched row engine, which is specialized
+ * at compile time on tap count, symmetry, border mode, channel layout and
+ * ISA level. 3-, 5- and 7-tap kernels get fully unrolled loops; any other
+ * odd length runs through the same code with a runtime tap count.
+ *
+ * Tap counts must be odd. A filter built from an empty or even-length
+ * kernel is not valid(), and the filter functions write nothing for it.
+ */
+class SeparableFilter {
+public:
+    /**
+     * @brief Empty filter (not valid())
+     */
+    SeparableFilter() = default;
+
+    /**
+     * @param horizontal Taps applied along each row
+     * @param vertical Taps applied along each column
+     */
+    SeparableFilter(std::span<const float> horizontal, std::span<const float> vertical);
+
+    /**
+     * @brief Normalized Gaussian of radius ceil(3 * sigma) on both axes
+     */
+    static SeparableFilter gaussian(float sigma);
+
+    /**
+     * @brief Mean of the (2 * radius + 1)^2 neighbourhood
+     *
+     * For box blurs, box_blur() (ares/integral_image.hpp) gives the same
+     * result from a summed-area table at a cost per pixel independent of
+     * the radius. It is the faster choice for large radii, or at any
+     * radius when the caller keeps the table across calls.
+     */
+    static SeparableFilter box(int radius);
+
+    /**
+     * @brief 3x3 Sobel derivatives: [-1 0 1] across, [1 2 1] along (unnormalized)
+     */
+    static SeparableFilter sobel_x();
+    static SeparableFilter sobel_y();
+
+    /**
+     * @brief 3x3 Scharr derivatives: [-1 0 1] across, [3 10 3] along (unnormalized)
+     */
+    static SeparableFilter scharr_x();
+    static SeparableFilter scharr_y();
+
+    bool valid() const { return !horizontal_.empty() && !vertical_.empty(); }
+
+    std::span<const float> horizontal() const { return horizontal_; }
+    std::span<const float> vertical() const { return vertical_; }
+
+    int horizontal_radius() const { return static_cast<int>(horizontal_.size() / 2); }
+    int vertical_radius() const { return static_cast<int>(vertical_.size() / 2); }
+
+    TapSymmetry horizontal_symmetry() const { return horizontal_symmetry_; }
+    TapSymmetry vertical_symmetry() const { return vertical_symmetry_; }
+
+private:
+    std::vector<float> horizontal_;
+    std::vector<float> vertical_;
+    TapSymmetry horizontal_symmetry_ = TapSymmetry::None;
+    TapSymmetry vertical_symmetry_ = TapSymmetry::None;
+};
+
+/**
+ * @brief Row-by-row separable filter with the dispatched SIMD kernels
+ *
+ * The engine under gaussian_blur_simd(): a full horizontal pass into a
+ * temporary image, then the vertical pass.
+ *
+ * @param input Source image
+ * @param output Destination image (same size as input, must not alias it)
+ * @param filter Kernels to apply
+ * @param border Edge handling
+ */
+void separable_filter_simd(
+    const Image& input,
+    Image& output,
+    const SeparableFilter& filter,
+    BorderMode border = BorderMode::Clamp
+);
+
+/**
+ * @brief Cache-tiled separable filter (the engine under gaussian_blur_tiled())
+ */
+void separable_filter_tiled(
+    const Image& input,
+    Image& output,
+    const SeparableFilter& filter,
+    BorderMode border = BorderMode::Clamp
+);
+
+/**
+ * @brief Separable filter whose vertical pass runs on transposed columns
+ *        (the engine under gaussian_blur_transposed())
+ *
+ * Works in L2-sized tiles: the horizontal pass of a tile and its apron
+ * rows is transposed, in blocks of pixels that go through registers, so
+ * image columns become rows; the horizontal row kernel runs the vertical
+ * taps along them and the result is transposed back. Bitwise identical to
+ * separable_filter_tiled(): each output sums the same values in the same
+ * order.
+ */
+void separable_filter_transposed(
+    const Image& input,
+    Image& output,
+    const SeparableFilter& filter,
+    BorderMode border = BorderMode::Clamp
+);
+
+/**
+ * @brief Separable filter of many rectangles on the shared worker pool
+ *
+ * Pixels inside each rectangle match separable_filter_tiled() over the
+ * whole image; the rest of output is left untouched. Rectangles should
+ * not overlap.
+ */
+void separable_filter_rois(
+    const Image& input,
+    Image& output,
+    std::span<const Rect> rois,
+    const SeparableFilter& filter,
+    BorderMode border = BorderMode::Clamp
+);
+
+/**
+ * @brief Row-banded separable filter on one thread per allowed CPU
+ *        (the engine under gaussian_blur_multithreaded())
+ */
+void separable_filter_multithreaded(
+    const Image& input,
+    Image& output,
+    const SeparableFilter& filter,
+    BorderMode border = BorderMode::Clamp
+);
+
+/**
+ * @brief Separable filter of a single-channel float plane
+ *
+ * Same engine as separable_filter_simd() with ChannelLayout::Plane rows,
+ * so a 16-lane register covers 16 pixels instead of 4. Rows are `width`
+ * floats apart.
+ *
+ * @param src Source plane (width * height floats)
+ * @param dst Destination plane (must not alias src)
+ */
+void separable_filter_plane(
+    const float* src,
+    float* dst,
+    size_t width,
+    size_t height,
+    const SeparableFilter& filter,
+    BorderMode border = BorderMode::Clamp
+);
+
+} // namespace ares
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace ares {
+
+/**
+ * @brief Data cache sizes of the CPU the process runs on
+ */
+struct CacheInfo {
+    size_t l1d_bytes;    ///< L1 data cache per core
+    size_t l2_bytes;     ///< L2 per core
+    size_t l3_bytes;     ///< Last level (0 if none)
+    size_t line_bytes;   ///< Cache line
+    const char* source;  ///< "sysfs", "cpuid" or "default"
+};
+
+/**
+ * @brief Cache sizes, detected once on first use
+ *
+ * Read from /sys/devices/system/cpu/cpu0/cache on Linux, otherwise from
+ * CPUID leaf 4 (Intel) or 0x8000001D (AMD). If neither is available,
+ * a 32 KB / 256 KB / 8 MB / 64 B hierarchy is assumed.
+ */
+const CacheInfo& cache_info();
+
+/**
+ * @brief How much of each cache level the tiled blur plans for
+ *
+ * Tiles are sized so the vertical kernel window of one tile (2r + 1 rows
+ * of tile_width pixels) fills l1_fraction of L1, and so one band of
+ * tile_height + 2r region rows fills l2_fraction of L2, which keeps the
+ * 2r rows shared with the next band in L2. prefetch_rows is how many rows
+ * ahead the tile loops prefetch (0 disables software prefetch).
+ * A non-zero fixed_width and fixed_height bypass the cache model.
+ */
+struct TilePolicy {
+    float l1_fraction = 0.5f;
+    float l2_fraction = 0.5f;
+    int prefetch_rows = 2;
+    size_t fixed_width = 0;
+    size_t fixed_height = 0;
+};
+
+/**
+ * @brief Tile geometry for one blur
+ */
+struct TileConfig {
+    size_t width;       ///< Pixels, a multiple of one cache line of RGBA floats
+    size_t height;      ///< Rows
+    int prefetch_rows;  ///< 0: no software prefetch
+};
+
+/**
+ * @brief Tile geometry the tiled, ROI and batch blurs use for a region
+ *
+ * @param radius Kernel radius (ceil(3 * sigma))
+ * @param region_width Width of the blurred region in pixels
+ */
+TileConfig gaussian_tile_config(int radius, size_t region_width);
+
+/**
+ * @brief Policy currently in effect
+ *
+ * Defaults to TilePolicy{}. If the environment variable ARES_TILE_POLICY
+ * names a file written by save_tile_policy() for this CPU's caches, that
+ * policy is used instead.
+ */
+TilePolicy tile_policy();
+
+/**
+ * @brief Replace the policy for subsequent blurs
+ *
+ * Safe to call while other threads are inside a blur: readers hold a
+ * reference to the policy they loaded until they have derived their tile
+ * sizes from it, so a replaced policy is freed only after its last reader
+ * is done. Blurs that already loaded it keep using the old values.
+ */
+void set_tile_policy(const TilePolicy& policy);
+
+/**
+ * @brief Write a policy, tagged with the current cache sizes, to a text file
+ *
+ * @return false if the file cannot be written
+ */
+bool save_tile_policy(const std::string& path, const TilePolicy& policy);
+
+/**
+ * @brief Read a policy written by save_tile_policy()
+ *
+ * @return false if the file is missing, malformed or was written on a
+ *         CPU with different cache sizes; policy is unchanged then
+ */
+bool load_tile_policy(const std::string& path, TilePolicy& policy);
+
+/**
+ * @brief One-shot tuner: load a persisted policy or measure and persist one
+ *
+ * If `path` holds a valid policy for this CPU it is applied and returned
+ * without measuring. Otherwise the tiled blur is timed on a 1920x1080
+ * frame (sigma 2) for a small set of cache fractions and prefetch
+ * distances (about a second), the fastest policy is applied and saved to
+ * `path`.
+ *
+ * @param path File the choice persists in
+ * @param force Measure even if `path` holds a valid policy
+ * @return Policy now in effect
+ */
+TilePolicy tune_tile_policy(const std::string& path = "ares_tile_policy.txt", bool force = false);
+
+/**
+ * @brief When blur output is written with non-temporal stores
+ *
+ * Streaming stores skip the read-for-ownership of each output line and
+ * leave the input and temp rows in cache, but the output is not cached
+ * afterwards, so they only pay off when it would not have stayed anyway.
+ */
+enum class StreamingStores {
+    Auto,    ///< Stream outputs larger than streaming_store_threshold()
+    Always,
+    Never
+};
+
+/**
+ * @brief Output size above which Auto streams: the last-level cache size
+ *
+ * An output larger than the LLC is evicted before anyone reads it again.
+ */
+size_t streaming_store_threshold();
+
+/**
+ * @brief Mode currently in effect
+ *
+ * Defaults to Auto; the environment variable ARES_STREAMING_STORES
+ * (auto, always, never) overrides it at startup.
+ */
+StreamingStores streaming_stores();
+
+/**
+ * @brief Replace the mode for subsequent blurs
+ */
+void set_streaming_stores(StreamingStores mode);
+
+/**
+ * @brief Whether a blur writing `output_bytes` uses streaming stores
+ */
+bool gaussian_streams_output(size_t output_bytes);
+
+} // namespace ares
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ares {
+
+/**
+ * @brief One completed span
+ */
+struct TraceEvent {
+    const char* name;      ///< String literal passed to ARES_TRACE_SCOPE
+    uint64_t start_ns;     ///< steady_clock time the span opened
+    uint64_t duration_ns;
+    uint32_t thread;       ///< Small sequential id, one per traced thread
+};
+
+/**
+ * @brief Whether the library itself was built with ARES_ENABLE_TRACING
+ *
+ * The recording API below is always available; without the option the
+ * library's own phases simply record nothing.
+ */
+bool tracing_compiled_in();
+
+/**
+ * @brief Clear all buffers and start recording spans
+ *
+ * Each thread records into its own ring buffer of `events_per_thread`
+ * entries (rounded up to a power of two); when it wraps, the oldest spans
+ * are dropped. Not meant to be called while other threads are inside a
+ * traced call.
+ */
+void trace_start(size_t events_per_thread = 65536);
+
+/**
+ * @brief Stop recording; recorded spans stay available for export
+ */
+void trace_stop();
+
+/**
+ * @brief Record again after trace_stop(), keeping the spans so far
+ */
+void trace_resume();
+
+/**
+ * @brief Spans currently held in the buffers, ordered by start time
+ *
+ * Call once the traced work has returned: spans still being written by
+ * another thread may be missing.
+ */
+std::vector<TraceEvent> trace_events();
+
+/**
+ * @brief Spans lost to ring buffer wrap-around since trace_start()
+ */
+uint64_t trace_dropped_events();
+
+/**
+ * @brief Recorded spans as Chrome trace-event JSON
+ *
+ * Loads in chrome://tracing and ui.perfetto.dev: one row per thread,
+ * complete ("X") events with microsecond timestamps relative to
+ * trace_start(), and thread names from trace_thread_name().
+ */
+std::string chrome_trace_json();
+
+/**
+ * @brief Write chrome_trace_json() to a file
+ *
+ * @return false if the file cannot be written
+ */
+bool write_chrome_trace(const std::string& path);
+
+/**
+ * @brief Label the calling thread in exported traces
+ *
+ * @param name String literal (the pointer is kept)
+ */
+void trace_thread_name(const char* name);
+
+namespace detail {
+
+extern std::atomic<bool> trace_recording;
+
+inline uint64_t trace_clock_ns() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// Appends to the calling thread's ring buffer; no locks after the
+// thread's first span
+void trace_record(const char* name, uint64_t start_ns, uint64_t end_ns);
+
+// Records the enclosing scope as one span. Costs one relaxed load when
+// recording is off.
+class TraceScope {
+public:
+    explicit TraceScope(const char* name)
+        : name_(name), start_(trace_recording.load(std::memory_order_relaxed) ? trace_clock_ns() : 0) {}
+
+    ~TraceScope() {
+        if (start_ != 0) {
+            trace_record(name_, start_, trace_clock_ns());
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* name_;
+    uint64_t start_;
+};
+
+} // namespace detail
+} // namespace ares
+
+// Scopes compile to nothing unless ARES_ENABLE_TRACING is defined (CMake
+// option of the same name). Only use them in translation units built for
+// the baseline ISA: the inline scope code must not be emitted with
+// -mavx2 / -mavx512f flags, or the linker may keep that copy.
+#define ARES_TRACE_CONCAT_INNER(a, b) a##b
+#define ARES_TRACE_CONCAT(a, b) ARES_TRACE_CONCAT_INNER(a, b)
+
+#ifdef ARES_ENABLE_TRACING
+#define ARES_TRACE_SCOPE(name) \
+    ::ares::detail::TraceScope ARES_TRACE_CONCAT(ares_trace_scope_, __LINE__)(name)
+#define ARES_TRACE_THREAD_NAME(name) ::ares::trace_thread_name(name)
+#else
+#define ARES_TRACE_SCOPE(name) ((void)0)
+#define ARES_TRACE_THREAD_NAME(name) ((void)0)
+#endif
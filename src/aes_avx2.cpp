@@ -0,0 +1,65 @@
+#include "isa_dispatch.hpp"
+#include <immintrin.h>
+
+// Built with -mavx2 -maes -mvaes. Only reached once CPUID reports VAES and
+// the OS has enabled YMM state.
+
+namespace ares {
+namespace detail {
+
+// 256-bit VAES processes two blocks per instruction; four registers in
+// flight cover the AESENC latency.
+constexpr size_t VAES256_INTERLEAVE = 4;
+
+void aes_encrypt_vaes_avx2(
+    const uint8_t* plaintext,
+    uint8_t* ciphertext,
+    const uint8_t* key,
+    size_t num_blocks
+) {
+    __m128i round_keys[11];
+    aes128_expand_key_aesni(key, round_keys);
+
+    __m256i wide_keys[11];
+    for (int i = 0; i < 11; ++i) {
+        wide_keys[i] = _mm256_broadcastsi128_si256(round_keys[i]);
+    }
+
+    const size_t step = 2 * VAES256_INTERLEAVE;
+    size_t block = 0;
+    for (; block + step <= num_blocks; block += step) {
+        const __m256i* in = reinterpret_cast<const __m256i*>(plaintext + block * 16);
+        __m256i* out = reinterpret_cast<__m256i*>(ciphertext + block * 16);
+
+        __m256i s0 = _mm256_xor_si256(_mm256_loadu_si256(in + 0), wide_keys[0]);
+        __m256i s1 = _mm256_xor_si256(_mm256_loadu_si256(in + 1), wide_keys[0]);
+        __m256i s2 = _mm256_xor_si256(_mm256_loadu_si256(in + 2), wide_keys[0]);
+        __m256i s3 = _mm256_xor_si256(_mm256_loadu_si256(in + 3), wide_keys[0]);
+
+        for (int round = 1; round <= 9; ++round) {
+            s0 = _mm256_aesenc_epi128(s0, wide_keys[round]);
+            s1 = _mm256_aesenc_epi128(s1, wide_keys[round]);
+            s2 = _mm256_aesenc_epi128(s2, wide_keys[round]);
+            s3 = _mm256_aesenc_epi128(s3, wide_keys[round]);
+        }
+
+        _mm256_storeu_si256(out + 0, _mm256_aesenclast_epi128(s0, wide_keys[10]));
+        _mm256_storeu_si256(out + 1, _mm256_aesenclast_epi128(s1, wide_keys[10]));
+        _mm256_storeu_si256(out + 2, _mm256_aesenclast_epi128(s2, wide_keys[10]));
+        _mm256_storeu_si256(out + 3, _mm256_aesenclast_epi128(s3, wide_keys[10]));
+    }
+
+    // Remaining blocks one at a time with the 128-bit instructions
+    for (; block < num_blocks; ++block) {
+        __m128i state = _mm_loadu_si128(reinterpret_cast<const __m128i*>(plaintext + block * 16));
+        state = _mm_xor_si128(state, round_keys[0]);
+        for (int round = 1; round <= 9; ++round) {
+            state = _mm_aesenc_si128(state, round_keys[round]);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(ciphertext + block * 16),
+                         _mm_aesenclast_si128(state, round_keys[10]));
+    }
+}
+
+} // namespace detail
+} // namespace ares
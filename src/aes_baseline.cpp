@@ -1,4 +1,5 @@
 #include "ares/aes.hpp"
+#include "ares/trace.hpp"
 #include <algorithm>
 #include <cstring>
 
@@ -124,11 +125,17 @@ void aes_encrypt_baseline(
     const uint8_t* key,
     size_t num_blocks
 ) {
+    ARES_TRACE_SCOPE("aes_encrypt_baseline");
+    
     // Expand the key into round keys
     uint8_t expanded_key[176]; // 11 round keys * 16 bytes
-    expand_key(key, expanded_key);
+    {
+        ARES_TRACE_SCOPE("aes.expand_key");
+        expand_key(key, expanded_key);
+    }
     
     // Process each block
+    ARES_TRACE_SCOPE("aes.blocks");
     for (size_t block = 0; block < num_blocks; ++block) {
         uint8_t state[16];
         std::memcpy(state, plaintext + block * 16, 16);
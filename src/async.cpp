@@ -0,0 +1,364 @@
+#include "ares/async.hpp"
+#include "ares/aes.hpp"
+#include "ares/separable_filter.hpp"
+#include "ares/tile_tuning.hpp"
+#include "ares/trace.hpp"
+#include "separable_region.hpp"
+#include "thread_pool.hpp"
+#include <immintrin.h>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+namespace ares {
+
+// Images up to this many pixels are one part; larger ones are cut into
+// row bands of at least ASYNC_MIN_BAND_ROWS, as in gaussian_blur_batch()
+constexpr size_t ASYNC_WHOLE_IMAGE_PIXELS = 512 * 512;
+constexpr size_t ASYNC_MIN_BAND_ROWS = 64;
+
+// 256 KB of AES input per part
+constexpr size_t ASYNC_AES_PART_BLOCKS = 16384;
+
+// Parts per pool thread in one dispatch round. Rounds are kept short so
+// the shared pool is released between them: blocking callers get a turn
+// and newly submitted parts wait for at most one round.
+constexpr size_t ASYNC_ROUND_PARTS_PER_THREAD = 2;
+
+namespace detail {
+
+enum class AsyncKind { GaussianBlur, AesEncrypt };
+
+struct AsyncJobState {
+    AsyncKind kind;
+    uint64_t tag = 0;
+    std::atomic<JobStatus> status{ JobStatus::Pending };
+    std::atomic<size_t> remaining{ 0 };
+    std::atomic<bool> cancel_requested{ false };
+    std::atomic<bool> skipped{ false };
+
+    // Coroutines suspended on the job, resumed by whoever finishes it
+    std::mutex mutex;
+    std::vector<std::coroutine_handle<>> continuations;
+
+    // Blur: one part per band of rows
+    const Image* input = nullptr;
+    Image* output = nullptr;
+    SeparableFilter filter;
+    BorderMode border = BorderMode::Clamp;
+    const SeparableRowKernels* kernels = nullptr;
+    size_t band = 0;
+    bool stream_output = false;
+
+    // AES: one part per ASYNC_AES_PART_BLOCKS blocks
+    const uint8_t* plaintext = nullptr;
+    uint8_t* ciphertext = nullptr;
+    uint8_t key[16] = {};
+    size_t num_blocks = 0;
+};
+
+} // namespace detail
+
+static bool finished(JobStatus status) {
+    return status == JobStatus::Completed || status == JobStatus::Cancelled ||
+           status == JobStatus::Rejected;
+}
+
+// Blur scratch per pool thread, kept across jobs
+struct AsyncScratch {
+    float* temp = nullptr;
+    size_t capacity = 0;
+
+    ~AsyncScratch() {
+        _mm_free(temp);
+    }
+
+    float* temp_for(size_t floats) {
+        if (floats > capacity) {
+            ARES_TRACE_SCOPE("blur.temp_alloc");
+            _mm_free(temp);
+            temp = static_cast<float*>(_mm_malloc(floats * sizeof(float), 64));
+            capacity = floats;
+        }
+        return temp;
+    }
+};
+
+static void run_part(detail::AsyncJobState& job, size_t index) {
+    if (job.kind == detail::AsyncKind::GaussianBlur) {
+        ARES_TRACE_SCOPE("async.blur");
+        thread_local AsyncScratch scratch;
+        const size_t y = index * job.band;
+        const Rect band{ 0, y, job.input->width, std::min(job.band, job.input->height - y) };
+        float* temp = scratch.temp_for(detail::region_temp_floats(band, job.filter));
+        detail::filter_region_tiled(*job.kernels, *job.input, *job.output, band, job.filter,
+                                    job.border, temp, job.stream_output);
+        return;
+    }
+
+    ARES_TRACE_SCOPE("async.aes");
+    const size_t first = index * ASYNC_AES_PART_BLOCKS;
+    const size_t blocks = std::min(ASYNC_AES_PART_BLOCKS, job.num_blocks - first);
+    aes_encrypt_simd(job.plaintext + first * 16, job.ciphertext + first * 16, job.key, blocks);
+}
+
+// AsyncJob
+
+uint64_t AsyncJob::tag() const {
+    return state_->tag;
+}
+
+JobStatus AsyncJob::status() const {
+    return state_->status.load(std::memory_order_acquire);
+}
+
+bool AsyncJob::done() const {
+    return finished(status());
+}
+
+JobStatus AsyncJob::wait() const {
+    JobStatus status = state_->status.load(std::memory_order_acquire);
+    while (!finished(status)) {
+        state_->status.wait(status, std::memory_order_acquire);
+        status = state_->status.load(std::memory_order_acquire);
+    }
+    return status;
+}
+
+bool AsyncJob::cancel() {
+    if (done()) {
+        return false;
+    }
+    state_->cancel_requested.store(true, std::memory_order_release);
+    return true;
+}
+
+bool AsyncJob::await_suspend(std::coroutine_handle<> continuation) {
+    // The status is set under the same lock the continuations are taken
+    // under, so a job finishing now either sees this handle or makes us
+    // resume at once
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    if (finished(state_->status.load(std::memory_order_acquire))) {
+        return false;
+    }
+    state_->continuations.push_back(continuation);
+    return true;
+}
+
+// AsyncExecutor
+
+AsyncExecutor::AsyncExecutor(const AsyncExecutorOptions& options)
+    : completion_queue_enabled_(options.completion_queue) {
+    // Constructed before the dispatcher starts, so a static executor is
+    // destroyed before the pool it drains into
+    detail::ThreadPool::shared();
+    dispatcher_ = std::thread(&AsyncExecutor::dispatch_loop, this);
+}
+
+AsyncExecutor::~AsyncExecutor() {
+    {
+        // Parts queued or in the current round are skipped, so every job
+        // finishes
+        std::lock_guard<std::mutex> lock(submit_mutex_);
+        for (const detail::AsyncItem& item : submissions_) {
+            item.job->cancel_requested.store(true, std::memory_order_relaxed);
+        }
+        stop_.store(true, std::memory_order_relaxed);
+    }
+    work_ready_.notify_one();
+    dispatcher_.join();
+}
+
+AsyncJob AsyncExecutor::enqueue(std::shared_ptr<detail::AsyncJobState> state, size_t parts) {
+    if (parts == 0) {
+        state->status.store(JobStatus::Rejected, std::memory_order_release);
+        post_completion(state->tag, JobStatus::Rejected, false);
+        return AsyncJob(std::move(state));
+    }
+
+    state->remaining.store(parts, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(complete_mutex_);
+        ++in_flight_;
+    }
+    {
+        std::lock_guard<std::mutex> lock(submit_mutex_);
+        for (size_t i = 0; i < parts; ++i) {
+            submissions_.push_back(detail::AsyncItem{ state, i });
+        }
+    }
+    work_ready_.notify_one();
+    return AsyncJob(std::move(state));
+}
+
+AsyncJob AsyncExecutor::submit_gaussian_blur(
+    const Image& input,
+    Image& output,
+    float sigma,
+    BorderMode border,
+    uint64_t tag
+) {
+    ARES_TRACE_SCOPE("async.submit");
+    auto state = std::make_shared<detail::AsyncJobState>();
+    state->kind = detail::AsyncKind::GaussianBlur;
+    state->tag = tag;
+    if (input.width != output.width || input.height != output.height ||
+        input.width == 0 || input.height == 0) {
+        return enqueue(std::move(state), 0);
+    }
+
+    state->input = &input;
+    state->output = &output;
+    state->filter = SeparableFilter::gaussian(sigma);
+    state->border = border;
+    state->kernels = &detail::separable_kernels();
+    // Decided per image, so all bands agree
+    state->stream_output = gaussian_streams_output(output.size_bytes());
+
+    // Roughly four bands per pool worker for a large image
+    size_t band = input.height;
+    if (input.width * input.height > ASYNC_WHOLE_IMAGE_PIXELS) {
+        const size_t split = workers() * 4;
+        band = std::max((input.height + split - 1) / split, ASYNC_MIN_BAND_ROWS);
+    }
+    state->band = band;
+    return enqueue(std::move(state), (input.height + band - 1) / band);
+}
+
+AsyncJob AsyncExecutor::submit_aes_encrypt(
+    const uint8_t* plaintext,
+    uint8_t* ciphertext,
+    const uint8_t* key,
+    size_t num_blocks,
+    uint64_t tag
+) {
+    ARES_TRACE_SCOPE("async.submit");
+    auto state = std::make_shared<detail::AsyncJobState>();
+    state->kind = detail::AsyncKind::AesEncrypt;
+    state->tag = tag;
+    if (!plaintext || !ciphertext || !key || num_blocks == 0) {
+        return enqueue(std::move(state), 0);
+    }
+
+    state->plaintext = plaintext;
+    state->ciphertext = ciphertext;
+    std::memcpy(state->key, key, sizeof(state->key));
+    state->num_blocks = num_blocks;
+    return enqueue(std::move(state), (num_blocks + ASYNC_AES_PART_BLOCKS - 1) / ASYNC_AES_PART_BLOCKS);
+}
+
+void AsyncExecutor::dispatch_loop() {
+    ARES_TRACE_THREAD_NAME("async dispatcher");
+    detail::ThreadPool& pool = detail::ThreadPool::shared();
+    std::vector<detail::AsyncItem> round;
+    std::mutex resume_mutex;
+    std::vector<std::coroutine_handle<>> resume;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(submit_mutex_);
+            work_ready_.wait(lock, [&] { return stop_.load(std::memory_order_relaxed) || !submissions_.empty(); });
+            if (submissions_.empty()) {
+                return;
+            }
+            const size_t parts = std::min(submissions_.size(),
+                                          pool.concurrency() * ASYNC_ROUND_PARTS_PER_THREAD);
+            round.assign(std::make_move_iterator(submissions_.begin()),
+                         std::make_move_iterator(submissions_.begin() + parts));
+            submissions_.erase(submissions_.begin(), submissions_.begin() + parts);
+        }
+
+        pool.parallel_for(round.size(), [&](size_t i, unsigned int) {
+            detail::AsyncJobState& job = *round[i].job;
+            if (job.cancel_requested.load(std::memory_order_acquire) ||
+                stop_.load(std::memory_order_relaxed)) {
+                job.skipped.store(true, std::memory_order_relaxed);
+            } else {
+                JobStatus pending = JobStatus::Pending;
+                job.status.compare_exchange_strong(pending, JobStatus::Running, std::memory_order_acq_rel);
+                run_part(job, round[i].index);
+            }
+
+            if (job.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                std::lock_guard<std::mutex> lock(resume_mutex);
+                finish(job, resume);
+            }
+        });
+        round.clear();
+
+        // Resumed here rather than on a pool thread: a coroutine that
+        // calls a pooled blur would otherwise run it inline on one thread
+        for (std::coroutine_handle<> continuation : resume) {
+            continuation.resume();
+        }
+        resume.clear();
+    }
+}
+
+void AsyncExecutor::finish(detail::AsyncJobState& job, std::vector<std::coroutine_handle<>>& resume) {
+    const JobStatus status = job.skipped.load(std::memory_order_relaxed)
+        ? JobStatus::Cancelled
+        : JobStatus::Completed;
+
+    {
+        std::lock_guard<std::mutex> lock(job.mutex);
+        job.status.store(status, std::memory_order_release);
+        resume.insert(resume.end(), job.continuations.begin(), job.continuations.end());
+        job.continuations.clear();
+    }
+    job.status.notify_all();
+    post_completion(job.tag, status, true);
+}
+
+void AsyncExecutor::post_completion(uint64_t tag, JobStatus status, bool counted) {
+    {
+        std::lock_guard<std::mutex> lock(complete_mutex_);
+        if (counted) {
+            --in_flight_;
+        }
+        if (!completion_queue_enabled_) {
+            return;
+        }
+        completions_.push_back(Completion{ tag, status });
+    }
+    completion_ready_.notify_one();
+}
+
+size_t AsyncExecutor::poll_completions(Completion* out, size_t max) {
+    std::lock_guard<std::mutex> lock(complete_mutex_);
+    const size_t count = std::min(max, completions_.size());
+    std::copy_n(completions_.begin(), count, out);
+    completions_.erase(completions_.begin(), completions_.begin() + count);
+    return count;
+}
+
+size_t AsyncExecutor::wait_completions(Completion* out, size_t max, std::chrono::milliseconds timeout) {
+    {
+        std::unique_lock<std::mutex> lock(complete_mutex_);
+        completion_ready_.wait_for(lock, timeout, [&] { return !completions_.empty(); });
+    }
+    return poll_completions(out, max);
+}
+
+size_t AsyncExecutor::jobs_in_flight() const {
+    std::lock_guard<std::mutex> lock(complete_mutex_);
+    return in_flight_;
+}
+
+unsigned int AsyncExecutor::workers() const {
+    return detail::ThreadPool::shared().concurrency();
+}
+
+AsyncExecutor& AsyncExecutor::shared() {
+    static AsyncExecutor executor;
+    return executor;
+}
+
+AsyncJob gaussian_blur_async(const Image& input, Image& output, float sigma, BorderMode border) {
+    return AsyncExecutor::shared().submit_gaussian_blur(input, output, sigma, border);
+}
+
+AsyncJob aes_encrypt_async(const uint8_t* plaintext, uint8_t* ciphertext, const uint8_t* key, size_t num_blocks) {
+    return AsyncExecutor::shared().submit_aes_encrypt(plaintext, ciphertext, key, num_blocks);
+}
+
+} // namespace ares
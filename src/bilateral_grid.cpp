@@ -0,0 +1,273 @@
+#include "ares/bilateral_grid.hpp"
+#include "ares/trace.hpp"
+#include "separable_region.hpp"
+#include "thread_pool.hpp"
+#include <immintrin.h>
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
+#include <vector>
+
+namespace ares {
+
+// Rec. 709 luma weights of the range axis
+constexpr float LUMA_R = 0.2126f;
+constexpr float LUMA_G = 0.7152f;
+constexpr float LUMA_B = 0.0722f;
+
+// Images with fewer pixels than this are filtered on the calling thread
+constexpr size_t BILATERAL_SERIAL_PIXELS = 128 * 128;
+
+// Floats per work item of the z blur
+constexpr size_t BILATERAL_Z_CHUNK = 4096;
+
+static inline float luminance(const float* pixel) {
+    const float l = pixel[0] * LUMA_R + pixel[1] * LUMA_G + pixel[2] * LUMA_B;
+    return std::min(std::max(l, 0.0f), 1.0f);
+}
+
+// Range coordinate (luminance / sigma_range) of every pixel of a row,
+// four pixels per vector after a 4x4 transpose to planar R, G, B
+static void range_row(const float* src, size_t width, float inv_range, float* coords) {
+    const __m128 luma_r = _mm_set1_ps(LUMA_R);
+    const __m128 luma_g = _mm_set1_ps(LUMA_G);
+    const __m128 luma_b = _mm_set1_ps(LUMA_B);
+    const __m128 scale = _mm_set1_ps(inv_range);
+    size_t x = 0;
+    for (; x + 4 <= width; x += 4) {
+        __m128 r = _mm_loadu_ps(src + x * 4);
+        __m128 g = _mm_loadu_ps(src + x * 4 + 4);
+        __m128 b = _mm_loadu_ps(src + x * 4 + 8);
+        __m128 a = _mm_loadu_ps(src + x * 4 + 12);
+        _MM_TRANSPOSE4_PS(r, g, b, a);
+        __m128 l = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r, luma_r), _mm_mul_ps(g, luma_g)), _mm_mul_ps(b, luma_b));
+        l = _mm_min_ps(_mm_max_ps(l, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+        _mm_storeu_ps(coords + x, _mm_mul_ps(l, scale));
+    }
+    for (; x < width; ++x) {
+        coords[x] = luminance(src + x * 4) * inv_range;
+    }
+}
+
+BilateralGrid::BilateralGrid(float sigma_spatial, float sigma_range)
+    : sigma_spatial_(sigma_spatial), sigma_range_(sigma_range),
+      blur_(SeparableFilter::gaussian(1.0f)) {}
+
+BilateralGrid::~BilateralGrid() {
+    _mm_free(grid_);
+    _mm_free(scratch_);
+}
+
+bool BilateralGrid::apply(const Image& input, Image& output) {
+    ARES_TRACE_SCOPE("BilateralGrid::apply");
+    if (input.width != output.width || input.height != output.height ||
+        input.width == 0 || input.height == 0 ||
+        !(sigma_spatial_ >= 1.0f) || !(sigma_range_ > 0.0f && sigma_range_ <= 1.0f)) {
+        return false;
+    }
+
+    // Pixel x splats into cell round(x / sigma_spatial) and slices between
+    // floor(x / sigma_spatial) and the next cell, so one cell past the
+    // last rounded coordinate is enough on every axis
+    const float inv_spatial = 1.0f / sigma_spatial_;
+    const float inv_range = 1.0f / sigma_range_;
+    const size_t gw = static_cast<size_t>((input.width - 1) * inv_spatial) + 2;
+    const size_t gh = static_cast<size_t>((input.height - 1) * inv_spatial) + 2;
+    const size_t gd = static_cast<size_t>(inv_range) + 2;
+    const size_t row_floats = gw * 4;
+    const size_t slice_floats = gh * row_floats;
+    const size_t grid_floats = gd * slice_floats;
+    if (grid_floats > capacity_) {
+        ARES_TRACE_SCOPE("bilateral.alloc");
+        _mm_free(grid_);
+        _mm_free(scratch_);
+        grid_ = static_cast<float*>(_mm_malloc(grid_floats * sizeof(float), 64));
+        scratch_ = static_cast<float*>(_mm_malloc(grid_floats * sizeof(float), 64));
+        capacity_ = grid_floats;
+    }
+    grid_width_ = gw;
+    grid_height_ = gh;
+    grid_depth_ = gd;
+
+    const size_t width = input.width;
+    const size_t height = input.height;
+    // Chunks of at least this many items: one chunk, on this thread, for
+    // a small image
+    const size_t min_chunk = width * height >= BILATERAL_SERIAL_PIXELS ? 1 : SIZE_MAX;
+
+    // Splat and slice coordinates along x, shared by every row
+    std::vector<int> splat_x(width);
+    std::vector<int> slice_x(width);
+    std::vector<float> slice_tx(width);
+    for (size_t x = 0; x < width; ++x) {
+        const float fx = x * inv_spatial;
+        splat_x[x] = static_cast<int>(fx + 0.5f);
+        slice_x[x] = static_cast<int>(fx);
+        slice_tx[x] = fx - slice_x[x];
+    }
+
+    // Image rows [row_begin[g], row_begin[g + 1]) splat into grid row g
+    std::vector<size_t> row_begin(gh + 1, height);
+    for (size_t y = height; y-- > 0;) {
+        row_begin[static_cast<int>(y * inv_spatial + 0.5f)] = y;
+    }
+    for (size_t g = gh; g-- > 0;) {
+        row_begin[g] = std::min(row_begin[g], row_begin[g + 1]);
+    }
+
+    // Splat: each worker clears and fills whole grid rows in every slice
+    {
+        ARES_TRACE_SCOPE("bilateral.splat");
+        const __m128 rgb_mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+        const __m128 unit_weight = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+        detail::parallel_chunks(gh, min_chunk, [&](size_t g_begin, size_t g_end, unsigned int) {
+            std::vector<float> coords(width);
+            for (size_t z = 0; z < gd; ++z) {
+                float* slice = grid_ + z * slice_floats;
+                std::fill(slice + g_begin * row_floats, slice + g_end * row_floats, 0.0f);
+            }
+            for (size_t y = row_begin[g_begin]; y < row_begin[g_end]; ++y) {
+                const float* src = input.data + y * width * 4;
+                float* grid_row = grid_ + static_cast<int>(y * inv_spatial + 0.5f) * row_floats;
+                range_row(src, width, inv_range, coords.data());
+                for (size_t x = 0; x < width; ++x) {
+                    const int gz = static_cast<int>(coords[x] + 0.5f);
+                    float* cell = grid_row + gz * slice_floats + splat_x[x] * 4;
+                    const __m128 value = _mm_or_ps(_mm_and_ps(_mm_loadu_ps(src + x * 4), rgb_mask), unit_weight);
+                    _mm_store_ps(cell, _mm_add_ps(_mm_load_ps(cell), value));
+                }
+            }
+        });
+    }
+
+    // Blur: x and y per slice into the scratch grid, then z back into the
+    // grid, all with zero beyond the edges
+    const detail::SeparableRowKernels& kernels = detail::separable_kernels();
+    {
+        ARES_TRACE_SCOPE("bilateral.blur_xy");
+        detail::parallel_chunks(gd, min_chunk, [&](size_t z_begin, size_t z_end, unsigned int) {
+            for (size_t z = z_begin; z < z_end; ++z) {
+                detail::filter_image(kernels, grid_ + z * slice_floats, scratch_ + z * slice_floats,
+                                     gw, gh, ChannelLayout::RGBA, blur_, BorderMode::Constant);
+            }
+        });
+    }
+    {
+        ARES_TRACE_SCOPE("bilateral.blur_z");
+        const int radius = blur_.vertical_radius();
+        const detail::VerticalRowFn vertical = kernels.vertical_for(false, blur_);
+        const std::vector<float> zero_slice(slice_floats, 0.0f);
+        const size_t chunks = (slice_floats + BILATERAL_Z_CHUNK - 1) / BILATERAL_Z_CHUNK;
+        detail::parallel_chunks(gd * chunks, min_chunk, [&](size_t begin, size_t end, unsigned int) {
+            std::vector<const float*> rows(2 * radius + 1);
+            for (size_t item = begin; item < end; ++item) {
+                const size_t z = item / chunks;
+                const size_t first = (item % chunks) * BILATERAL_Z_CHUNK;
+                detail::resolve_tap_rows(BorderMode::Constant, scratch_, slice_floats, zero_slice.data(),
+                                         static_cast<int>(z), radius, static_cast<int>(gd), rows.data());
+                vertical(rows.data(), grid_ + z * slice_floats, first,
+                         std::min(first + BILATERAL_Z_CHUNK, slice_floats),
+                         blur_.vertical().data(), static_cast<int>(rows.size()));
+            }
+        });
+    }
+
+    // Slice: trilinear read at (x, y, luminance), colour sums over weight.
+    // Per image row, grid rows gy and gy + 1 are first blended in y for
+    // every slice, so each pixel reads four cells instead of eight
+    {
+        ARES_TRACE_SCOPE("bilateral.slice");
+        const __m128 rgb_mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+        const __m128 alpha_mask = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+        auto lerp = [](__m128 a, __m128 b, __m128 t) { return _mm_add_ps(a, _mm_mul_ps(t, _mm_sub_ps(b, a))); };
+        detail::parallel_chunks(height, min_chunk, [&](size_t y_begin, size_t y_end, unsigned int) {
+            float* blended = static_cast<float*>(_mm_malloc(gd * row_floats * sizeof(float), 64));
+            std::vector<float> coords(width);
+            for (size_t y = y_begin; y < y_end; ++y) {
+                const float fy = y * inv_spatial;
+                const int gy = static_cast<int>(fy);
+                const __m128 ty = _mm_set1_ps(fy - gy);
+                for (size_t z = 0; z < gd; ++z) {
+                    const float* top = grid_ + z * slice_floats + gy * row_floats;
+                    float* dst = blended + z * row_floats;
+                    for (size_t i = 0; i < row_floats; i += 4) {
+                        _mm_store_ps(dst + i, lerp(_mm_load_ps(top + i), _mm_load_ps(top + row_floats + i), ty));
+                    }
+                }
+
+                const float* src = input.data + y * width * 4;
+                float* dst = output.data + y * width * 4;
+                range_row(src, width, inv_range, coords.data());
+                for (size_t x = 0; x < width; ++x) {
+                    const __m128 pixel = _mm_loadu_ps(src + x * 4);
+                    const int gz = static_cast<int>(coords[x]);
+                    const __m128 tz = _mm_set1_ps(coords[x] - gz);
+                    const __m128 tx = _mm_set1_ps(slice_tx[x]);
+                    const float* c = blended + gz * row_floats + slice_x[x] * 4;
+                    const __m128 near = lerp(_mm_load_ps(c), _mm_load_ps(c + 4), tx);
+                    const __m128 far = lerp(_mm_load_ps(c + row_floats), _mm_load_ps(c + row_floats + 4), tx);
+                    const __m128 sum = lerp(near, far, tz);
+                    const __m128 weight = _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(3, 3, 3, 3));
+                    const __m128 colour = _mm_and_ps(_mm_div_ps(sum, weight), rgb_mask);
+                    _mm_storeu_ps(dst + x * 4, _mm_or_ps(colour, _mm_and_ps(pixel, alpha_mask)));
+                }
+            }
+            _mm_free(blended);
+        });
+    }
+    return true;
+}
+
+void bilateral_filter_grid(const Image& input, Image& output, float sigma_spatial, float sigma_range) {
+    BilateralGrid grid(sigma_spatial, sigma_range);
+    grid.apply(input, output);
+}
+
+void bilateral_filter_baseline(const Image& input, Image& output, float sigma_spatial, float sigma_range) {
+    ARES_TRACE_SCOPE("bilateral_filter_baseline");
+    if (input.width != output.width || input.height != output.height ||
+        !(sigma_spatial > 0.0f) || !(sigma_range > 0.0f)) {
+        return;
+    }
+
+    const int width = static_cast<int>(input.width);
+    const int height = static_cast<int>(input.height);
+    const int radius = static_cast<int>(std::ceil(3.0f * sigma_spatial));
+    const int side = 2 * radius + 1;
+    std::vector<float> spatial(side * side);
+    for (int dy = -radius; dy <= radius; ++dy) {
+        for (int dx = -radius; dx <= radius; ++dx) {
+            spatial[(dy + radius) * side + dx + radius] =
+                std::exp(-(dx * dx + dy * dy) / (2.0f * sigma_spatial * sigma_spatial));
+        }
+    }
+    const float range_scale = -1.0f / (2.0f * sigma_range * sigma_range);
+
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            const float* center = input.data + (static_cast<size_t>(y) * width + x) * 4;
+            const float l = luminance(center);
+            float sum[3] = {};
+            float total = 0.0f;
+            for (int qy = std::max(0, y - radius); qy <= std::min(height - 1, y + radius); ++qy) {
+                for (int qx = std::max(0, x - radius); qx <= std::min(width - 1, x + radius); ++qx) {
+                    const float* q = input.data + (static_cast<size_t>(qy) * width + qx) * 4;
+                    const float d = luminance(q) - l;
+                    const float w = spatial[(qy - y + radius) * side + qx - x + radius] *
+                                    std::exp(d * d * range_scale);
+                    for (int c = 0; c < 3; ++c) {
+                        sum[c] += q[c] * w;
+                    }
+                    total += w;
+                }
+            }
+            float* out = output.data + (static_cast<size_t>(y) * width + x) * 4;
+            for (int c = 0; c < 3; ++c) {
+                out[c] = sum[c] / total;
+            }
+            out[3] = center[3];
+        }
+    }
+}
+
+} // namespace ares
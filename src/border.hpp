@@ -0,0 +1,78 @@
+#pragma once
+
+// Border-mode index mapping shared by the row kernels and the front-ends.
+// Plain C++ only: included by translation units built for every ISA level.
+
+#include "ares/gaussian_blur.hpp"
+#include <cstddef>
+
+namespace ares {
+namespace detail {
+
+constexpr int BORDER_MODE_COUNT = 4;
+
+/**
+ * Map a sample index that may lie outside [0, n) back into the image.
+ * Returns -1 for BorderMode::Constant when the sample is outside, meaning
+ * "contributes zero". Only called for the border segments of a row or
+ * column; interior samples never go through here.
+ */
+template<BorderMode B>
+inline int border_index(int i, int n) {
+    if (i >= 0 && i < n) {
+        return i;
+    }
+    if constexpr (B == BorderMode::Clamp) {
+        return i < 0 ? 0 : n - 1;
+    } else if constexpr (B == BorderMode::Mirror) {
+        // Reflect without repeating the edge pixel: dcb|abcd|cba
+        if (n == 1) {
+            return 0;
+        }
+        const int period = 2 * n - 2;
+        int m = i % period;
+        if (m < 0) {
+            m += period;
+        }
+        return m < n ? m : period - m;
+    } else if constexpr (B == BorderMode::Wrap) {
+        int m = i % n;
+        return m < 0 ? m + n : m;
+    } else {
+        return -1;
+    }
+}
+
+// Runtime-mode wrapper for callers that resolve one index per row
+inline int border_index(BorderMode border, int i, int n) {
+    switch (border) {
+        case BorderMode::Mirror:   return border_index<BorderMode::Mirror>(i, n);
+        case BorderMode::Wrap:     return border_index<BorderMode::Wrap>(i, n);
+        case BorderMode::Constant: return border_index<BorderMode::Constant>(i, n);
+        case BorderMode::Clamp:    break;
+    }
+    return border_index<BorderMode::Clamp>(i, n);
+}
+
+/**
+ * Source row for each vertical tap of output row y. Rows that fall
+ * outside the image in BorderMode::Constant point at `zero_row`.
+ */
+inline void resolve_tap_rows(
+    BorderMode border,
+    const float* base,
+    size_t row_floats,
+    const float* zero_row,
+    int y,
+    int radius,
+    int height,
+    const float** tap_rows
+) {
+    for (int k = 0; k <= 2 * radius; ++k) {
+        int sy = border_index(border, y + k - radius, height);
+        tap_rows[k] = sy < 0 ? zero_row : base + static_cast<size_t>(sy) * row_floats;
+    }
+}
+
+} // namespace detail
+} // namespace ares
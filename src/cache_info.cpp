@@ -0,0 +1,158 @@
+#include "ares/tile_tuning.hpp"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+namespace ares {
+
+namespace {
+
+// sysfs sizes look like "48K", "2048K" or "1M"
+size_t parse_cache_size(const std::string& text) {
+    size_t value = 0;
+    size_t i = 0;
+    while (i < text.size() && text[i] >= '0' && text[i] <= '9') {
+        value = value * 10 + static_cast<size_t>(text[i] - '0');
+        ++i;
+    }
+    if (i < text.size()) {
+        switch (text[i]) {
+            case 'K': case 'k': value <<= 10; break;
+            case 'M': case 'm': value <<= 20; break;
+            case 'G': case 'g': value <<= 30; break;
+            default: break;
+        }
+    }
+    return value;
+}
+
+void store_level(CacheInfo& info, int level, size_t bytes) {
+    switch (level) {
+        case 1: info.l1d_bytes = bytes; break;
+        case 2: info.l2_bytes = bytes; break;
+        case 3: info.l3_bytes = bytes; break;
+        default: break;  // L4 / eDRAM is of no use for tiling
+    }
+}
+
+bool read_sysfs(CacheInfo& info) {
+#if defined(__linux__)
+    for (int index = 0; index < 16; ++index) {
+        const std::string dir = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(index) + "/";
+        std::ifstream level_file(dir + "level");
+        std::ifstream type_file(dir + "type");
+        std::ifstream size_file(dir + "size");
+        int level = 0;
+        std::string type, size;
+        if (!(level_file >> level) || !(type_file >> type) || !(size_file >> size)) {
+            break;  // indices are contiguous
+        }
+        if (type == "Instruction") {
+            continue;
+        }
+        std::ifstream line_file(dir + "coherency_line_size");
+        size_t line = 0;
+        if (line_file >> line && line > 0) {
+            info.line_bytes = line;
+        }
+        store_level(info, level, parse_cache_size(size));
+    }
+    return info.l1d_bytes > 0 && info.l2_bytes > 0;
+#else
+    (void)info;
+    return false;
+#endif
+}
+
+bool cpuid(unsigned int leaf, unsigned int subleaf, unsigned int regs[4]) {
+#ifdef _MSC_VER
+    int r[4];
+    __cpuid(r, static_cast<int>(leaf & 0x80000000u));
+    if (static_cast<unsigned int>(r[0]) < leaf) {
+        return false;
+    }
+    __cpuidex(r, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (int i = 0; i < 4; ++i) {
+        regs[i] = static_cast<unsigned int>(r[i]);
+    }
+    return true;
+#else
+    return __get_cpuid_count(leaf, subleaf, &regs[0], &regs[1], &regs[2], &regs[3]) != 0;
+#endif
+}
+
+// Deterministic cache parameters: leaf 4 on Intel, 0x8000001D on AMD
+// (same register layout)
+bool read_cpuid(CacheInfo& info) {
+    unsigned int regs[4];
+    if (!cpuid(0, 0, regs)) {
+        return false;
+    }
+    char vendor[13];
+    std::memcpy(vendor + 0, &regs[1], 4);
+    std::memcpy(vendor + 4, &regs[3], 4);
+    std::memcpy(vendor + 8, &regs[2], 4);
+    vendor[12] = '\0';
+
+    unsigned int leaf = 0;
+    if (std::strcmp(vendor, "GenuineIntel") == 0 && regs[0] >= 4) {
+        leaf = 4;
+    } else if (std::strcmp(vendor, "AuthenticAMD") == 0 || std::strcmp(vendor, "HygonGenuine") == 0) {
+        // Requires the topology extensions bit
+        if (cpuid(0x80000001u, 0, regs) && (regs[2] & (1u << 22)) != 0) {
+            leaf = 0x8000001Du;
+        }
+    }
+    if (leaf == 0) {
+        return false;
+    }
+
+    for (unsigned int sub = 0; sub < 16; ++sub) {
+        if (!cpuid(leaf, sub, regs)) {
+            break;
+        }
+        const unsigned int type = regs[0] & 0x1f;  // 1 data, 2 instruction, 3 unified
+        if (type == 0) {
+            break;
+        }
+        if (type == 2) {
+            continue;
+        }
+        const int level = static_cast<int>((regs[0] >> 5) & 0x7);
+        const size_t ways = ((regs[1] >> 22) & 0x3ff) + 1;
+        const size_t partitions = ((regs[1] >> 12) & 0x3ff) + 1;
+        const size_t line = (regs[1] & 0xfff) + 1;
+        const size_t sets = static_cast<size_t>(regs[2]) + 1;
+        info.line_bytes = line;
+        store_level(info, level, ways * partitions * line * sets);
+    }
+    return info.l1d_bytes > 0 && info.l2_bytes > 0;
+}
+
+CacheInfo detect_cache_info() {
+    CacheInfo info{ 0, 0, 0, 64, "sysfs" };
+    if (read_sysfs(info)) {
+        return info;
+    }
+    info = CacheInfo{ 0, 0, 0, 64, "cpuid" };
+    if (read_cpuid(info)) {
+        return info;
+    }
+    return CacheInfo{ size_t(32) << 10, size_t(256) << 10, size_t(8) << 20, 64, "default" };
+}
+
+} // namespace
+
+const CacheInfo& cache_info() {
+    static const CacheInfo info = detect_cache_info();
+    return info;
+}
+
+} // namespace ares
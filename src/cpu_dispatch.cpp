@@ -0,0 +1,276 @@
+#include "ares/cpu_dispatch.hpp"
+#include "ares/aes.hpp"
+#include "ares/gaussian_blur.hpp"
+#include "isa_dispatch.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+// This file is compiled for the x86-64 baseline. It must not call into a
+// kernel translation unit before checking the CPU supports that level.
+
+namespace ares {
+
+namespace {
+
+struct CpuFeatures {
+    bool sse42 = false;
+    bool aesni = false;
+    bool avx2 = false;     // AVX2 + FMA + F16C with YMM state enabled by the OS
+    bool avx512f = false;  // AVX-512F with ZMM/opmask state enabled by the OS
+    bool vaes = false;
+};
+
+CpuFeatures query_cpu_features() {
+    CpuFeatures f;
+
+#ifdef _MSC_VER
+    int regs[4];
+    __cpuid(regs, 0);
+    int max_leaf = regs[0];
+    __cpuid(regs, 1);
+    unsigned int ecx1 = static_cast<unsigned int>(regs[2]);
+    unsigned int ebx7 = 0, ecx7 = 0;
+    if (max_leaf >= 7) {
+        __cpuidex(regs, 7, 0);
+        ebx7 = static_cast<unsigned int>(regs[1]);
+        ecx7 = static_cast<unsigned int>(regs[2]);
+    }
+#else
+    unsigned int eax, ebx, ecx1, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx1, &edx)) {
+        return f;
+    }
+    unsigned int ebx7 = 0, ecx7 = 0;
+    if (!__get_cpuid_count(7, 0, &eax, &ebx7, &ecx7, &edx)) {
+        ebx7 = ecx7 = 0;
+    }
+#endif
+
+    f.sse42 = (ecx1 & (1u << 20)) != 0;
+    f.aesni = (ecx1 & (1u << 25)) != 0;
+
+    const bool osxsave = (ecx1 & (1u << 27)) != 0;
+    const bool avx = (ecx1 & (1u << 28)) != 0;
+    const bool fma = (ecx1 & (1u << 12)) != 0;
+    const bool f16c = (ecx1 & (1u << 29)) != 0;
+    if (!osxsave || !avx) {
+        return f;
+    }
+
+#ifdef _MSC_VER
+    unsigned long long xcr0 = _xgetbv(0);
+#else
+    unsigned int xcr0_lo, xcr0_hi;
+    __asm__ volatile("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+    unsigned long long xcr0 = (static_cast<unsigned long long>(xcr0_hi) << 32) | xcr0_lo;
+#endif
+
+    // XMM + YMM state for AVX2; additionally opmask + both ZMM halves for AVX-512
+    const bool os_ymm = (xcr0 & 0x6) == 0x6;
+    const bool os_zmm = (xcr0 & 0xE6) == 0xE6;
+
+    f.avx2 = os_ymm && fma && f16c && (ebx7 & (1u << 5)) != 0;
+    f.avx512f = f.avx2 && os_zmm && (ebx7 & (1u << 16)) != 0;
+    f.vaes = f.aesni && os_ymm && (ecx7 & (1u << 9)) != 0;
+    return f;
+}
+
+const CpuFeatures& cpu_features() {
+    static const CpuFeatures features = query_cpu_features();
+    return features;
+}
+
+IsaLevel detect_level() {
+    const CpuFeatures& f = cpu_features();
+#ifdef ARES_ENABLE_AVX512
+    if (f.avx512f) return IsaLevel::AVX512;
+#endif
+    if (f.avx2) return IsaLevel::AVX2;
+    if (f.sse42) return IsaLevel::SSE42;
+    return IsaLevel::Scalar;
+}
+
+// Parse ARES_FORCE_ISA; unknown values are ignored
+bool parse_level(const char* text, IsaLevel& level) {
+    if (std::strcmp(text, "scalar") == 0) {
+        level = IsaLevel::Scalar;
+    } else if (std::strcmp(text, "sse4.2") == 0 || std::strcmp(text, "sse42") == 0) {
+        level = IsaLevel::SSE42;
+    } else if (std::strcmp(text, "avx2") == 0) {
+        level = IsaLevel::AVX2;
+    } else if (std::strcmp(text, "avx512") == 0) {
+        level = IsaLevel::AVX512;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+IsaLevel clamp_level(IsaLevel level) {
+    IsaLevel max_level = detect_level();
+    return static_cast<int>(level) > static_cast<int>(max_level) ? max_level : level;
+}
+
+const detail::SeparableRowKernels& resolve_separable(IsaLevel level) {
+    switch (level) {
+#ifdef ARES_ENABLE_AVX512
+        case IsaLevel::AVX512: return detail::separable_kernels_avx512;
+#else
+        case IsaLevel::AVX512: return detail::separable_kernels_avx2;
+#endif
+        case IsaLevel::AVX2:   return detail::separable_kernels_avx2;
+        case IsaLevel::SSE42:  return detail::separable_kernels_sse42;
+        case IsaLevel::Scalar: break;
+    }
+    return detail::separable_kernels_scalar;
+}
+
+const detail::PixelConvertKernels& resolve_convert(IsaLevel level) {
+    switch (level) {
+        case IsaLevel::AVX512:
+        case IsaLevel::AVX2:   return detail::pixel_convert_kernels_avx2;
+        case IsaLevel::SSE42:  return detail::pixel_convert_kernels_sse42;
+        case IsaLevel::Scalar: break;
+    }
+    return detail::pixel_convert_kernels_scalar;
+}
+
+const detail::AesKernels aes_kernels_baseline  = { "baseline", aes_encrypt_baseline };
+const detail::AesKernels aes_kernels_aesni     = { "aes-ni", detail::aes_encrypt_aesni };
+const detail::AesKernels aes_kernels_vaes_avx2 = { "vaes-avx2", detail::aes_encrypt_vaes_avx2 };
+#ifdef ARES_ENABLE_AVX512
+const detail::AesKernels aes_kernels_vaes_avx512 = { "vaes-avx512", detail::aes_encrypt_vaes_avx512 };
+#endif
+
+const detail::AesKernels& resolve_aes(IsaLevel level) {
+    const CpuFeatures& f = cpu_features();
+    if (level == IsaLevel::Scalar || !f.aesni) {
+        return aes_kernels_baseline;
+    }
+#ifdef ARES_ENABLE_AVX512
+    if (level == IsaLevel::AVX512 && f.vaes) {
+        return aes_kernels_vaes_avx512;
+    }
+#endif
+    if (static_cast<int>(level) >= static_cast<int>(IsaLevel::AVX2) && f.vaes) {
+        return aes_kernels_vaes_avx2;
+    }
+    return aes_kernels_aesni;
+}
+
+struct KernelTable {
+    IsaLevel level;
+    const detail::SeparableRowKernels* separable;
+    const detail::AesKernels* aes;
+    const detail::PixelConvertKernels* convert;
+};
+
+KernelTable make_table(IsaLevel level) {
+    level = clamp_level(level);
+    return KernelTable{ level, &resolve_separable(level), &resolve_aes(level),
+                        &resolve_convert(level) };
+}
+
+KernelTable initial_table() {
+    IsaLevel level = detect_level();
+    if (const char* forced = std::getenv("ARES_FORCE_ISA")) {
+        IsaLevel requested;
+        if (parse_level(forced, requested)) {
+            level = requested;
+        }
+    }
+    return make_table(level);
+}
+
+// Resolved once on first use; set_isa_level() swaps in a new table
+std::atomic<const KernelTable*>& table_slot() {
+    static KernelTable initial = initial_table();
+    static std::atomic<const KernelTable*> slot{ &initial };
+    return slot;
+}
+
+const KernelTable& active_table() {
+    return *table_slot().load(std::memory_order_acquire);
+}
+
+} // namespace
+
+const char* isa_level_name(IsaLevel level) {
+    switch (level) {
+        case IsaLevel::Scalar: return "scalar";
+        case IsaLevel::SSE42:  return "sse4.2";
+        case IsaLevel::AVX2:   return "avx2";
+        case IsaLevel::AVX512: return "avx512";
+    }
+    return "unknown";
+}
+
+IsaLevel detected_isa_level() {
+    return detect_level();
+}
+
+IsaLevel active_isa_level() {
+    return active_table().level;
+}
+
+IsaLevel set_isa_level(IsaLevel level) {
+    // One immutable table per level so readers never see a torn update
+    static const KernelTable tables[] = {
+        make_table(IsaLevel::Scalar),
+        make_table(IsaLevel::SSE42),
+        make_table(IsaLevel::AVX2),
+        make_table(IsaLevel::AVX512),
+    };
+    const KernelTable* table = &tables[static_cast<int>(clamp_level(level))];
+    table_slot().store(table, std::memory_order_release);
+    return table->level;
+}
+
+const char* active_gaussian_kernel() {
+    return active_table().separable->name;
+}
+
+const char* active_aes_kernel() {
+    return active_table().aes->name;
+}
+
+const char* active_pixel_convert_kernel() {
+    return active_table().convert->name;
+}
+
+bool has_aes_ni_support() {
+    return cpu_features().aesni;
+}
+
+bool has_avx512_support() {
+    return cpu_features().avx512f;
+}
+
+namespace detail {
+
+const SeparableRowKernels& separable_kernels() {
+    return *active_table().separable;
+}
+
+const AesKernels& aes_kernels() {
+    return *active_table().aes;
+}
+
+const PixelConvertKernels& pixel_convert_kernels() {
+    return *active_table().convert;
+}
+
+const SeparableRowKernels& separable_kernels_for(IsaLevel level) {
+    return resolve_separable(clamp_level(level));
+}
+
+} // namespace detail
+
+} // namespace ares
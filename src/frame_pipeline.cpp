@@ -0,0 +1,230 @@
+#include "ares/frame_pipeline.hpp"
+#include "ares/frame_queue.hpp"
+#include "ares/trace.hpp"
+#include <immintrin.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+
+namespace ares {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// A frame between stages; input == nullptr marks the end of the stream
+struct Frame {
+    size_t index = 0;
+    Image* input = nullptr;
+    Image* output = nullptr;
+    Clock::time_point start;
+};
+
+// Wakes stages blocked on a queue. Every push or pop bumps `progress`, so
+// a stage that saw its queue full or empty sleeps on the value it read
+// before retrying and cannot miss the change that unblocks it.
+struct StageSignal {
+    std::atomic<uint32_t> progress{0};
+    std::atomic<bool> stop{false};
+
+    void notify() {
+        progress.fetch_add(1, std::memory_order_release);
+        progress.notify_all();
+    }
+
+    void request_stop() {
+        stop.store(true, std::memory_order_relaxed);
+        notify();
+    }
+
+    // Retry op until it succeeds (true) or stop is requested (false).
+    // Spins first, as a queue is often only briefly full or empty, then
+    // sleeps in the kernel: a stage can wait for a whole frame time and
+    // must not take the core from the stage it waits for.
+    template<class Op>
+    bool wait_until(Op op) {
+        for (unsigned int attempt = 0;; ++attempt) {
+            const uint32_t seen = progress.load(std::memory_order_acquire);
+            if (op()) {
+                notify();
+                return true;
+            }
+            if (stop.load(std::memory_order_relaxed)) {
+                return false;
+            }
+            if (attempt < 64) {
+                _mm_pause();
+            } else {
+                progress.wait(seen, std::memory_order_acquire);
+            }
+        }
+    }
+};
+
+// Nearest-rank percentile of sorted values
+double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    const size_t rank = static_cast<size_t>(std::ceil(p * sorted.size()));
+    return sorted[std::min(std::max(rank, size_t{1}), sorted.size()) - 1];
+}
+
+} // namespace
+
+FramePipeline::FramePipeline(size_t width, size_t height, const FramePipelineOptions& options)
+    : width_(width),
+      height_(height),
+      filter_workers_(std::max(options.filter_workers, 1u)) {
+    const size_t buffers = std::max(options.buffers, static_cast<size_t>(filter_workers_) + 2);
+    inputs_.reserve(buffers);
+    outputs_.reserve(buffers);
+    for (size_t i = 0; i < buffers; ++i) {
+        inputs_.emplace_back(width, height);
+        outputs_.emplace_back(width, height);
+    }
+}
+
+FramePipelineStats FramePipeline::run(const FrameLoader& load, const FrameFilter& filter, const FrameStorer& store) {
+    ARES_TRACE_SCOPE("frame_pipeline");
+    const size_t buffers = inputs_.size();
+    const unsigned int workers = filter_workers_;
+
+    // Free buffers, refilled from the pools on every run
+    MpmcQueue<Image*> free_inputs(buffers);
+    MpmcQueue<Image*> free_outputs(buffers);
+    for (size_t i = 0; i < buffers; ++i) {
+        Image* input = &inputs_[i];
+        Image* output = &outputs_[i];
+        free_inputs.try_push(input);
+        free_outputs.try_push(output);
+    }
+
+    // Frame n travels reader -> to_filter[n % workers] -> worker n % workers
+    // -> to_store[n % workers] -> storer
+    std::vector<std::unique_ptr<SpscQueue<Frame>>> to_filter;
+    std::vector<std::unique_ptr<SpscQueue<Frame>>> to_store;
+    for (unsigned int w = 0; w < workers; ++w) {
+        to_filter.push_back(std::make_unique<SpscQueue<Frame>>(buffers));
+        to_store.push_back(std::make_unique<SpscQueue<Frame>>(buffers));
+    }
+
+    StageSignal signal;
+    const Clock::time_point begin = Clock::now();
+
+    // The reader also takes each frame's output image, so outputs are
+    // handed out in frame order. A worker picking its own could leave the
+    // frame the storer waits for without one while later frames, queued
+    // behind it, hold them all.
+    std::thread reader([&]() {
+        ARES_TRACE_THREAD_NAME("pipeline reader");
+        for (size_t index = 0;; ++index) {
+            Frame frame;
+            frame.index = index;
+            if (!signal.wait_until([&]() { return free_inputs.try_pop(frame.input); })) {
+                return;
+            }
+            frame.start = Clock::now();
+            bool loaded;
+            {
+                ARES_TRACE_SCOPE("pipeline.load");
+                loaded = load(index, *frame.input);
+            }
+            if (!loaded) {
+                frame.input = nullptr;
+            } else if (!signal.wait_until([&]() { return free_outputs.try_pop(frame.output); })) {
+                return;
+            }
+            SpscQueue<Frame>& lane = *to_filter[index % workers];
+            if (!signal.wait_until([&]() { return lane.try_push(frame); }) || !loaded) {
+                return;
+            }
+        }
+    });
+
+    std::vector<std::thread> filter_threads;
+    filter_threads.reserve(workers);
+    for (unsigned int w = 0; w < workers; ++w) {
+        filter_threads.emplace_back([&, w]() {
+            ARES_TRACE_THREAD_NAME("pipeline filter");
+            SpscQueue<Frame>& in = *to_filter[w];
+            SpscQueue<Frame>& out = *to_store[w];
+            for (;;) {
+                Frame frame;
+                if (!signal.wait_until([&]() { return in.try_pop(frame); })) {
+                    return;
+                }
+                if (frame.input != nullptr) {
+                    {
+                        ARES_TRACE_SCOPE("pipeline.filter");
+                        filter(*frame.input, *frame.output);
+                    }
+                    // Never full: the pool has exactly `buffers` images
+                    free_inputs.try_push(frame.input);
+                    signal.notify();
+                }
+                if (!signal.wait_until([&]() { return out.try_push(frame); })) {
+                    return;
+                }
+            }
+        });
+    }
+
+    // Store on the calling thread, in frame order
+    FramePipelineStats stats;
+    std::vector<double> latencies_ms;
+    for (size_t index = 0;; ++index) {
+        Frame frame;
+        SpscQueue<Frame>& lane = *to_store[index % workers];
+        signal.wait_until([&]() { return lane.try_pop(frame); });
+        if (frame.input == nullptr) {
+            stats.completed = true;
+            break;
+        }
+        bool stored;
+        {
+            ARES_TRACE_SCOPE("pipeline.store");
+            stored = store(index, *frame.output);
+        }
+        latencies_ms.push_back(std::chrono::duration<double, std::milli>(Clock::now() - frame.start).count());
+        free_outputs.try_push(frame.output);
+        signal.notify();
+        ++stats.frames;
+        if (!stored) {
+            break;
+        }
+    }
+
+    // Stages still waiting on a queue (other filter workers at the end of
+    // the stream, everyone after an abort) give up once stop is set
+    signal.request_stop();
+    reader.join();
+    for (auto& thread : filter_threads) {
+        thread.join();
+    }
+
+    stats.seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+    stats.fps = stats.seconds > 0.0 ? stats.frames / stats.seconds : 0.0;
+    std::sort(latencies_ms.begin(), latencies_ms.end());
+    stats.latency_p50_ms = percentile(latencies_ms, 0.50);
+    stats.latency_p95_ms = percentile(latencies_ms, 0.95);
+    stats.latency_p99_ms = percentile(latencies_ms, 0.99);
+    stats.latency_max_ms = latencies_ms.empty() ? 0.0 : latencies_ms.back();
+    return stats;
+}
+
+FramePipelineStats FramePipeline::run(
+    const FrameLoader& load,
+    const FrameStorer& store,
+    float sigma,
+    BorderMode border
+) {
+    return run(load, [sigma, border](const Image& input, Image& output) {
+        gaussian_blur_tiled(input, output, sigma, border);
+    }, store);
+}
+
+} // namespace ares
@@ -1,19 +1,16 @@
 #include "ares/gaussian_blur.hpp"
+#include "ares/trace.hpp"
+#include "border.hpp"
 #include <cmath>
 #include <cstring>
 #include <algorithm>
 #include <immintrin.h>
 
-// Helper for clamping values (C++17 compatible)
-template<typename T>
-static inline T clamp(T value, T min_val, T max_val) {
-    return (value < min_val) ? min_val : ((value > max_val) ? max_val : value);
-}
-
 namespace ares {
 
 // Image implementation
 Image::Image(size_t w, size_t h) : width(w), height(h) {
+    ARES_TRACE_SCOPE("image.alloc");
     // Allocate aligned memory for SIMD operations (32-byte alignment for AVX2)
     data = static_cast<float*>(_mm_malloc(width * height * 4 * sizeof(float), 32));
     if (data) {
@@ -21,6 +18,15 @@ Image::Image(size_t w, size_t h) : width(w), height(h) {
     }
 }
 
+Image::Image(size_t w, size_t h, NoFill) : width(w), height(h) {
+    ARES_TRACE_SCOPE("image.alloc");
+    data = static_cast<float*>(_mm_malloc(width * height * 4 * sizeof(float), 32));
+}
+
+Image Image::uninitialized(size_t w, size_t h) {
+    return Image(w, h, NoFill{});
+}
+
 Image::~Image() {
     if (data) {
         _mm_free(data);
@@ -52,6 +58,7 @@ Image& Image::operator=(Image&& other) noexcept {
 
 // Generate 1D Gaussian kernel
 static void generate_gaussian_kernel(float* kernel, int radius, float sigma) {
+    ARES_TRACE_SCOPE("blur.kernel");
     float sum = 0.0f;
     int size = 2 * radius + 1;
     
@@ -67,11 +74,10 @@ static void generate_gaussian_kernel(float* kernel, int radius, float sigma) {
     }
 }
 
-void gaussian_blur_baseline(const Image& input, Image& output, float sigma) {
-    if (input.width != output.width || input.height != output.height) {
-        return; // Size mismatch
-    }
-    
+// Reference implementation: every sample goes through border_index(),
+// which is exactly what the optimized variants avoid in their interiors
+template<BorderMode B>
+static void gaussian_blur_baseline_impl(const Image& input, Image& output, float sigma) {
     const int radius = static_cast<int>(std::ceil(3.0f * sigma));
     const int kernel_size = 2 * radius + 1;
     
@@ -83,39 +89,49 @@ void gaussian_blur_baseline(const Image& input, Image& output, float sigma) {
     Image temp(input.width, input.height);
     
     // Horizontal pass
-    for (size_t y = 0; y < input.height; ++y) {
-        for (size_t x = 0; x < input.width; ++x) {
-            for (int c = 0; c < 4; ++c) { // RGBA channels
-                float sum = 0.0f;
+    {
+        ARES_TRACE_SCOPE("blur.horizontal");
+        for (size_t y = 0; y < input.height; ++y) {
+            for (size_t x = 0; x < input.width; ++x) {
+                for (int c = 0; c < 4; ++c) { // RGBA channels
+                    float sum = 0.0f;
                 
-                for (int k = -radius; k <= radius; ++k) {
-                    int sample_x = clamp(static_cast<int>(x) + k, 
-                                         0, 
-                                         static_cast<int>(input.width) - 1);
-                    size_t idx = (y * input.width + sample_x) * 4 + c;
-                    sum += input.data[idx] * kernel[k + radius];
-                }
+                    for (int k = -radius; k <= radius; ++k) {
+                        int sample_x = detail::border_index<B>(static_cast<int>(x) + k,
+                                                               static_cast<int>(input.width));
+                        if (sample_x < 0) {
+                            continue; // Constant border contributes zero
+                        }
+                        size_t idx = (y * input.width + sample_x) * 4 + c;
+                        sum += input.data[idx] * kernel[k + radius];
+                    }
                 
-                temp.data[(y * input.width + x) * 4 + c] = sum;
+                    temp.data[(y * input.width + x) * 4 + c] = sum;
+                }
             }
         }
     }
     
     // Vertical pass
-    for (size_t y = 0; y < input.height; ++y) {
-        for (size_t x = 0; x < input.width; ++x) {
-            for (int c = 0; c < 4; ++c) { // RGBA channels
-                float sum = 0.0f;
+    {
+        ARES_TRACE_SCOPE("blur.vertical");
+        for (size_t y = 0; y < input.height; ++y) {
+            for (size_t x = 0; x < input.width; ++x) {
+                for (int c = 0; c < 4; ++c) { // RGBA channels
+                    float sum = 0.0f;
                 
-                for (int k = -radius; k <= radius; ++k) {
-                    int sample_y = clamp(static_cast<int>(y) + k,
-                                         0,
-                                         static_cast<int>(input.height) - 1);
-                    size_t idx = (sample_y * input.width + x) * 4 + c;
-                    sum += temp.data[idx] * kernel[k + radius];
-                }
+                    for (int k = -radius; k <= radius; ++k) {
+                        int sample_y = detail::border_index<B>(static_cast<int>(y) + k,
+                                                               static_cast<int>(input.height));
+                        if (sample_y < 0) {
+                            continue; // Constant border contributes zero
+                        }
+                        size_t idx = (sample_y * input.width + x) * 4 + c;
+                        sum += temp.data[idx] * kernel[k + radius];
+                    }
                 
-                output.data[(y * input.width + x) * 4 + c] = sum;
+                    output.data[(y * input.width + x) * 4 + c] = sum;
+                }
             }
         }
     }
@@ -123,4 +139,26 @@ void gaussian_blur_baseline(const Image& input, Image& output, float sigma) {
     delete[] kernel;
 }
 
+void gaussian_blur_baseline(const Image& input, Image& output, float sigma, BorderMode border) {
+    ARES_TRACE_SCOPE("gaussian_blur_baseline");
+    if (input.width != output.width || input.height != output.height) {
+        return; // Size mismatch
+    }
+    
+    switch (border) {
+        case BorderMode::Clamp:
+            gaussian_blur_baseline_impl<BorderMode::Clamp>(input, output, sigma);
+            break;
+        case BorderMode::Mirror:
+            gaussian_blur_baseline_impl<BorderMode::Mirror>(input, output, sigma);
+            break;
+        case BorderMode::Wrap:
+            gaussian_blur_baseline_impl<BorderMode::Wrap>(input, output, sigma);
+            break;
+        case BorderMode::Constant:
+            gaussian_blur_baseline_impl<BorderMode::Constant>(input, output, sigma);
+            break;
+    }
+}
+
 } // namespace ares
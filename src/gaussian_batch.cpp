@@ -0,0 +1,117 @@
+#include "ares/gaussian_blur.hpp"
+#include "ares/separable_filter.hpp"
+#include "ares/tile_tuning.hpp"
+#include "ares/trace.hpp"
+#include "separable_region.hpp"
+#include "thread_pool.hpp"
+#include <immintrin.h>
+#include <algorithm>
+#include <vector>
+
+namespace ares {
+
+// Images up to this many pixels are scheduled whole; larger ones are cut
+// into row bands so a few big images cannot leave workers idle
+constexpr size_t BATCH_WHOLE_IMAGE_PIXELS = 512 * 512;
+
+// Minimum rows per band when an image is split
+constexpr size_t BATCH_MIN_BAND_ROWS = 64;
+
+// Per-worker state kept across items and across calls: the pool threads
+// are persistent, so scratch is allocated once per thread, not per image
+struct BatchScratch {
+    float* temp = nullptr;
+    size_t temp_capacity = 0;
+
+    SeparableFilter filter;
+    float filter_sigma = -1.0f;
+
+    ~BatchScratch() {
+        _mm_free(temp);
+    }
+
+    float* temp_for(size_t floats) {
+        if (floats > temp_capacity) {
+            ARES_TRACE_SCOPE("blur.temp_alloc");
+            _mm_free(temp);
+            temp = static_cast<float*>(_mm_malloc(floats * sizeof(float), 64));
+            temp_capacity = floats;
+        }
+        return temp;
+    }
+
+    // Regenerate the kernel only when sigma changes between items
+    const SeparableFilter& filter_for(float sigma) {
+        if (sigma != filter_sigma) {
+            filter = SeparableFilter::gaussian(sigma);
+            filter_sigma = sigma;
+        }
+        return filter;
+    }
+};
+
+static BatchScratch& worker_scratch() {
+    thread_local BatchScratch scratch;
+    return scratch;
+}
+
+namespace {
+
+// One schedulable unit: a whole image or a band of rows of one image
+struct BatchItem {
+    size_t job;
+    Rect rect;
+};
+
+} // namespace
+
+void gaussian_blur_batch(std::span<const BlurJob> jobs) {
+    ARES_TRACE_SCOPE("gaussian_blur_batch");
+    detail::ThreadPool& pool = detail::ThreadPool::shared();
+
+    std::vector<BatchItem> items;
+    items.reserve(jobs.size());
+    for (size_t j = 0; j < jobs.size(); ++j) {
+        const BlurJob& job = jobs[j];
+        if (!job.input || !job.output ||
+            job.input->width != job.output->width ||
+            job.input->height != job.output->height ||
+            job.input->width == 0 || job.input->height == 0) {
+            continue; // Size mismatch or empty: skipped, as in the single-image API
+        }
+
+        const size_t width = job.input->width;
+        const size_t height = job.input->height;
+        if (width * height <= BATCH_WHOLE_IMAGE_PIXELS) {
+            items.push_back(BatchItem{ j, Rect{ 0, 0, width, height } });
+            continue;
+        }
+
+        // Roughly four bands per worker for this image
+        size_t band = (height + pool.concurrency() * 4 - 1) / (pool.concurrency() * 4);
+        band = std::max(band, BATCH_MIN_BAND_ROWS);
+        for (size_t y = 0; y < height; y += band) {
+            items.push_back(BatchItem{ j, Rect{ 0, y, width, std::min(band, height - y) } });
+        }
+    }
+
+    // Kernels are resolved once for the whole batch
+    const detail::SeparableRowKernels& kernels = detail::separable_kernels();
+
+    pool.parallel_for(items.size(), [&](size_t i, unsigned int) {
+        ARES_TRACE_SCOPE("batch.item");
+        const BatchItem& item = items[i];
+        const BlurJob& job = jobs[item.job];
+        BatchScratch& scratch = worker_scratch();
+
+        const SeparableFilter& filter = scratch.filter_for(job.sigma);
+        float* temp = scratch.temp_for(detail::region_temp_floats(item.rect, filter));
+
+        // Decided per image, so all bands of one image agree
+        detail::filter_region_tiled(kernels, *job.input, *job.output, item.rect,
+                                    filter, job.border, temp,
+                                    gaussian_streams_output(job.output->size_bytes()));
+    });
+}
+
+} // namespace ares
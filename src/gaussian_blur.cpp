@@ -0,0 +1,66 @@
+#include "ares/gaussian_blur.hpp"
+#include "ares/separable_filter.hpp"
+#include "ares/trace.hpp"
+#include "separable_region.hpp"
+
+// Gaussian front-ends: a SeparableFilter::gaussian() kernel run through the
+// separable filter engine. The Gaussian taps are mirror images, so every
+// variant gets the folded (Even symmetry) row kernels, and sigmas up to
+// 1 hit the unrolled 3-, 5- and 7-tap instantiations.
+
+namespace ares {
+
+void gaussian_blur_simd(const Image& input, Image& output, float sigma, BorderMode border) {
+    ARES_TRACE_SCOPE("gaussian_blur_simd");
+    separable_filter_simd(input, output, SeparableFilter::gaussian(sigma), border);
+}
+
+void gaussian_blur_avx512(const Image& input, Image& output, float sigma, BorderMode border) {
+    ARES_TRACE_SCOPE("gaussian_blur_avx512");
+    if (input.width != output.width || input.height != output.height) {
+        return;
+    }
+
+    // Clamped to AVX2 on hosts (or compilers) without AVX-512
+    detail::filter_image(detail::separable_kernels_for(IsaLevel::AVX512), input.data, output.data,
+                         input.width, input.height, ChannelLayout::RGBA,
+                         SeparableFilter::gaussian(sigma), border);
+}
+
+void gaussian_blur_tiled(const Image& input, Image& output, float sigma, BorderMode border) {
+    ARES_TRACE_SCOPE("gaussian_blur_tiled");
+    separable_filter_tiled(input, output, SeparableFilter::gaussian(sigma), border);
+}
+
+void gaussian_blur_transposed(const Image& input, Image& output, float sigma, BorderMode border) {
+    ARES_TRACE_SCOPE("gaussian_blur_transposed");
+    separable_filter_transposed(input, output, SeparableFilter::gaussian(sigma), border);
+}
+
+void gaussian_blur_roi(
+    const Image& input,
+    Image& output,
+    const Rect& roi,
+    float sigma,
+    BorderMode border
+) {
+    gaussian_blur_rois(input, output, std::span<const Rect>(&roi, 1), sigma, border);
+}
+
+void gaussian_blur_rois(
+    const Image& input,
+    Image& output,
+    std::span<const Rect> rois,
+    float sigma,
+    BorderMode border
+) {
+    ARES_TRACE_SCOPE("gaussian_blur_rois");
+    separable_filter_rois(input, output, rois, SeparableFilter::gaussian(sigma), border);
+}
+
+void gaussian_blur_multithreaded(const Image& input, Image& output, float sigma, BorderMode border) {
+    ARES_TRACE_SCOPE("gaussian_blur_multithreaded");
+    separable_filter_multithreaded(input, output, SeparableFilter::gaussian(sigma), border);
+}
+
+} // namespace ares
@@ -0,0 +1,137 @@
+#include "ares/gaussian_incremental.hpp"
+#include "ares/trace.hpp"
+#include "separable_region.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace ares {
+
+/**
+ * Outputs along an axis of n samples whose taps (radius r) read samples in
+ * [begin, end). Clamp, Constant and a single Mirror reflection keep every
+ * dependency within r samples; Wrap, and Mirror folding more than once,
+ * reach the far edge, so an apron that leaves the axis takes all of it.
+ */
+static void affected_span(BorderMode border, int begin, int end, int r, int n, int& out_begin, int& out_end) {
+    const bool leaves_axis = begin - r < 0 || end + r > n;
+    const bool reaches_far_edge = border == BorderMode::Wrap || (border == BorderMode::Mirror && r > n - 1);
+    if (leaves_axis && reaches_far_edge) {
+        out_begin = 0;
+        out_end = n;
+        return;
+    }
+    out_begin = std::max(begin - r, 0);
+    out_end = std::min(end + r, n);
+}
+
+IncrementalBlur::IncrementalBlur(float sigma, BorderMode border)
+    : IncrementalBlur(SeparableFilter::gaussian(sigma), border) {}
+
+IncrementalBlur::IncrementalBlur(const SeparableFilter& filter, BorderMode border)
+    : filter_(filter),
+      border_(border),
+      input_(0, 0),
+      intermediate_(0, 0),
+      output_(0, 0),
+      tap_rows_(filter.vertical().size()) {}
+
+void IncrementalBlur::reset(const Image& input) {
+    ARES_TRACE_SCOPE("gaussian_blur_incremental.reset");
+    if (input.width == 0 || input.height == 0 || !filter_.valid()) {
+        return;
+    }
+
+    if (input_.width != input.width || input_.height != input.height) {
+        input_ = Image::uninitialized(input.width, input.height);
+        intermediate_ = Image::uninitialized(input.width, input.height);
+        output_ = Image::uninitialized(input.width, input.height);
+        zero_row_.assign(border_ == BorderMode::Constant ? input.width * 4 : 0, 0.0f);
+    }
+    std::memcpy(input_.data, input.data, input.size_bytes());
+
+    const Rect all = { 0, 0, input.width, input.height };
+    recomputed_pixels_ = 0;
+    filter_rows(all);
+    filter_columns(all);
+}
+
+bool IncrementalBlur::update(const Image& input, std::span<const Rect> dirty) {
+    ARES_TRACE_SCOPE("gaussian_blur_incremental");
+    if (!valid() || input.width != input_.width || input.height != input_.height) {
+        return false;
+    }
+
+    const int w = static_cast<int>(input_.width);
+    const int h = static_cast<int>(input_.height);
+    const size_t row_floats = input_.width * 4;
+    recomputed_pixels_ = 0;
+
+    // All changes first: the row apron of one rectangle can read pixels of
+    // another
+    for (const Rect& rect : dirty) {
+        const Rect r = detail::clip_rect(rect, input_);
+        for (size_t y = r.y; y < r.y + r.height; ++y) {
+            std::memcpy(input_.data + y * row_floats + r.x * 4, input.data + y * row_floats + r.x * 4,
+                        r.width * 4 * sizeof(float));
+        }
+    }
+
+    // Intermediate: dirty rows, widened by the horizontal apron. Every
+    // region is refreshed before any column reads it.
+    vertical_regions_.clear();
+    for (const Rect& rect : dirty) {
+        const Rect r = detail::clip_rect(rect, input_);
+        if (r.width == 0 || r.height == 0) {
+            continue;
+        }
+        int x_begin, x_end, y_begin, y_end;
+        affected_span(border_, static_cast<int>(r.x), static_cast<int>(r.x + r.width),
+                      filter_.horizontal_radius(), w, x_begin, x_end);
+        affected_span(border_, static_cast<int>(r.y), static_cast<int>(r.y + r.height),
+                      filter_.vertical_radius(), h, y_begin, y_end);
+        const size_t columns = static_cast<size_t>(x_end - x_begin);
+        filter_rows({ static_cast<size_t>(x_begin), r.y, columns, r.height });
+        vertical_regions_.push_back({ static_cast<size_t>(x_begin), static_cast<size_t>(y_begin),
+                                      columns, static_cast<size_t>(y_end - y_begin) });
+    }
+
+    // Output: the refreshed columns, widened by the vertical apron
+    for (const Rect& region : vertical_regions_) {
+        filter_columns(region);
+    }
+    return true;
+}
+
+void IncrementalBlur::filter_rows(const Rect& region) {
+    ARES_TRACE_SCOPE("blur.horizontal");
+    const size_t row_floats = input_.width * 4;
+    const detail::HorizontalRowFn horizontal =
+        detail::separable_kernels().horizontal_for(border_, ChannelLayout::RGBA, filter_);
+    const int x_begin = static_cast<int>(region.x);
+    const int x_end = static_cast<int>(region.x + region.width);
+
+    for (size_t y = region.y; y < region.y + region.height; ++y) {
+        horizontal(input_.data + y * row_floats, intermediate_.data + y * row_floats + region.x * 4,
+                   static_cast<int>(input_.width), x_begin, x_end,
+                   filter_.horizontal().data(), filter_.horizontal_radius());
+    }
+    recomputed_pixels_ += region.width * region.height;
+}
+
+void IncrementalBlur::filter_columns(const Rect& region) {
+    ARES_TRACE_SCOPE("blur.vertical");
+    const size_t row_floats = input_.width * 4;
+    const detail::VerticalRowFn vertical = detail::separable_kernels().vertical_for(false, filter_);
+
+    for (size_t y = region.y; y < region.y + region.height; ++y) {
+        detail::resolve_tap_rows(border_, intermediate_.data, row_floats, zero_row_.data(),
+                                 static_cast<int>(y), filter_.vertical_radius(),
+                                 static_cast<int>(input_.height), tap_rows_.data());
+        vertical(tap_rows_.data(), output_.data + y * row_floats, region.x * 4,
+                 (region.x + region.width) * 4, filter_.vertical().data(),
+                 static_cast<int>(tap_rows_.size()));
+    }
+    recomputed_pixels_ += region.width * region.height;
+}
+
+} // namespace ares
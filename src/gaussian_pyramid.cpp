@@ -0,0 +1,138 @@
+#include "ares/gaussian_pyramid.hpp"
+#include "ares/separable_filter.hpp"
+#include "ares/trace.hpp"
+#include "isa_dispatch.hpp"
+#include "thread_pool.hpp"
+#include <immintrin.h>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace ares {
+
+// Levels with fewer source pixels than this are built on the calling
+// thread: waking the pool costs more than the level itself
+constexpr size_t PYRAMID_SERIAL_PIXELS = 256 * 256;
+
+// Minimum rows per band when a pass is split across the pool
+constexpr size_t PYRAMID_MIN_BAND_ROWS = 16;
+
+// Arena blocks start on a cache line
+static size_t round_to_line(size_t floats) {
+    return (floats + 15) / 16 * 16;
+}
+
+GaussianPyramid::~GaussianPyramid() {
+    _mm_free(arena_);
+}
+
+GaussianPyramid::GaussianPyramid(GaussianPyramid&& other) noexcept
+    : levels_(std::move(other.levels_)), arena_(other.arena_), arena_floats_(other.arena_floats_) {
+    other.arena_ = nullptr;
+    other.arena_floats_ = 0;
+}
+
+GaussianPyramid& GaussianPyramid::operator=(GaussianPyramid&& other) noexcept {
+    if (this != &other) {
+        _mm_free(arena_);
+        levels_ = std::move(other.levels_);
+        arena_ = other.arena_;
+        arena_floats_ = other.arena_floats_;
+        other.arena_ = nullptr;
+        other.arena_floats_ = 0;
+    }
+    return *this;
+}
+
+void GaussianPyramid::build(const Image& base, size_t levels, float sigma, BorderMode border) {
+    ARES_TRACE_SCOPE("GaussianPyramid::build");
+    levels_.clear();
+    if (levels == 0 || base.width == 0 || base.height == 0 || !(sigma > 0.0f)) {
+        return;
+    }
+
+    // Same taps as the blur front-ends, so levels match gaussian_blur_simd()
+    const SeparableFilter filter = SeparableFilter::gaussian(sigma);
+    const float* kernel = filter.horizontal().data();
+    const int radius = filter.horizontal_radius();
+    const int kernel_size = static_cast<int>(filter.horizontal().size());
+
+    // Arena layout: levels 1..n-1, then horizontal-pass scratch sized for
+    // the first (largest) level
+    levels_.push_back(PyramidLevel{ base.width, base.height, base.data });
+    size_t needed = 0;
+    std::vector<size_t> offsets(1, 0);  // level 0 is not in the arena
+    for (size_t w = base.width, h = base.height; offsets.size() < levels && (w > 1 || h > 1);) {
+        w = (w + 1) / 2;
+        h = (h + 1) / 2;
+        offsets.push_back(needed);
+        needed += round_to_line(w * h * 4);
+    }
+    const size_t scratch_offset = needed;
+    needed += base.height * ((base.width + 1) / 2) * 4;
+
+    if (needed > arena_floats_) {
+        ARES_TRACE_SCOPE("blur.temp_alloc");
+        _mm_free(arena_);
+        arena_ = static_cast<float*>(_mm_malloc(needed * sizeof(float), 64));
+        arena_floats_ = needed;
+    }
+
+    // Gaussian taps are exact mirror images, so the folded row kernels apply
+    const detail::SeparableRowKernels& kernels = detail::separable_kernels();
+    const detail::HorizontalRowFn horizontal_down =
+        kernels.horizontal_down_for(border, filter.horizontal_symmetry(), kernel_size);
+    const detail::VerticalRowFn vertical = kernels.vertical_for(false, filter);
+    float* temp = arena_ + scratch_offset;
+
+    // Per-worker tap row pointers for the vertical pass
+    const unsigned int workers = detail::ThreadPool::shared().concurrency();
+    std::vector<std::vector<const float*>> tap_rows(workers, std::vector<const float*>(kernel_size));
+
+    for (size_t n = 1; n < offsets.size(); ++n) {
+        ARES_TRACE_SCOPE("pyramid.level");
+        const PyramidLevel src = levels_[n - 1];
+        const size_t dst_width = (src.width + 1) / 2;
+        const size_t dst_height = (src.height + 1) / 2;
+        float* dst = arena_ + offsets[n];
+
+        const int src_width = static_cast<int>(src.width);
+        const int src_height = static_cast<int>(src.height);
+        const size_t src_row_floats = src.width * 4;
+        const size_t dst_row_floats = dst_width * 4;
+        const size_t min_rows = src.width * src.height >= PYRAMID_SERIAL_PIXELS
+            ? PYRAMID_MIN_BAND_ROWS
+            : SIZE_MAX;
+
+        // Horizontal pass: every source row, every other column
+        {
+            ARES_TRACE_SCOPE("blur.horizontal");
+            detail::parallel_chunks(src.height, min_rows, [&](size_t begin, size_t end, unsigned int) {
+                for (size_t y = begin; y < end; ++y) {
+                    horizontal_down(src.data + y * src_row_floats, temp + y * dst_row_floats,
+                                    src_width, 0, static_cast<int>(dst_width), kernel, radius);
+                }
+            });
+        }
+
+        // Vertical pass: every other row of the half-width scratch
+        std::vector<float> zero_row(border == BorderMode::Constant ? dst_row_floats : 0, 0.0f);
+        {
+            ARES_TRACE_SCOPE("blur.vertical");
+            detail::parallel_chunks(dst_height, min_rows, [&](size_t begin, size_t end, unsigned int worker) {
+                const float** rows = tap_rows[worker].data();
+                for (size_t y = begin; y < end; ++y) {
+                    detail::resolve_tap_rows(border, temp, dst_row_floats, zero_row.data(),
+                                             static_cast<int>(2 * y), radius, src_height, rows);
+                    vertical(rows, dst + y * dst_row_floats, 0, dst_row_floats,
+                             kernel, kernel_size);
+                }
+            });
+        }
+
+        levels_.push_back(PyramidLevel{ dst_width, dst_height, dst });
+    }
+}
+
+} // namespace ares
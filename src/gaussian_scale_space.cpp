@@ -0,0 +1,227 @@
+#include "ares/gaussian_scale_space.hpp"
+#include "ares/separable_filter.hpp"
+#include "ares/tile_tuning.hpp"
+#include "ares/trace.hpp"
+#include "isa_dispatch.hpp"
+#include "thread_pool.hpp"
+#include <immintrin.h>
+#include <algorithm>
+#include <vector>
+
+namespace ares {
+
+// Per-worker scratch: a rolling window of horizontally blurred strip rows
+// per sigma, tap pointers, and two strip rows for forming differences
+struct ScaleScratch {
+    std::vector<float*> windows;
+    std::vector<const float*> rows;
+    float* blurred[2] = { nullptr, nullptr };
+
+    ScaleScratch() = default;
+    ScaleScratch(const ScaleScratch&) = delete;
+    ScaleScratch& operator=(const ScaleScratch&) = delete;
+
+    ~ScaleScratch() {
+        for (float* w : windows) {
+            _mm_free(w);
+        }
+        _mm_free(blurred[0]);
+        _mm_free(blurred[1]);
+    }
+};
+
+// Shared by gaussian_blur_multi() (difference = false: outputs[s] gets
+// sigma s) and difference_of_gaussians() (outputs[s] gets s + 1 minus s).
+//
+// The image is cut into column strips, walked top to bottom. Input row p
+// of a strip is convolved by every horizontal kernel while it is in L1,
+// into one rolling window per sigma; output row p - max_radius is then
+// ready for every sigma at once, so all vertical kernels (and the
+// differences) run on the same row. Windows hold r + max_radius + 1 rows,
+// enough for the widest lag, and the strip is narrow enough for all of
+// them to stay in L2. Columns need no apron, so strips repeat no work;
+// row bands (only used when there are too few strips to keep the pool
+// busy) recompute 2 * max_radius rows each.
+static void blur_scale_space(
+    const Image& input,
+    std::span<Image* const> outputs,
+    std::span<const float> sigmas,
+    BorderMode border,
+    bool difference
+) {
+    const size_t scales = sigmas.size();
+    const int width = static_cast<int>(input.width);
+    const int height = static_cast<int>(input.height);
+    const size_t row_floats = input.width * 4;
+
+    // One filter and its row functions per sigma
+    std::vector<SeparableFilter> filters;
+    for (float sigma : sigmas) {
+        filters.push_back(SeparableFilter::gaussian(sigma));
+    }
+    int max_radius = 0;
+    for (const SeparableFilter& f : filters) {
+        max_radius = std::max(max_radius, f.vertical_radius());
+    }
+    std::vector<size_t> window_rows;
+    size_t total_window_rows = 0;
+    for (const SeparableFilter& f : filters) {
+        window_rows.push_back(static_cast<size_t>(f.vertical_radius() + max_radius + 1));
+        total_window_rows += window_rows.back();
+    }
+
+    // Strip width: every window in the L2 share of the tile policy, in
+    // whole cache lines
+    const CacheInfo& cache = cache_info();
+    const size_t line_pixels = std::max<size_t>(1, cache.line_bytes / (4 * sizeof(float)));
+    const size_t l2_budget = static_cast<size_t>(static_cast<double>(cache.l2_bytes) * tile_policy().l2_fraction);
+    size_t strip = l2_budget / (total_window_rows * 4 * sizeof(float));
+    strip = std::max(line_pixels, strip / line_pixels * line_pixels);
+    strip = std::min(strip, input.width);
+    const size_t strips = (input.width + strip - 1) / strip;
+
+    // Row bands only to feed idle workers, and never shorter than 8 apron
+    // heights so the recomputed rows stay a small fraction
+    detail::ThreadPool& pool = detail::ThreadPool::shared();
+    size_t bands = (pool.concurrency() * 4 + strips - 1) / strips;
+    bands = std::min(bands, std::max<size_t>(1, input.height / (16 * static_cast<size_t>(max_radius) + 1)));
+    const size_t band = (input.height + bands - 1) / bands;
+    bands = (input.height + band - 1) / band;
+
+    // Plain blurs stream once the whole stack outgrows the LLC
+    const bool stream = !difference && gaussian_streams_output(input.size_bytes() * scales);
+    const detail::SeparableRowKernels& row_kernels = detail::separable_kernels();
+    std::vector<detail::HorizontalRowFn> horizontal;
+    std::vector<detail::VerticalRowFn> vertical;
+    for (const SeparableFilter& f : filters) {
+        horizontal.push_back(row_kernels.horizontal_for(border, ChannelLayout::RGBA, f));
+        vertical.push_back(row_kernels.vertical_for(stream, f));
+    }
+
+    std::vector<ScaleScratch> scratch(pool.concurrency());
+
+    pool.parallel_for(strips * bands, [&](size_t item, unsigned int worker) {
+        ARES_TRACE_SCOPE("scale.strip");
+        const size_t x0 = (item % strips) * strip;
+        const size_t x1 = std::min(x0 + strip, input.width);
+        const int y0 = static_cast<int>((item / strips) * band);
+        const int y1 = std::min(y0 + static_cast<int>(band), height);
+        const size_t strip_floats = (x1 - x0) * 4;
+        const size_t window_floats = strip * 4;
+
+        ScaleScratch& s = scratch[worker];
+        if (s.windows.empty()) {
+            ARES_TRACE_SCOPE("blur.temp_alloc");
+            for (size_t rows : window_rows) {
+                s.windows.push_back(static_cast<float*>(
+                    _mm_malloc(rows * window_floats * sizeof(float), 64)));
+            }
+            s.rows.resize(2 * max_radius + 1);
+            s.blurred[0] = static_cast<float*>(_mm_malloc(window_floats * sizeof(float), 64));
+            s.blurred[1] = static_cast<float*>(_mm_malloc(window_floats * sizeof(float), 64));
+        }
+
+        // Window row holding input position p for sigma k (p may be
+        // negative; positions are offset so the modulus is not)
+        auto window_row = [&](size_t k, int p) {
+            const size_t slot = static_cast<size_t>(p - y0 + max_radius) % window_rows[k];
+            return s.windows[k] + slot * window_floats;
+        };
+
+        for (int p = y0 - max_radius; p < y1 + max_radius; ++p) {
+            const int sy = detail::border_index(border, p, height);
+            const float* src = sy < 0 ? nullptr : input.data + sy * row_floats;
+
+            // Horizontal: this input row, every sigma whose window reaches it
+            for (size_t k = 0; k < scales; ++k) {
+                const int r = filters[k].horizontal_radius();
+                if (p < y0 - r || p >= y1 + r) {
+                    continue;
+                }
+                float* dst = window_row(k, p);
+                if (!src) {
+                    // Constant border: the whole row is outside the image
+                    std::fill(dst, dst + strip_floats, 0.0f);
+                    continue;
+                }
+                horizontal[k](src, dst, width, static_cast<int>(x0), static_cast<int>(x1),
+                              filters[k].horizontal().data(), r);
+            }
+
+            // Vertical: output row y for every sigma
+            const int y = p - max_radius;
+            if (y < y0) {
+                continue;
+            }
+            for (size_t k = 0; k < scales; ++k) {
+                const int r = filters[k].vertical_radius();
+                const int taps = 2 * r + 1;
+                const float* kernel = filters[k].vertical().data();
+                for (int t = 0; t < taps; ++t) {
+                    s.rows[t] = window_row(k, y - r + t);
+                }
+
+                if (!difference) {
+                    vertical[k](s.rows.data(), outputs[k]->data + y * row_floats + x0 * 4,
+                                0, strip_floats, kernel, taps);
+                    continue;
+                }
+
+                // Blurred rows alternate between two buffers; from the
+                // second sigma on, write the difference
+                float* cur = s.blurred[k & 1];
+                vertical[k](s.rows.data(), cur, 0, strip_floats, kernel, taps);
+                if (k > 0) {
+                    const float* prev = s.blurred[(k - 1) & 1];
+                    float* out = outputs[k - 1]->data + y * row_floats + x0 * 4;
+                    for (size_t i = 0; i < strip_floats; ++i) {
+                        out[i] = cur[i] - prev[i];
+                    }
+                }
+            }
+        }
+
+        if (stream) {
+            _mm_sfence();
+        }
+    });
+}
+
+static bool outputs_match(const Image& input, std::span<Image* const> outputs) {
+    for (const Image* out : outputs) {
+        if (!out || out->width != input.width || out->height != input.height) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void gaussian_blur_multi(
+    const Image& input,
+    std::span<Image* const> outputs,
+    std::span<const float> sigmas,
+    BorderMode border
+) {
+    ARES_TRACE_SCOPE("gaussian_blur_multi");
+    if (sigmas.empty() || outputs.size() != sigmas.size() || !outputs_match(input, outputs) ||
+        input.width == 0 || input.height == 0) {
+        return;
+    }
+    blur_scale_space(input, outputs, sigmas, border, false);
+}
+
+void difference_of_gaussians(
+    const Image& input,
+    std::span<Image* const> outputs,
+    std::span<const float> sigmas,
+    BorderMode border
+) {
+    ARES_TRACE_SCOPE("difference_of_gaussians");
+    if (sigmas.size() < 2 || outputs.size() != sigmas.size() - 1 || !outputs_match(input, outputs) ||
+        input.width == 0 || input.height == 0) {
+        return;
+    }
+    blur_scale_space(input, outputs, sigmas, border, true);
+}
+
+} // namespace ares
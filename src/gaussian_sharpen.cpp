@@ -0,0 +1,83 @@
+#include "ares/gaussian_sharpen.hpp"
+#include "ares/separable_filter.hpp"
+#include "ares/tile_tuning.hpp"
+#include "ares/trace.hpp"
+#include "separable_region.hpp"
+#include "thread_pool.hpp"
+#include <immintrin.h>
+#include <algorithm>
+
+namespace ares {
+
+// Below this many pixels the image is sharpened as one band on the
+// calling thread: waking the pool costs more than it saves
+constexpr size_t SHARPEN_SERIAL_PIXELS = 256 * 256;
+
+// Band temp kept per thread across calls; the pool threads are
+// persistent, so it is allocated once per thread, not per band
+struct SharpenScratch {
+    float* temp = nullptr;
+    size_t capacity = 0;
+
+    ~SharpenScratch() {
+        _mm_free(temp);
+    }
+
+    float* temp_for(size_t floats) {
+        if (floats > capacity) {
+            ARES_TRACE_SCOPE("blur.temp_alloc");
+            _mm_free(temp);
+            temp = static_cast<float*>(_mm_malloc(floats * sizeof(float), 64));
+            capacity = floats;
+        }
+        return temp;
+    }
+};
+
+static SharpenScratch& worker_scratch() {
+    thread_local SharpenScratch scratch;
+    return scratch;
+}
+
+void unsharp_mask(
+    const Image& input,
+    Image& output,
+    float sigma,
+    float amount,
+    float threshold,
+    BorderMode border
+) {
+    ARES_TRACE_SCOPE("unsharp_mask");
+    if (input.width != output.width || input.height != output.height ||
+        input.width == 0 || input.height == 0) {
+        return;
+    }
+
+    const SeparableFilter filter = SeparableFilter::gaussian(sigma);
+    const detail::SharpenParams params{ amount, threshold };
+    const detail::SeparableRowKernels& kernels = detail::separable_kernels();
+    const bool stream = gaussian_streams_output(output.size_bytes());
+
+    // One band of rows per worker, each a tiled region with its own
+    // 2 * radius apron rows of horizontal pass
+    detail::ThreadPool& pool = detail::ThreadPool::shared();
+    const bool parallel = input.width * input.height >= SHARPEN_SERIAL_PIXELS;
+    const size_t workers = parallel ? pool.concurrency() : 1;
+    const size_t band = (input.height + workers - 1) / workers;
+    const size_t bands = (input.height + band - 1) / band;
+
+    auto sharpen_band = [&](size_t b) {
+        ARES_TRACE_SCOPE("sharpen.band");
+        const Rect roi{ 0, b * band, input.width, std::min(band, input.height - b * band) };
+        float* temp = worker_scratch().temp_for(detail::region_temp_floats(roi, filter));
+        detail::filter_region_tiled(kernels, input, output, roi, filter, border, temp, stream, &params);
+    };
+
+    if (bands == 1) {
+        sharpen_band(0);
+        return;
+    }
+    pool.parallel_for(bands, [&](size_t b, unsigned int) { sharpen_band(b); });
+}
+
+} // namespace ares
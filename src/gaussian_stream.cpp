@@ -0,0 +1,101 @@
+#include "ares/gaussian_stream.hpp"
+#include "ares/separable_filter.hpp"
+#include "ares/trace.hpp"
+#include "isa_dispatch.hpp"
+#include <immintrin.h>
+#include <algorithm>
+#include <vector>
+
+namespace ares {
+
+bool gaussian_blur_stream(
+    size_t width,
+    size_t height,
+    const RowSource& source,
+    const RowSink& sink,
+    float sigma,
+    BorderMode border
+) {
+    // One span for the whole stream: per-row spans would flood the buffers
+    ARES_TRACE_SCOPE("gaussian_blur_stream");
+    if (width == 0 || height == 0 || border == BorderMode::Wrap) {
+        return false;
+    }
+
+    const SeparableFilter filter = SeparableFilter::gaussian(sigma);
+    const detail::SeparableRowKernels& kernels = detail::separable_kernels();
+    const detail::HorizontalRowFn horizontal = kernels.horizontal_for(border, ChannelLayout::RGBA, filter);
+    const detail::VerticalRowFn vertical = kernels.vertical_for(false, filter);
+
+    const float* kernel = filter.horizontal().data();
+    const int radius = filter.horizontal_radius();
+    const int kernel_size = 2 * radius + 1;
+    const int w = static_cast<int>(width);
+    const int h = static_cast<int>(height);
+    const size_t row_floats = width * 4;
+
+    // Rolling window of horizontally blurred rows: row sy lives in slot
+    // sy % window. Output row y needs rows [y - radius, y + radius] (border
+    // taps map back into that range for Clamp and Mirror), and the window
+    // always holds the last `window` rows read, so every tap is resident.
+    const int window = std::min(kernel_size, h);
+
+    float* ring = static_cast<float*>(
+        _mm_malloc(static_cast<size_t>(window) * row_floats * sizeof(float), 64));
+    float* in_row = static_cast<float*>(_mm_malloc(row_floats * sizeof(float), 64));
+    float* out_row = static_cast<float*>(_mm_malloc(row_floats * sizeof(float), 64));
+    std::vector<float> zero_row(border == BorderMode::Constant ? row_floats : 0, 0.0f);
+    std::vector<const float*> rows(kernel_size);
+
+    bool ok = true;
+    int next_in = 0;
+    for (int y = 0; y < h && ok; ++y) {
+        // Pull input until the bottom tap of this output row is resident
+        const int need = std::min(y + radius, h - 1);
+        while (next_in <= need) {
+            if (!source(in_row)) {
+                ok = false;
+                break;
+            }
+            horizontal(in_row, ring + static_cast<size_t>(next_in % window) * row_floats,
+                       w, 0, w, kernel, radius);
+            ++next_in;
+        }
+        if (!ok) {
+            break;
+        }
+
+        for (int k = 0; k < kernel_size; ++k) {
+            int sy = detail::border_index(border, y + k - radius, h);
+            rows[k] = sy < 0 ? zero_row.data()
+                             : ring + static_cast<size_t>(sy % window) * row_floats;
+        }
+        vertical(rows.data(), out_row, 0, row_floats, filter.vertical().data(), kernel_size);
+
+        ok = sink(out_row);
+    }
+
+    _mm_free(out_row);
+    _mm_free(in_row);
+    _mm_free(ring);
+    return ok;
+}
+
+bool gaussian_blur_stream(
+    ImageRowReader& reader,
+    ImageRowWriter& writer,
+    float sigma,
+    BorderMode border
+) {
+    if (reader.width() != writer.width() || reader.height() != writer.height()) {
+        return false;
+    }
+
+    return gaussian_blur_stream(
+        reader.width(), reader.height(),
+        [&](float* row) { return reader.read_row(row); },
+        [&](const float* row) { return writer.write_row(row); },
+        sigma, border);
+}
+
+} // namespace ares
@@ -0,0 +1,115 @@
+#pragma once
+
+// PPM (P6) / PFM (PF) header parsing shared by the whole-image loader and
+// the row reader, which read it from a memory mapping and a stream.
+
+#include "ares/image_io.hpp"
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace ares {
+namespace detail {
+
+struct ImageFileHeader {
+    ImageFileFormat format = ImageFileFormat::PPM;
+    size_t width = 0;
+    size_t height = 0;
+    bool little_endian = true;   // PFM only
+
+    size_t sample_bytes() const {
+        return format == ImageFileFormat::PPM ? 1 : sizeof(float);
+    }
+    size_t row_bytes() const { return width * 3 * sample_bytes(); }
+    size_t data_bytes() const { return row_bytes() * height; }
+};
+
+/**
+ * True if width x height RGBA float pixels can be addressed without size_t
+ * overflow. Every size derived from a header (file rows, the decoded Image)
+ * is at most that large, so the header must pass this before any of them
+ * is computed.
+ */
+inline bool image_size_fits(size_t width, size_t height) {
+    return width > 0 && height > 0 && width <= SIZE_MAX / (4 * sizeof(float)) / height;
+}
+
+/**
+ * Next whitespace-separated header token, skipping '#' comments. `get`
+ * returns the next byte or EOF. The single whitespace byte that ends the
+ * token is consumed, so after the last header field the source sits on
+ * the first sample.
+ */
+template<class GetByte>
+bool read_header_token(GetByte& get, std::string& token) {
+    token.clear();
+    int c = get();
+    for (;;) {
+        while (c != EOF && std::isspace(c)) {
+            c = get();
+        }
+        if (c != '#') {
+            break;
+        }
+        while (c != EOF && c != '\n') {
+            c = get();
+        }
+    }
+    while (c != EOF && !std::isspace(c)) {
+        token.push_back(static_cast<char>(c));
+        c = get();
+    }
+    return !token.empty();
+}
+
+inline bool parse_dimension(const std::string& token, size_t& value) {
+    char* end = nullptr;
+    unsigned long long v = std::strtoull(token.c_str(), &end, 10);
+    if (end == token.c_str() || *end != '\0' || v == 0 || v > SIZE_MAX) {
+        return false;
+    }
+    value = static_cast<size_t>(v);
+    return true;
+}
+
+/**
+ * Parse a P6 (maxval 255) or PF header. Rejects anything else, and sizes
+ * that fail image_size_fits().
+ */
+template<class GetByte>
+bool parse_image_header(GetByte&& get, ImageFileHeader& header) {
+    std::string magic, w, h, last;
+    if (!read_header_token(get, magic) || !read_header_token(get, w) ||
+        !read_header_token(get, h) || !read_header_token(get, last)) {
+        return false;
+    }
+    if (!parse_dimension(w, header.width) || !parse_dimension(h, header.height) ||
+        !image_size_fits(header.width, header.height)) {
+        return false;
+    }
+
+    if (magic == "P6") {
+        if (last != "255") {
+            return false;  // 16-bit PPM is not supported
+        }
+        header.format = ImageFileFormat::PPM;
+        header.little_endian = true;
+    } else if (magic == "PF") {
+        // Negative scale means little-endian samples
+        char* end = nullptr;
+        double scale = std::strtod(last.c_str(), &end);
+        if (end == last.c_str() || scale == 0.0) {
+            return false;
+        }
+        header.format = ImageFileFormat::PFM;
+        header.little_endian = scale < 0.0;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+} // namespace detail
+} // namespace ares
@@ -1,52 +1,262 @@
 #include "ares/image_io.hpp"
-#include <fstream>
+#include "ares/pixel_format.hpp"
+#include "image_header.hpp"
+#include "isa_dispatch.hpp"
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <algorithm>
+#include <string>
+#include <vector>
 
-// C++17 compatible clamp
-template<typename T>
-static inline T clamp_value(T value, T min_val, T max_val) {
-    return (value < min_val) ? min_val : ((value > max_val) ? max_val : value);
-}
+#include <fstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace ares {
 
-bool save_image_ppm(const Image& image, const std::string& filename) {
-    std::ofstream file(filename, std::ios::binary);
-    if (!file) {
+// ============================================================================
+// Whole-file access: mmap for reading (one bulk read on Windows), large
+// blocks for writing
+// ============================================================================
+
+namespace {
+
+class InputFile {
+public:
+    ~InputFile() {
+#ifndef _WIN32
+        if (data_) {
+            munmap(const_cast<unsigned char*>(data_), size_);
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+#endif
+    }
+
+    bool open(const std::string& filename) {
+#ifdef _WIN32
+        std::ifstream file(filename, std::ios::binary | std::ios::ate);
+        if (!file) {
+            return false;
+        }
+        buffer_.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(buffer_.data()),
+                  static_cast<std::streamsize>(buffer_.size()));
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+        return static_cast<bool>(file);
+#else
+        fd_ = ::open(filename.c_str(), O_RDONLY);
+        if (fd_ < 0) {
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd_, &st) != 0 || st.st_size <= 0) {
+            return false;
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        void* map = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+        if (map == MAP_FAILED) {
+            return false;
+        }
+        // Each pixel is touched once, front to back
+        madvise(map, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<const unsigned char*>(map);
+        return true;
+#endif
+    }
+
+    const unsigned char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    const unsigned char* data_ = nullptr;
+    size_t size_ = 0;
+#ifdef _WIN32
+    std::vector<unsigned char> buffer_;
+#else
+    int fd_ = -1;
+#endif
+};
+
+// Sequential writer that hands the OS large blocks. Rows are converted
+// straight into the block, so the only copy is the kernel's. (Writing
+// through a shared mapping was slower: every page of a new file takes a
+// fault before it can be filled.)
+class BlockWriter {
+public:
+    static constexpr size_t BLOCK_BYTES = 1 << 20;
+
+    bool open(const std::string& filename) {
+        file_.open(filename, std::ios::binary | std::ios::trunc);
+        block_.resize(BLOCK_BYTES);
+        return static_cast<bool>(file_);
+    }
+
+    // Space for `bytes` more bytes (at most BLOCK_BYTES), flushing first
+    // if the block cannot hold them
+    unsigned char* reserve(size_t bytes) {
+        if (used_ + bytes > block_.size()) {
+            flush();
+            if (bytes > block_.size()) {
+                block_.resize(bytes);
+            }
+        }
+        unsigned char* p = block_.data() + used_;
+        used_ += bytes;
+        return p;
+    }
+
+    void flush() {
+        file_.write(reinterpret_cast<const char*>(block_.data()),
+                    static_cast<std::streamsize>(used_));
+        used_ = 0;
+    }
+
+    bool close() {
+        flush();
+        file_.close();
+        return !file_.fail();
+    }
+
+private:
+    std::ofstream file_;
+    std::vector<unsigned char> block_;
+    size_t used_ = 0;
+};
+
+// Header fields plus where the samples start in the mapping
+struct FileHeader : detail::ImageFileHeader {
+    size_t data_offset = 0;
+};
+
+bool parse_header(const unsigned char* data, size_t size, FileHeader& header) {
+    size_t pos = 0;
+    auto get = [&]() -> int { return pos < size ? data[pos++] : EOF; };
+    if (!detail::parse_image_header(get, header)) {
         return false;
     }
-    
-    // PPM header
-    file << "P6\n";
-    file << image.width << " " << image.height << "\n";
-    file << "255\n";
-    
-    // Write pixel data (convert float RGBA to byte RGB)
-    for (size_t y = 0; y < image.height; ++y) {
-        for (size_t x = 0; x < image.width; ++x) {
-            size_t idx = (y * image.width + x) * 4;
-            
-            // Clamp and convert to [0, 255]
-            unsigned char r = static_cast<unsigned char>(
-                clamp_value(image.data[idx + 0] * 255.0f, 0.0f, 255.0f)
-            );
-            unsigned char g = static_cast<unsigned char>(
-                clamp_value(image.data[idx + 0] * 255.0f, 0.0f, 255.0f)
-            );
-            unsigned char b = static_cast<unsigned char>(
-                clamp_value(image.data[idx + 2] * 255.0f, 0.0f, 255.0f)
-            );
-            
-            file.write(reinterpret_cast<const char*>(&r), 1);
-            file.write(reinterpret_cast<const char*>(&g), 1);
-            file.write(reinterpret_cast<const char*>(&b), 1);
+    header.data_offset = pos;
+    // data_bytes() cannot overflow once the header has been accepted
+    return size - pos >= header.data_bytes();
+}
+
+std::string make_header(ImageFileFormat format, size_t width, size_t height) {
+    char header[64];
+    if (format == ImageFileFormat::PPM) {
+        std::snprintf(header, sizeof(header), "P6\n%zu %zu\n255\n", width, height);
+    } else {
+        // Negative scale: little-endian samples (x86 byte order)
+        std::snprintf(header, sizeof(header), "PF\n%zu %zu\n-1.0\n", width, height);
+    }
+    return header;
+}
+
+} // namespace
+
+// ============================================================================
+// Whole-image load/save
+// ============================================================================
+
+bool load_image(const std::string& filename, Image& image) {
+    InputFile file;
+    FileHeader header;
+    if (!file.open(filename) || !parse_header(file.data(), file.size(), header)) {
+        return false;
+    }
+
+    if (image.width != header.width || image.height != header.height || !image.data) {
+        // Every pixel is written below
+        image = Image::uninitialized(header.width, header.height);
+    }
+
+    const unsigned char* pixels = file.data() + header.data_offset;
+    const size_t width = header.width;
+
+    if (header.format == ImageFileFormat::PPM) {
+        // Rows are contiguous on both sides: one (multithreaded) conversion
+        convert_to_rgba_f32(pixels, PixelFormat::RGB_U8, image.data, width, header.height);
+        return true;
+    }
+
+    // PFM rows are stored bottom to top; the mapping is not necessarily
+    // 4-byte aligned, so go through a row buffer when it is not
+    const size_t row_bytes = header.row_bytes();
+    std::vector<float> row(width * 3);
+    const detail::PixelConvertKernels& convert = detail::pixel_convert_kernels();
+    for (size_t y = 0; y < header.height; ++y) {
+        const unsigned char* src = pixels + (header.height - 1 - y) * row_bytes;
+        std::memcpy(row.data(), src, row_bytes);
+        if (!header.little_endian) {
+            unsigned char* b = reinterpret_cast<unsigned char*>(row.data());
+            for (size_t i = 0; i < row_bytes; i += 4) {
+                std::swap(b[i + 0], b[i + 3]);
+                std::swap(b[i + 1], b[i + 2]);
+            }
         }
+        convert.rgb_f32_to_rgba_f32(row.data(), image.data + y * width * 4, width);
     }
-    
     return true;
 }
 
+bool save_image_ppm(const Image& image, const std::string& filename) {
+    if (!image.data || image.width == 0 || image.height == 0) {
+        return false;
+    }
+
+    BlockWriter file;
+    if (!file.open(filename)) {
+        return false;
+    }
+
+    const std::string header = make_header(ImageFileFormat::PPM, image.width, image.height);
+    std::memcpy(file.reserve(header.size()), header.data(), header.size());
+
+    const size_t row_bytes = image.width * 3;
+    const detail::PixelConvertKernels& convert = detail::pixel_convert_kernels();
+    for (size_t y = 0; y < image.height; ++y) {
+        convert.rgba_f32_to_rgb_u8(image.data + y * image.width * 4,
+                                   file.reserve(row_bytes), image.width);
+    }
+
+    return file.close();
+}
+
+bool save_image_pfm(const Image& image, const std::string& filename) {
+    if (!image.data || image.width == 0 || image.height == 0) {
+        return false;
+    }
+
+    BlockWriter file;
+    if (!file.open(filename)) {
+        return false;
+    }
+
+    const std::string header = make_header(ImageFileFormat::PFM, image.width, image.height);
+    std::memcpy(file.reserve(header.size()), header.data(), header.size());
+
+    // Bottom row first. Rows in the block follow the header and are not
+    // float-aligned, so convert through a row buffer and copy.
+    const size_t row_bytes = image.width * 3 * sizeof(float);
+    std::vector<float> row(image.width * 3);
+    const detail::PixelConvertKernels& convert = detail::pixel_convert_kernels();
+    for (size_t y = image.height; y-- > 0;) {
+        convert.rgba_f32_to_rgb_f32(image.data + y * image.width * 4, row.data(), image.width);
+        std::memcpy(file.reserve(row_bytes), row.data(), row_bytes);
+    }
+
+    return file.close();
+}
+
 Image create_test_image(size_t width, size_t height) {
     Image img(width, height);
     
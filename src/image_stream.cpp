@@ -0,0 +1,149 @@
+#include "ares/image_io.hpp"
+#include "image_header.hpp"
+#include "isa_dispatch.hpp"
+#include <algorithm>
+
+namespace ares {
+
+// ============================================================================
+// ImageRowReader
+// ============================================================================
+
+bool ImageRowReader::open(const std::string& filename) {
+    file_.close();
+    file_.clear();
+    file_.open(filename, std::ios::binary);
+    if (!file_) {
+        return false;
+    }
+
+    detail::ImageFileHeader header;
+    if (!detail::parse_image_header([this] { return file_.get(); }, header)) {
+        return false;
+    }
+    data_offset_ = file_.tellg();
+    if (data_offset_ < 0) {
+        return false;
+    }
+
+    // Reject truncated files before sizing the row buffer from the header
+    file_.seekg(0, std::ios::end);
+    const std::streamoff file_size = file_.tellg();
+    if (file_size < data_offset_ ||
+        static_cast<unsigned long long>(file_size - data_offset_) < header.data_bytes()) {
+        return false;
+    }
+    file_.seekg(data_offset_);
+
+    format_ = header.format;
+    width_ = header.width;
+    height_ = header.height;
+    little_endian_ = header.little_endian;
+    buffer_.resize(header.row_bytes());
+    next_row_ = 0;
+    return static_cast<bool>(file_);
+}
+
+bool ImageRowReader::read_row(float* rgba) {
+    if (!file_.is_open() || next_row_ >= height_) {
+        return false;
+    }
+
+    if (format_ == ImageFileFormat::PFM) {
+        // PFM stores rows bottom to top
+        const std::streamoff row_bytes = static_cast<std::streamoff>(buffer_.size());
+        file_.seekg(data_offset_ + static_cast<std::streamoff>(height_ - 1 - next_row_) * row_bytes);
+    }
+
+    file_.read(reinterpret_cast<char*>(buffer_.data()),
+               static_cast<std::streamsize>(buffer_.size()));
+    if (!file_) {
+        return false;
+    }
+
+    if (format_ == ImageFileFormat::PPM) {
+        detail::pixel_convert_kernels().rgb_u8_to_rgba_f32(buffer_.data(), rgba, width_);
+    } else {
+        if (!little_endian_) {
+            for (size_t i = 0; i < buffer_.size(); i += 4) {
+                std::swap(buffer_[i + 0], buffer_[i + 3]);
+                std::swap(buffer_[i + 1], buffer_[i + 2]);
+            }
+        }
+        detail::pixel_convert_kernels().rgb_f32_to_rgba_f32(
+            reinterpret_cast<const float*>(buffer_.data()), rgba, width_);
+    }
+
+    ++next_row_;
+    return true;
+}
+
+// ============================================================================
+// ImageRowWriter
+// ============================================================================
+
+bool ImageRowWriter::open(const std::string& filename, size_t width, size_t height,
+                          ImageFileFormat format) {
+    file_.close();
+    file_.clear();
+    if (!detail::image_size_fits(width, height)) {
+        return false;
+    }
+    file_.open(filename, std::ios::binary | std::ios::trunc);
+    if (!file_) {
+        return false;
+    }
+
+    width_ = width;
+    height_ = height;
+    format_ = format;
+    next_row_ = 0;
+
+    if (format == ImageFileFormat::PPM) {
+        file_ << "P6\n" << width << " " << height << "\n255\n";
+        buffer_.resize(width * 3);
+    } else {
+        // Negative scale: little-endian samples (x86 byte order)
+        file_ << "PF\n" << width << " " << height << "\n-1.0\n";
+        buffer_.resize(width * 3 * sizeof(float));
+    }
+
+    data_offset_ = file_.tellp();
+    return static_cast<bool>(file_);
+}
+
+bool ImageRowWriter::write_row(const float* rgba) {
+    if (!file_.is_open() || next_row_ >= height_) {
+        return false;
+    }
+
+    if (format_ == ImageFileFormat::PPM) {
+        detail::pixel_convert_kernels().rgba_f32_to_rgb_u8(rgba, buffer_.data(), width_);
+    } else {
+        detail::pixel_convert_kernels().rgba_f32_to_rgb_f32(
+            rgba, reinterpret_cast<float*>(buffer_.data()), width_);
+        // Bottom row first: seek to this row's slot
+        const std::streamoff row_bytes = static_cast<std::streamoff>(buffer_.size());
+        file_.seekp(data_offset_ + static_cast<std::streamoff>(height_ - 1 - next_row_) * row_bytes);
+    }
+
+    file_.write(reinterpret_cast<const char*>(buffer_.data()),
+                static_cast<std::streamsize>(buffer_.size()));
+    if (!file_) {
+        return false;
+    }
+
+    ++next_row_;
+    return true;
+}
+
+bool ImageRowWriter::close() {
+    if (!file_.is_open()) {
+        return false;
+    }
+    const bool complete = next_row_ == height_;
+    file_.close();
+    return complete && !file_.fail();
+}
+
+} // namespace ares
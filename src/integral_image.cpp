@@ -0,0 +1,339 @@
+#include "ares/integral_image.hpp"
+#include "ares/trace.hpp"
+#include "border.hpp"
+#include "thread_pool.hpp"
+#include <immintrin.h>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace ares {
+
+// Images with fewer pixels than this are built on the calling thread
+constexpr size_t INTEGRAL_SERIAL_PIXELS = 256 * 256;
+
+// Doubles per column block of the carry pass: the carry row of a block
+// (4 KB) stays in L1 while walking down the band
+constexpr size_t INTEGRAL_COLUMN_BLOCK = 512;
+
+// Box queries per work item when a batch is split across the pool
+constexpr size_t BOX_QUERY_BATCH = 4096;
+
+// Running per-channel sum along one row: the four channels of a pixel are
+// the lanes of two double vectors. dst is table row y + 1.
+static void prefix_row(const float* src, double* dst, size_t width) {
+    __m128d sum_rg = _mm_setzero_pd();
+    __m128d sum_ba = _mm_setzero_pd();
+    _mm_store_pd(dst, sum_rg);
+    _mm_store_pd(dst + 2, sum_ba);
+    for (size_t x = 0; x < width; ++x) {
+        const __m128 pixel = _mm_loadu_ps(src + x * 4);
+        sum_rg = _mm_add_pd(sum_rg, _mm_cvtps_pd(pixel));
+        sum_ba = _mm_add_pd(sum_ba, _mm_cvtps_pd(_mm_movehl_ps(pixel, pixel)));
+        _mm_store_pd(dst + (x + 1) * 4, sum_rg);
+        _mm_store_pd(dst + (x + 1) * 4 + 2, sum_ba);
+    }
+}
+
+IntegralImage::~IntegralImage() {
+    _mm_free(table_);
+}
+
+IntegralImage::IntegralImage(IntegralImage&& other) noexcept
+    : table_(other.table_), table_doubles_(other.table_doubles_),
+      width_(other.width_), height_(other.height_) {
+    other.table_ = nullptr;
+    other.table_doubles_ = 0;
+    other.width_ = 0;
+    other.height_ = 0;
+}
+
+IntegralImage& IntegralImage::operator=(IntegralImage&& other) noexcept {
+    if (this != &other) {
+        _mm_free(table_);
+        table_ = other.table_;
+        table_doubles_ = other.table_doubles_;
+        width_ = other.width_;
+        height_ = other.height_;
+        other.table_ = nullptr;
+        other.table_doubles_ = 0;
+        other.width_ = 0;
+        other.height_ = 0;
+    }
+    return *this;
+}
+
+void IntegralImage::build(const Image& image) {
+    ARES_TRACE_SCOPE("IntegralImage::build");
+    width_ = 0;
+    height_ = 0;
+    if (image.width == 0 || image.height == 0) {
+        return;
+    }
+
+    const size_t row_doubles = (image.width + 1) * 4;
+    const size_t needed = row_doubles * (image.height + 1);
+    if (needed > table_doubles_) {
+        ARES_TRACE_SCOPE("integral.alloc");
+        _mm_free(table_);
+        table_ = static_cast<double*>(_mm_malloc(needed * sizeof(double), 64));
+        table_doubles_ = needed;
+    }
+    width_ = image.width;
+    height_ = image.height;
+    std::fill(table_, table_ + row_doubles, 0.0);
+
+    // One band of rows per worker. Within a band, each row's prefix sum is
+    // added to the finished row above it while both are in cache, so a
+    // single thread makes one pass over the table.
+    const bool parallel = image.width * image.height >= INTEGRAL_SERIAL_PIXELS;
+    detail::ThreadPool& pool = detail::ThreadPool::shared();
+    const size_t workers = parallel ? std::min<size_t>(pool.concurrency(), image.height) : 1;
+    const size_t band_rows = (image.height + workers - 1) / workers;
+    const size_t bands = (image.height + band_rows - 1) / band_rows;  // none empty
+    auto band_begin = [&](size_t b) { return std::min(image.height, b * band_rows) + 1; };  // table rows
+    auto add_row = [](double* row, const double* above, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            row[i] += above[i];
+        }
+    };
+
+    {
+        ARES_TRACE_SCOPE("integral.rows");
+        detail::parallel_chunks(bands, 1, [&](size_t first, size_t last, unsigned int) {
+            for (size_t b = first; b < last; ++b) {
+                for (size_t y = band_begin(b); y < band_begin(b + 1); ++y) {
+                    double* row = table_ + y * row_doubles;
+                    prefix_row(image.data + (y - 1) * image.width * 4, row, image.width);
+                    if (y > band_begin(b)) {
+                        add_row(row, row - row_doubles, 0, row_doubles);
+                    }
+                }
+            }
+        });
+    }
+
+    // Carry between bands: the last row of each band becomes final in
+    // order (one row per band), then every other row of band b adds the
+    // final last row of band b - 1, in blocks of columns split across the
+    // pool
+    if (bands > 1) {
+        ARES_TRACE_SCOPE("integral.columns");
+        for (size_t b = 1; b < bands; ++b) {
+            const size_t last = band_begin(b + 1) - 1;
+            add_row(table_ + last * row_doubles, table_ + (band_begin(b) - 1) * row_doubles, 0, row_doubles);
+        }
+        const size_t blocks = (row_doubles + INTEGRAL_COLUMN_BLOCK - 1) / INTEGRAL_COLUMN_BLOCK;
+        detail::parallel_chunks((bands - 1) * blocks, 1, [&](size_t first, size_t end, unsigned int) {
+            for (size_t item = first; item < end; ++item) {
+                const size_t b = 1 + item / blocks;
+                const size_t column_begin = (item % blocks) * INTEGRAL_COLUMN_BLOCK;
+                const size_t column_end = std::min(row_doubles, column_begin + INTEGRAL_COLUMN_BLOCK);
+                const double* carry = table_ + (band_begin(b) - 1) * row_doubles;
+                for (size_t y = band_begin(b); y + 1 < band_begin(b + 1); ++y) {
+                    add_row(table_ + y * row_doubles, carry, column_begin, column_end);
+                }
+            }
+        });
+    }
+}
+
+void IntegralImage::box_sum(const Rect& rect, double sum[4]) const {
+    const size_t x0 = std::min(rect.x, width_);
+    const size_t y0 = std::min(rect.y, height_);
+    const size_t x1 = x0 + std::min(rect.width, width_ - x0);
+    const size_t y1 = y0 + std::min(rect.height, height_ - y0);
+    const double* a = at(x0, y0);
+    const double* b = at(x1, y0);
+    const double* c = at(x0, y1);
+    const double* d = at(x1, y1);
+    for (int ch = 0; ch < 4; ++ch) {
+        sum[ch] = d[ch] - b[ch] - c[ch] + a[ch];
+    }
+}
+
+void IntegralImage::box_sums(std::span<const Rect> rects, double* sums) const {
+    ARES_TRACE_SCOPE("IntegralImage::box_sums");
+    if (width_ == 0) {
+        std::fill(sums, sums + rects.size() * 4, 0.0);
+        return;
+    }
+    detail::parallel_chunks(rects.size(), BOX_QUERY_BATCH, [&](size_t begin, size_t end, unsigned int) {
+        for (size_t i = begin; i < end; ++i) {
+            box_sum(rects[i], sums + i * 4);
+        }
+    });
+}
+
+void IntegralImage::box_means(std::span<const Rect> rects, float* means) const {
+    ARES_TRACE_SCOPE("IntegralImage::box_means");
+    detail::parallel_chunks(rects.size(), BOX_QUERY_BATCH, [&](size_t begin, size_t end, unsigned int) {
+        for (size_t i = begin; i < end; ++i) {
+            const Rect& r = rects[i];
+            const size_t x0 = std::min(r.x, width_);
+            const size_t y0 = std::min(r.y, height_);
+            const size_t area = std::min(r.width, width_ - x0) * std::min(r.height, height_ - y0);
+            if (area == 0) {
+                std::fill(means + i * 4, means + i * 4 + 4, 0.0f);
+                continue;
+            }
+            double sum[4];
+            box_sum(r, sum);
+            for (int ch = 0; ch < 4; ++ch) {
+                means[i * 4 + ch] = static_cast<float>(sum[ch] / static_cast<double>(area));
+            }
+        }
+    });
+}
+
+namespace {
+
+// Image indices [begin, end) that each stand for `weight` samples
+struct Run {
+    int begin;
+    int end;
+    int weight;
+};
+
+// Split the samples [a, b] of an axis of n into runs of border-mapped
+// image indices (see border_index()). One run inside the image; up to
+// three for a box at the edge; more only for radii beyond the image.
+void border_runs(BorderMode border, int a, int b, int n, std::vector<Run>& runs) {
+    runs.clear();
+    if (a >= 0 && b < n) {
+        runs.push_back({ a, b + 1, 1 });
+        return;
+    }
+    switch (border) {
+        case BorderMode::Clamp:
+            if (a < 0) {
+                runs.push_back({ 0, 1, std::min(b, -1) - a + 1 });
+            }
+            if (std::max(a, 0) <= std::min(b, n - 1)) {
+                runs.push_back({ std::max(a, 0), std::min(b, n - 1) + 1, 1 });
+            }
+            if (b >= n) {
+                runs.push_back({ n - 1, n, b - std::max(a, n) + 1 });
+            }
+            break;
+        case BorderMode::Constant:
+            if (std::max(a, 0) <= std::min(b, n - 1)) {
+                runs.push_back({ std::max(a, 0), std::min(b, n - 1) + 1, 1 });
+            }
+            break;
+        case BorderMode::Wrap:
+            for (int i = a; i <= b;) {
+                const int m = ((i % n) + n) % n;
+                const int len = std::min(b - i + 1, n - m);
+                runs.push_back({ m, m + len, 1 });
+                i += len;
+            }
+            break;
+        case BorderMode::Mirror:
+            if (n == 1) {
+                runs.push_back({ 0, 1, b - a + 1 });
+                break;
+            }
+            // Period 2n - 2: indices rise 0..n-1, then fall n-2..1
+            for (int i = a, period = 2 * n - 2; i <= b;) {
+                const int p = ((i % period) + period) % period;
+                if (p < n) {
+                    const int len = std::min(b - i + 1, n - p);
+                    runs.push_back({ p, p + len, 1 });
+                    i += len;
+                } else {
+                    const int len = std::min(b - i + 1, period - p);
+                    runs.push_back({ period - p - len + 1, period - p + 1, 1 });
+                    i += len;
+                }
+            }
+            break;
+    }
+}
+
+} // namespace
+
+void box_blur(const IntegralImage& integral, Image& output, int radius, BorderMode border) {
+    ARES_TRACE_SCOPE("box_blur");
+    if (integral.width() == 0 || output.width != integral.width() || output.height != integral.height()) {
+        return;
+    }
+
+    const int r = std::max(radius, 0);
+    const int w = static_cast<int>(output.width);
+    const int h = static_cast<int>(output.height);
+    const double inv_area = 1.0 / (static_cast<double>(2 * r + 1) * (2 * r + 1));
+    const size_t min_rows = output.width * output.height >= INTEGRAL_SERIAL_PIXELS ? 8 : SIZE_MAX;
+
+    // Pixels whose box lies inside the image in x
+    const int interior_begin = std::min(r, w);
+    const int interior_end = std::max(w - r, interior_begin);
+
+    detail::parallel_chunks(output.height, min_rows, [&](size_t begin, size_t end, unsigned int) {
+        std::vector<Run> row_runs;
+        std::vector<Run> column_runs;
+        for (int y = static_cast<int>(begin); y < static_cast<int>(end); ++y) {
+            float* out = output.data + static_cast<size_t>(y) * w * 4;
+            border_runs(border, y - r, y + r, h, row_runs);
+
+            // General path: every pair of row and column runs is a rectangle
+            auto border_pixel = [&](int x) {
+                border_runs(border, x - r, x + r, w, column_runs);
+                double sum[4] = {};
+                for (const Run& rows : row_runs) {
+                    for (const Run& columns : column_runs) {
+                        const double* a = integral.at(columns.begin, rows.begin);
+                        const double* b = integral.at(columns.end, rows.begin);
+                        const double* c = integral.at(columns.begin, rows.end);
+                        const double* d = integral.at(columns.end, rows.end);
+                        const double weight = static_cast<double>(rows.weight) * columns.weight;
+                        for (int ch = 0; ch < 4; ++ch) {
+                            sum[ch] += (d[ch] - b[ch] - c[ch] + a[ch]) * weight;
+                        }
+                    }
+                }
+                for (int ch = 0; ch < 4; ++ch) {
+                    out[x * 4 + ch] = static_cast<float>(sum[ch] * inv_area);
+                }
+            };
+
+            if (row_runs.size() != 1 || row_runs[0].weight != 1) {
+                for (int x = 0; x < w; ++x) {
+                    border_pixel(x);
+                }
+                continue;
+            }
+
+            for (int x = 0; x < interior_begin; ++x) {
+                border_pixel(x);
+            }
+
+            // Interior: four lookups per channel, one flat loop over floats
+            const double* top = integral.at(0, row_runs[0].begin);
+            const double* bottom = integral.at(0, row_runs[0].end);
+            const int ahead = 4 * (r + 1);
+            const int behind = 4 * r;
+            for (int i = interior_begin * 4; i < interior_end * 4; ++i) {
+                out[i] = static_cast<float>(
+                    (bottom[i + ahead] - bottom[i - behind] - top[i + ahead] + top[i - behind]) * inv_area);
+            }
+
+            for (int x = interior_end; x < w; ++x) {
+                border_pixel(x);
+            }
+        }
+    });
+}
+
+void box_blur(const Image& input, Image& output, int radius, BorderMode border) {
+    if (input.width != output.width || input.height != output.height) {
+        return;
+    }
+    // Released on return: a table is 32 bytes per pixel, too much to pin
+    // per thread between calls. Callers that repeat keep their own.
+    IntegralImage integral;
+    integral.build(input);
+    box_blur(integral, output, radius, border);
+}
+
+} // namespace ares
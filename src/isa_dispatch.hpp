@@ -0,0 +1,197 @@
+#pragma once
+
+// Internal interface between the ISA-neutral front-ends (separable_*.cpp,
+// gaussian_pyramid.cpp, gaussian_scale_space.cpp, aes_simd.cpp,
+// pixel_format.cpp) and the per-ISA kernel translation units. Only SSE2 types may appear here since
+// this header is included by files built without extra -m flags.
+
+#include "ares/cpu_dispatch.hpp"
+#include "ares/separable_filter.hpp"
+#include "border.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <emmintrin.h>
+
+namespace ares {
+namespace detail {
+
+/**
+ * Row primitives of the separable filter engine (separable_engine.hpp).
+ *
+ * horizontal: output pixels [x_begin, x_end) of one row; dst_row points
+ *             at the output for pixel x_begin. Taps outside [0, width)
+ *             are mapped by the border mode the function was built for.
+ * vertical:   output floats [begin, end) of one row; rows[k] is the
+ *             (already border-resolved) source row for tap k.
+ * vertical_stream: same result as vertical, but whole aligned vectors are
+ *             written with non-temporal stores. Callers issue _mm_sfence()
+ *             once per band, before anyone else reads the output.
+ * vertical_sharpen(_stream): vertical then, per float, the unsharp mask
+ *             of src_row (the unfiltered row, indexed like dst_row) by the
+ *             sum still in a register; see SharpenParams.
+ * transpose_rgba: pixel (x, y) of a width x height RGBA block of src
+ *             becomes pixel (y, x) of dst; strides are in floats. Used to
+ *             run the vertical taps through the horizontal row functions.
+ * horizontal_down: horizontal pass with 2x decimation (RGBA only). Output
+ *             pixel x is centred on source pixel 2x; x_begin/x_end count
+ *             output pixels and width is the source width. Same taps and
+ *             summation order as horizontal at that source pixel.
+ *
+ * Every primitive is instantiated per tap symmetry and per tap class
+ * (3, 5 or 7 taps unrolled, anything else at runtime); the kernel passed
+ * in must have the symmetry and tap count the function was selected for.
+ */
+using HorizontalRowFn = void (*)(const float* src_row, float* dst_row, int width,
+                                 int x_begin, int x_end,
+                                 const float* kernel, int radius);
+using VerticalRowFn = void (*)(const float* const* rows, float* dst_row,
+                               size_t begin, size_t end,
+                               const float* kernel, int kernel_size);
+
+/**
+ * Unsharp mask applied by vertical_sharpen to RGBA rows: colour channels
+ * become src + amount * (src - blurred) where |src - blurred| >= threshold
+ * and stay src elsewhere; alpha stays src. Everything is clamped to [0, 1].
+ */
+struct SharpenParams {
+    float amount;
+    float threshold;
+};
+
+using TransposeFn = void (*)(const float* src, size_t src_stride, float* dst, size_t dst_stride,
+                             size_t width, size_t height);
+
+using VerticalSharpenFn = void (*)(const float* const* rows, const float* src_row, float* dst_row,
+                                   size_t begin, size_t end,
+                                   const float* kernel, int kernel_size,
+                                   const SharpenParams& params);
+
+constexpr int CHANNEL_LAYOUT_COUNT = 2;
+constexpr int TAP_SYMMETRY_COUNT = 3;
+constexpr int TAP_CLASS_COUNT = 4;
+
+// Tap count compiled into each tap class; 0 is the runtime-length class
+constexpr int TAP_CLASS_TAPS[TAP_CLASS_COUNT] = { 0, 3, 5, 7 };
+
+inline int tap_class(int taps) {
+    for (int c = 1; c < TAP_CLASS_COUNT; ++c) {
+        if (TAP_CLASS_TAPS[c] == taps) {
+            return c;
+        }
+    }
+    return 0;
+}
+
+struct SeparableRowKernels {
+    const char* name;
+    HorizontalRowFn horizontal[CHANNEL_LAYOUT_COUNT][TAP_SYMMETRY_COUNT][TAP_CLASS_COUNT][BORDER_MODE_COUNT];
+    VerticalRowFn vertical[TAP_SYMMETRY_COUNT][TAP_CLASS_COUNT];
+    VerticalRowFn vertical_stream[TAP_SYMMETRY_COUNT][TAP_CLASS_COUNT];
+    VerticalSharpenFn vertical_sharpen[TAP_SYMMETRY_COUNT][TAP_CLASS_COUNT];
+    VerticalSharpenFn vertical_sharpen_stream[TAP_SYMMETRY_COUNT][TAP_CLASS_COUNT];
+    HorizontalRowFn horizontal_down[TAP_SYMMETRY_COUNT][TAP_CLASS_COUNT][BORDER_MODE_COUNT];
+    TransposeFn transpose_rgba;
+
+    HorizontalRowFn horizontal_for(BorderMode border, ChannelLayout layout,
+                                   TapSymmetry symmetry, int taps) const {
+        return horizontal[static_cast<int>(layout)][static_cast<int>(symmetry)]
+                         [tap_class(taps)][static_cast<int>(border)];
+    }
+
+    HorizontalRowFn horizontal_down_for(BorderMode border, TapSymmetry symmetry, int taps) const {
+        return horizontal_down[static_cast<int>(symmetry)][tap_class(taps)][static_cast<int>(border)];
+    }
+
+    VerticalRowFn vertical_for(bool stream_output, TapSymmetry symmetry, int taps) const {
+        return stream_output ? vertical_stream[static_cast<int>(symmetry)][tap_class(taps)]
+                             : vertical[static_cast<int>(symmetry)][tap_class(taps)];
+    }
+
+    // Row functions for one filter, resolved once per call
+    HorizontalRowFn horizontal_for(BorderMode border, ChannelLayout layout,
+                                   const SeparableFilter& filter) const {
+        return horizontal_for(border, layout, filter.horizontal_symmetry(),
+                              static_cast<int>(filter.horizontal().size()));
+    }
+
+    VerticalRowFn vertical_for(bool stream_output, const SeparableFilter& filter) const {
+        return vertical_for(stream_output, filter.vertical_symmetry(),
+                            static_cast<int>(filter.vertical().size()));
+    }
+
+    VerticalSharpenFn vertical_sharpen_for(bool stream_output, const SeparableFilter& filter) const {
+        const int sym = static_cast<int>(filter.vertical_symmetry());
+        const int c = tap_class(static_cast<int>(filter.vertical().size()));
+        return stream_output ? vertical_sharpen_stream[sym][c] : vertical_sharpen[sym][c];
+    }
+};
+
+struct AesKernels {
+    const char* name;
+    void (*encrypt)(const uint8_t* plaintext, uint8_t* ciphertext,
+                    const uint8_t* key, size_t num_blocks);
+};
+
+/**
+ * Pixel format conversions over `pixels` contiguous pixels. Float -> 8-bit
+ * clamps to [0, 1] and rounds to nearest; 8-bit -> float scales by 1/255.
+ * Conversions that add an alpha channel set it to 1. Planar layouts are
+ * four separate R, G, B, A planes.
+ */
+struct PixelConvertKernels {
+    const char* name;
+    void (*rgba_f32_to_rgba_u8)(const float* src, uint8_t* dst, size_t pixels);
+    void (*rgba_u8_to_rgba_f32)(const uint8_t* src, float* dst, size_t pixels);
+    void (*rgba_f32_to_rgb_u8)(const float* src, uint8_t* dst, size_t pixels);
+    void (*rgb_u8_to_rgba_f32)(const uint8_t* src, float* dst, size_t pixels);
+    void (*rgba_f32_to_rgb_f32)(const float* src, float* dst, size_t pixels);
+    void (*rgb_f32_to_rgba_f32)(const float* src, float* dst, size_t pixels);
+    void (*rgba_f32_to_planar_f32)(const float* src, float* const planes[4], size_t pixels);
+    void (*planar_f32_to_rgba_f32)(const float* const planes[4], float* dst, size_t pixels);
+    void (*rgba_f32_to_rgba_f16)(const float* src, uint16_t* dst, size_t pixels);
+    void (*rgba_f16_to_rgba_f32)(const uint16_t* src, float* dst, size_t pixels);
+};
+
+// Kernels for the active level (resolved once, see cpu_dispatch.cpp)
+const SeparableRowKernels& separable_kernels();
+const AesKernels& aes_kernels();
+const PixelConvertKernels& pixel_convert_kernels();
+
+// Kernels for a specific level, clamped to what the CPU supports
+const SeparableRowKernels& separable_kernels_for(IsaLevel level);
+
+// Per-ISA kernel sets (separable_kernels_*.cpp)
+extern const SeparableRowKernels separable_kernels_scalar;
+extern const SeparableRowKernels separable_kernels_sse42;
+extern const SeparableRowKernels separable_kernels_avx2;
+#ifdef ARES_ENABLE_AVX512
+extern const SeparableRowKernels separable_kernels_avx512;
+#endif
+
+// Per-ISA pixel conversions (pixel_convert_*.cpp). AVX-512 hosts use the
+// AVX2 set: the conversions are bound by memory, not by vector width.
+extern const PixelConvertKernels pixel_convert_kernels_scalar;
+extern const PixelConvertKernels pixel_convert_kernels_sse42;
+extern const PixelConvertKernels pixel_convert_kernels_avx2;
+
+// Scalar half-precision conversions (pixel_convert_scalar.cpp), also used
+// by the SSE4.2 set since F16C arrives with AVX2-class hardware
+void rgba_f32_to_rgba_f16_scalar(const float* src, uint16_t* dst, size_t pixels);
+void rgba_f16_to_rgba_f32_scalar(const uint16_t* src, float* dst, size_t pixels);
+
+// Per-ISA AES kernels (aes_*.cpp)
+void aes_encrypt_aesni(const uint8_t* plaintext, uint8_t* ciphertext,
+                       const uint8_t* key, size_t num_blocks);
+void aes_encrypt_vaes_avx2(const uint8_t* plaintext, uint8_t* ciphertext,
+                           const uint8_t* key, size_t num_blocks);
+#ifdef ARES_ENABLE_AVX512
+void aes_encrypt_vaes_avx512(const uint8_t* plaintext, uint8_t* ciphertext,
+                             const uint8_t* key, size_t num_blocks);
+#endif
+
+// AES-128 key schedule with AESKEYGENASSIST (defined in aes_sse42.cpp,
+// shared by the VAES kernels which broadcast the round keys)
+void aes128_expand_key_aesni(const uint8_t* key, __m128i round_keys[11]);
+
+} // namespace detail
+} // namespace ares
@@ -0,0 +1,196 @@
+#include "ares/numa.hpp"
+#include "numa_placement.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <windows.h>
+#endif
+
+namespace ares {
+
+namespace {
+
+// sysfs lists look like "0-3,8-11"
+std::vector<unsigned int> parse_cpu_list(const std::string& text) {
+    std::vector<unsigned int> values;
+    size_t i = 0;
+    while (i < text.size()) {
+        char* end = nullptr;
+        unsigned long first = std::strtoul(text.c_str() + i, &end, 10);
+        if (end == text.c_str() + i) {
+            break;
+        }
+        unsigned long last = first;
+        i = static_cast<size_t>(end - text.c_str());
+        if (i < text.size() && text[i] == '-') {
+            const char* start = text.c_str() + i + 1;
+            last = std::strtoul(start, &end, 10);
+            i = static_cast<size_t>(end - text.c_str());
+        }
+        for (unsigned long v = first; v <= last; ++v) {
+            values.push_back(static_cast<unsigned int>(v));
+        }
+        if (i < text.size() && text[i] == ',') {
+            ++i;
+        }
+    }
+    return values;
+}
+
+std::vector<NumaNode> detect_nodes() {
+    std::vector<NumaNode> nodes;
+#if defined(__linux__)
+    std::ifstream online("/sys/devices/system/node/online");
+    std::string list;
+    if (online >> list) {
+        for (unsigned int id : parse_cpu_list(list)) {
+            std::ifstream cpulist("/sys/devices/system/node/node" + std::to_string(id) + "/cpulist");
+            std::string cpus;
+            if (cpulist >> cpus) {
+                NumaNode node{ static_cast<int>(id), parse_cpu_list(cpus) };
+                if (!node.cpus.empty()) {  // memory-only nodes run no workers
+                    nodes.push_back(std::move(node));
+                }
+            }
+        }
+    }
+#endif
+    if (nodes.empty()) {
+        unsigned int n = std::thread::hardware_concurrency();
+        if (n == 0) n = 4; // fallback
+        NumaNode node{ 0, {} };
+        for (unsigned int cpu = 0; cpu < n; ++cpu) {
+            node.cpus.push_back(cpu);
+        }
+        nodes.push_back(std::move(node));
+    }
+    return nodes;
+}
+
+bool initial_placement() {
+    if (const char* env = std::getenv("ARES_NUMA")) {
+        return std::strcmp(env, "0") != 0;
+    }
+    return numa_nodes().size() > 1;
+}
+
+std::atomic<bool>& placement_flag() {
+    static std::atomic<bool> flag{ initial_placement() };
+    return flag;
+}
+
+} // namespace
+
+namespace detail {
+
+bool pin_current_thread(unsigned int cpu) {
+#if defined(__linux__)
+    if (cpu >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#elif defined(_WIN32)
+    if (cpu >= 64) {
+        return false;
+    }
+    return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu) != 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+} // namespace detail
+
+const std::vector<NumaNode>& numa_nodes() {
+    static const std::vector<NumaNode> nodes = detect_nodes();
+    return nodes;
+}
+
+bool numa_placement() {
+    return placement_flag().load(std::memory_order_relaxed);
+}
+
+void set_numa_placement(bool enabled) {
+    placement_flag().store(enabled, std::memory_order_relaxed);
+}
+
+std::vector<unsigned int> blur_worker_cpus() {
+    std::vector<unsigned int> cpus;
+    if (!numa_placement()) {
+        return cpus;
+    }
+#if defined(__linux__)
+    // Re-read on every call: the caller may have been restricted since
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    const bool have_mask = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+#endif
+    for (const NumaNode& node : numa_nodes()) {
+        for (unsigned int cpu : node.cpus) {
+#if defined(__linux__)
+            if (have_mask && (cpu >= CPU_SETSIZE || !CPU_ISSET(cpu, &allowed))) {
+                continue;
+            }
+#endif
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+Image make_numa_image(size_t width, size_t height) {
+    const std::vector<unsigned int> cpus = blur_worker_cpus();
+    if (cpus.empty()) {
+        return Image(width, height);
+    }
+
+    Image image = Image::uninitialized(width, height);
+    const size_t row_floats = width * 4;
+    std::vector<std::thread> threads;
+    threads.reserve(cpus.size());
+    for (size_t t = 0; t < cpus.size(); ++t) {
+        threads.emplace_back([&, t] {
+            detail::pin_current_thread(cpus[t]);
+            size_t begin, end;
+            detail::band_rows(t, cpus.size(), height, begin, end);
+            std::memset(image.data + begin * row_floats, 0, (end - begin) * row_floats * sizeof(float));
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return image;
+}
+
+int numa_node_of(const void* p) {
+#if defined(__linux__) && defined(SYS_move_pages)
+    const long page = sysconf(_SC_PAGESIZE);
+    void* pages[1] = { reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(p) & ~static_cast<uintptr_t>(page - 1)) };
+    int status[1] = { -1 };
+    // With no target nodes, move_pages only reports where each page is
+    if (syscall(SYS_move_pages, 0, 1UL, pages, nullptr, status, 0) != 0 || status[0] < 0) {
+        return -1;
+    }
+    return status[0];
+#else
+    (void)p;
+    return -1;
+#endif
+}
+
+} // namespace ares
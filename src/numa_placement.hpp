@@ -0,0 +1,28 @@
+#pragma once
+
+// Worker placement shared by gaussian_blur_multithreaded() and
+// make_numa_image(): both must cut rows into the same bands and run band
+// t on the same CPU for first-touch placement to pay off.
+
+#include <cstddef>
+
+namespace ares {
+namespace detail {
+
+/**
+ * Pin the calling thread to one CPU. Returns false if the OS refuses
+ * (the thread keeps running unpinned).
+ */
+bool pin_current_thread(unsigned int cpu);
+
+/**
+ * Rows [begin, end) of band t out of n; the last band takes the remainder.
+ */
+inline void band_rows(size_t t, size_t n, size_t height, size_t& begin, size_t& end) {
+    const size_t rows_per_band = height / n;
+    begin = t * rows_per_band;
+    end = (t == n - 1) ? height : (t + 1) * rows_per_band;
+}
+
+} // namespace detail
+} // namespace ares
@@ -0,0 +1,245 @@
+#include "isa_dispatch.hpp"
+#include <immintrin.h>
+
+// Built with -mavx2 -mfma -mf16c. 8 pixels per iteration. In-lane pack and
+// shuffle instructions leave pixels interleaved across the two 128-bit
+// lanes; one VPERMD per block restores memory order. Packed RGB loops
+// touch a few bytes past the pixels they own (see pixel_convert_sse42.cpp)
+// and stop early enough to stay inside the buffers.
+
+namespace ares {
+namespace detail {
+
+static inline uint8_t to_u8(float v) {
+    v = v < 0.0f ? 0.0f : (v > 1.0f ? 1.0f : v);
+    return static_cast<uint8_t>(static_cast<int>(v * 255.0f + 0.5f));
+}
+
+// 8 RGBA float pixels -> 32 bytes RGBA in pixel order, clamped and rounded
+static inline __m256i pack_rgba_u8_avx2(const float* src) {
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 scale = _mm256_set1_ps(255.0f);
+    const __m256 half = _mm256_set1_ps(0.5f);
+
+    // Each register holds pixels (2k, 2k+1) in its low/high lane
+    __m256i q[4];
+    for (int k = 0; k < 4; ++k) {
+        __m256 p = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(src + k * 8), zero), one);
+        q[k] = _mm256_cvttps_epi32(_mm256_fmadd_ps(p, scale, half));
+    }
+    // Lane 0: pixels 0 2 4 6, lane 1: pixels 1 3 5 7 (one dword each)
+    __m256i bytes = _mm256_packus_epi16(_mm256_packus_epi32(q[0], q[1]),
+                                        _mm256_packus_epi32(q[2], q[3]));
+    return _mm256_permutevar8x32_epi32(bytes, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+}
+
+static void rgba_f32_to_rgba_u8_avx2(const float* src, uint8_t* dst, size_t pixels) {
+    size_t i = 0;
+    for (; i + 8 <= pixels; i += 8) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 4), pack_rgba_u8_avx2(src + i * 4));
+    }
+    for (; i < pixels; ++i) {
+        for (int c = 0; c < 4; ++c) {
+            dst[i * 4 + c] = to_u8(src[i * 4 + c]);
+        }
+    }
+}
+
+static void rgba_u8_to_rgba_f32_avx2(const uint8_t* src, float* dst, size_t pixels) {
+    const __m256 scale = _mm256_set1_ps(1.0f / 255.0f);
+    size_t i = 0;
+    for (; i + 8 <= pixels; i += 8) {
+        for (int k = 0; k < 4; ++k) {
+            // 2 pixels (8 bytes) per conversion
+            __m128i b = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + (i + k * 2) * 4));
+            __m256 p = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(b));
+            _mm256_storeu_ps(dst + (i + k * 2) * 4, _mm256_mul_ps(p, scale));
+        }
+    }
+    const float s = 1.0f / 255.0f;
+    for (; i < pixels; ++i) {
+        for (int c = 0; c < 4; ++c) {
+            dst[i * 4 + c] = src[i * 4 + c] * s;
+        }
+    }
+}
+
+static void rgba_f32_to_rgb_u8_avx2(const float* src, uint8_t* dst, size_t pixels) {
+    // Per lane: 4 pixels -> 12 bytes RGB + 4 bytes garbage
+    const __m256i drop_alpha = _mm256_setr_epi8(
+        0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+        0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    size_t i = 0;
+    // Second 16-byte store ends 4 bytes past the 24 owned (next 2 pixels)
+    for (; i + 10 <= pixels; i += 8) {
+        __m256i rgb = _mm256_shuffle_epi8(pack_rgba_u8_avx2(src + i * 4), drop_alpha);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 3), _mm256_castsi256_si128(rgb));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 3 + 12), _mm256_extracti128_si256(rgb, 1));
+    }
+    for (; i < pixels; ++i) {
+        dst[i * 3 + 0] = to_u8(src[i * 4 + 0]);
+        dst[i * 3 + 1] = to_u8(src[i * 4 + 1]);
+        dst[i * 3 + 2] = to_u8(src[i * 4 + 2]);
+    }
+}
+
+static void rgb_u8_to_rgba_f32_avx2(const uint8_t* src, float* dst, size_t pixels) {
+    // 4 RGB pixels -> RGBA with a zero alpha byte
+    const __m128i add_alpha = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1,
+                                            9, 10, 11, -1);
+    const __m256 scale = _mm256_set1_ps(1.0f / 255.0f);
+    // OR-ing 1.0f into the 0.0f alpha sets it to 1
+    const __m256 alpha_one = _mm256_setr_ps(0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+    size_t i = 0;
+    // Second 16-byte load ends 4 bytes past the 24 owned (next 2 pixels)
+    for (; i + 10 <= pixels; i += 8) {
+        for (int h = 0; h < 2; ++h) {
+            __m128i rgb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + (i + h * 4) * 3));
+            __m128i rgba = _mm_shuffle_epi8(rgb, add_alpha);
+            for (int k = 0; k < 2; ++k) {
+                __m256 p = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(rgba));
+                _mm256_storeu_ps(dst + (i + h * 4 + k * 2) * 4,
+                                 _mm256_or_ps(_mm256_mul_ps(p, scale), alpha_one));
+                rgba = _mm_srli_si128(rgba, 8);
+            }
+        }
+    }
+    const float s = 1.0f / 255.0f;
+    for (; i < pixels; ++i) {
+        dst[i * 4 + 0] = src[i * 3 + 0] * s;
+        dst[i * 4 + 1] = src[i * 3 + 1] * s;
+        dst[i * 4 + 2] = src[i * 3 + 2] * s;
+        dst[i * 4 + 3] = 1.0f;
+    }
+}
+
+static void rgba_f32_to_rgb_f32_avx2(const float* src, float* dst, size_t pixels) {
+    // 2 pixels -> R0 G0 B0 R1 G1 B1 + 2 floats overwritten by the next pixel
+    const __m256i drop_alpha = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+    size_t i = 0;
+    for (; i + 2 < pixels; i += 2) {
+        __m256 p = _mm256_permutevar8x32_ps(_mm256_loadu_ps(src + i * 4), drop_alpha);
+        _mm256_storeu_ps(dst + i * 3, p);
+    }
+    for (; i < pixels; ++i) {
+        dst[i * 3 + 0] = src[i * 4 + 0];
+        dst[i * 3 + 1] = src[i * 4 + 1];
+        dst[i * 3 + 2] = src[i * 4 + 2];
+    }
+}
+
+static void rgb_f32_to_rgba_f32_avx2(const float* src, float* dst, size_t pixels) {
+    // R0 G0 B0 R1 G1 B1 (+ 2 floats of the next pixel) -> 2 RGBA pixels
+    const __m256i add_alpha = _mm256_setr_epi32(0, 1, 2, 2, 3, 4, 5, 5);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    size_t i = 0;
+    for (; i + 2 < pixels; i += 2) {
+        __m256 p = _mm256_permutevar8x32_ps(_mm256_loadu_ps(src + i * 3), add_alpha);
+        _mm256_storeu_ps(dst + i * 4, _mm256_blend_ps(p, one, 0x88));
+    }
+    for (; i < pixels; ++i) {
+        dst[i * 4 + 0] = src[i * 3 + 0];
+        dst[i * 4 + 1] = src[i * 3 + 1];
+        dst[i * 4 + 2] = src[i * 3 + 2];
+        dst[i * 4 + 3] = 1.0f;
+    }
+}
+
+static void rgba_f32_to_planar_f32_avx2(const float* src, float* const planes[4], size_t pixels) {
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    size_t i = 0;
+    for (; i + 8 <= pixels; i += 8) {
+        // Pixel pairs (0,1) (2,3) (4,5) (6,7); per-lane 4x4 transpose
+        __m256 a = _mm256_loadu_ps(src + i * 4 + 0);
+        __m256 b = _mm256_loadu_ps(src + i * 4 + 8);
+        __m256 c = _mm256_loadu_ps(src + i * 4 + 16);
+        __m256 d = _mm256_loadu_ps(src + i * 4 + 24);
+        __m256 t0 = _mm256_unpacklo_ps(a, b);
+        __m256 t1 = _mm256_unpackhi_ps(a, b);
+        __m256 t2 = _mm256_unpacklo_ps(c, d);
+        __m256 t3 = _mm256_unpackhi_ps(c, d);
+        // Lane 0 holds even pixels, lane 1 odd ones: R0 R2 R4 R6 | R1 R3 R5 R7
+        __m256 r = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 g = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 bl = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 al = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        _mm256_storeu_ps(planes[0] + i, _mm256_permutevar8x32_ps(r, order));
+        _mm256_storeu_ps(planes[1] + i, _mm256_permutevar8x32_ps(g, order));
+        _mm256_storeu_ps(planes[2] + i, _mm256_permutevar8x32_ps(bl, order));
+        _mm256_storeu_ps(planes[3] + i, _mm256_permutevar8x32_ps(al, order));
+    }
+    for (; i < pixels; ++i) {
+        for (int c = 0; c < 4; ++c) {
+            planes[c][i] = src[i * 4 + c];
+        }
+    }
+}
+
+static void planar_f32_to_rgba_f32_avx2(const float* const planes[4], float* dst, size_t pixels) {
+    // Inverse of the above: even pixels to lane 0, odd pixels to lane 1
+    const __m256i order = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    size_t i = 0;
+    for (; i + 8 <= pixels; i += 8) {
+        __m256 r = _mm256_permutevar8x32_ps(_mm256_loadu_ps(planes[0] + i), order);
+        __m256 g = _mm256_permutevar8x32_ps(_mm256_loadu_ps(planes[1] + i), order);
+        __m256 b = _mm256_permutevar8x32_ps(_mm256_loadu_ps(planes[2] + i), order);
+        __m256 a = _mm256_permutevar8x32_ps(_mm256_loadu_ps(planes[3] + i), order);
+        __m256 t0 = _mm256_unpacklo_ps(r, g);
+        __m256 t1 = _mm256_unpackhi_ps(r, g);
+        __m256 t2 = _mm256_unpacklo_ps(b, a);
+        __m256 t3 = _mm256_unpackhi_ps(b, a);
+        _mm256_storeu_ps(dst + i * 4 + 0, _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0)));
+        _mm256_storeu_ps(dst + i * 4 + 8, _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2)));
+        _mm256_storeu_ps(dst + i * 4 + 16, _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0)));
+        _mm256_storeu_ps(dst + i * 4 + 24, _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2)));
+    }
+    for (; i < pixels; ++i) {
+        for (int c = 0; c < 4; ++c) {
+            dst[i * 4 + c] = planes[c][i];
+        }
+    }
+}
+
+static void rgba_f32_to_rgba_f16_avx2(const float* src, uint16_t* dst, size_t pixels) {
+    size_t i = 0;
+    for (; i + 2 <= pixels; i += 2) {
+        __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(src + i * 4),
+                                    _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), h);
+    }
+    if (i < pixels) {
+        __m128i h = _mm_cvtps_ph(_mm_loadu_ps(src + i * 4),
+                                 _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i * 4), h);
+    }
+}
+
+static void rgba_f16_to_rgba_f32_avx2(const uint16_t* src, float* dst, size_t pixels) {
+    size_t i = 0;
+    for (; i + 2 <= pixels; i += 2) {
+        __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+        _mm256_storeu_ps(dst + i * 4, _mm256_cvtph_ps(h));
+    }
+    if (i < pixels) {
+        __m128i h = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i * 4));
+        _mm_storeu_ps(dst + i * 4, _mm_cvtph_ps(h));
+    }
+}
+
+const PixelConvertKernels pixel_convert_kernels_avx2 = {
+    "avx2",
+    rgba_f32_to_rgba_u8_avx2,
+    rgba_u8_to_rgba_f32_avx2,
+    rgba_f32_to_rgb_u8_avx2,
+    rgb_u8_to_rgba_f32_avx2,
+    rgba_f32_to_rgb_f32_avx2,
+    rgb_f32_to_rgba_f32_avx2,
+    rgba_f32_to_planar_f32_avx2,
+    planar_f32_to_rgba_f32_avx2,
+    rgba_f32_to_rgba_f16_avx2,
+    rgba_f16_to_rgba_f32_avx2,
+};
+
+} // namespace detail
+} // namespace ares
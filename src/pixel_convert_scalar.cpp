@@ -0,0 +1,176 @@
+#include "isa_dispatch.hpp"
+#include <cstring>
+
+// Portable conversions: the reference the SIMD sets are tested against
+// (convert_*_baseline) and the kernels used when ARES_FORCE_ISA=scalar.
+
+namespace ares {
+namespace detail {
+
+static inline uint8_t to_u8(float v) {
+    v = v < 0.0f ? 0.0f : (v > 1.0f ? 1.0f : v);
+    return static_cast<uint8_t>(static_cast<int>(v * 255.0f + 0.5f));
+}
+
+// IEEE 754 binary32 -> binary16, round to nearest even (same as F16C)
+static inline uint16_t float_to_half(float f) {
+    uint32_t x;
+    std::memcpy(&x, &f, sizeof(x));
+    const uint32_t sign = (x >> 16) & 0x8000u;
+    const uint32_t abs = x & 0x7FFFFFFFu;
+
+    if (abs >= 0x7F800000u) {
+        // Inf stays Inf; NaN is quieted and keeps its top payload bits
+        uint32_t nan_bits = abs > 0x7F800000u ? 0x200u | ((abs >> 13) & 0x3FFu) : 0u;
+        return static_cast<uint16_t>(sign | 0x7C00u | nan_bits);
+    }
+    if (abs >= 0x477FF000u) {
+        return static_cast<uint16_t>(sign | 0x7C00u);  // rounds past 65504
+    }
+    if (abs < 0x38800000u) {
+        // Half subnormal (or zero): value / 2^-24, rounded
+        if (abs < 0x33000000u) {
+            return static_cast<uint16_t>(sign);
+        }
+        const uint32_t e = abs >> 23;
+        const uint32_t m = (abs & 0x7FFFFFu) | 0x800000u;
+        const uint32_t shift = 126 - e;
+        uint32_t r = m >> shift;
+        const uint32_t rem = m & ((1u << shift) - 1);
+        const uint32_t halfway = 1u << (shift - 1);
+        if (rem > halfway || (rem == halfway && (r & 1u))) {
+            ++r;
+        }
+        return static_cast<uint16_t>(sign | r);
+    }
+
+    // Normal: rebias the exponent (127 -> 15) and drop 13 mantissa bits
+    uint32_t r = (abs - 0x38000000u) >> 13;
+    const uint32_t rem = abs & 0x1FFFu;
+    if (rem > 0x1000u || (rem == 0x1000u && (r & 1u))) {
+        ++r;  // may carry into the exponent, which is still correct
+    }
+    return static_cast<uint16_t>(sign | r);
+}
+
+static inline float half_to_float(uint16_t h) {
+    const uint32_t sign = static_cast<uint32_t>(h & 0x8000u) << 16;
+    uint32_t e = (h >> 10) & 0x1Fu;
+    uint32_t m = h & 0x3FFu;
+    uint32_t bits;
+
+    if (e == 0) {
+        if (m == 0) {
+            bits = sign;
+        } else {
+            // Subnormal half: normalize into a float exponent
+            e = 113;
+            while ((m & 0x400u) == 0) {
+                m <<= 1;
+                --e;
+            }
+            bits = sign | (e << 23) | ((m & 0x3FFu) << 13);
+        }
+    } else if (e == 31) {
+        bits = sign | 0x7F800000u | (m << 13) | (m != 0 ? 0x400000u : 0u);
+    } else {
+        bits = sign | ((e + 112) << 23) | (m << 13);
+    }
+
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+static void rgba_f32_to_rgba_u8_scalar(const float* src, uint8_t* dst, size_t pixels) {
+    for (size_t i = 0; i < pixels * 4; ++i) {
+        dst[i] = to_u8(src[i]);
+    }
+}
+
+static void rgba_u8_to_rgba_f32_scalar(const uint8_t* src, float* dst, size_t pixels) {
+    const float s = 1.0f / 255.0f;
+    for (size_t i = 0; i < pixels * 4; ++i) {
+        dst[i] = src[i] * s;
+    }
+}
+
+static void rgba_f32_to_rgb_u8_scalar(const float* src, uint8_t* dst, size_t pixels) {
+    for (size_t i = 0; i < pixels; ++i) {
+        dst[i * 3 + 0] = to_u8(src[i * 4 + 0]);
+        dst[i * 3 + 1] = to_u8(src[i * 4 + 1]);
+        dst[i * 3 + 2] = to_u8(src[i * 4 + 2]);
+    }
+}
+
+static void rgb_u8_to_rgba_f32_scalar(const uint8_t* src, float* dst, size_t pixels) {
+    const float s = 1.0f / 255.0f;
+    for (size_t i = 0; i < pixels; ++i) {
+        dst[i * 4 + 0] = src[i * 3 + 0] * s;
+        dst[i * 4 + 1] = src[i * 3 + 1] * s;
+        dst[i * 4 + 2] = src[i * 3 + 2] * s;
+        dst[i * 4 + 3] = 1.0f;
+    }
+}
+
+static void rgba_f32_to_rgb_f32_scalar(const float* src, float* dst, size_t pixels) {
+    for (size_t i = 0; i < pixels; ++i) {
+        dst[i * 3 + 0] = src[i * 4 + 0];
+        dst[i * 3 + 1] = src[i * 4 + 1];
+        dst[i * 3 + 2] = src[i * 4 + 2];
+    }
+}
+
+static void rgb_f32_to_rgba_f32_scalar(const float* src, float* dst, size_t pixels) {
+    for (size_t i = 0; i < pixels; ++i) {
+        dst[i * 4 + 0] = src[i * 3 + 0];
+        dst[i * 4 + 1] = src[i * 3 + 1];
+        dst[i * 4 + 2] = src[i * 3 + 2];
+        dst[i * 4 + 3] = 1.0f;
+    }
+}
+
+static void rgba_f32_to_planar_f32_scalar(const float* src, float* const planes[4], size_t pixels) {
+    for (size_t i = 0; i < pixels; ++i) {
+        for (int c = 0; c < 4; ++c) {
+            planes[c][i] = src[i * 4 + c];
+        }
+    }
+}
+
+static void planar_f32_to_rgba_f32_scalar(const float* const planes[4], float* dst, size_t pixels) {
+    for (size_t i = 0; i < pixels; ++i) {
+        for (int c = 0; c < 4; ++c) {
+            dst[i * 4 + c] = planes[c][i];
+        }
+    }
+}
+
+void rgba_f32_to_rgba_f16_scalar(const float* src, uint16_t* dst, size_t pixels) {
+    for (size_t i = 0; i < pixels * 4; ++i) {
+        dst[i] = float_to_half(src[i]);
+    }
+}
+
+void rgba_f16_to_rgba_f32_scalar(const uint16_t* src, float* dst, size_t pixels) {
+    for (size_t i = 0; i < pixels * 4; ++i) {
+        dst[i] = half_to_float(src[i]);
+    }
+}
+
+const PixelConvertKernels pixel_convert_kernels_scalar = {
+    "scalar",
+    rgba_f32_to_rgba_u8_scalar,
+    rgba_u8_to_rgba_f32_scalar,
+    rgba_f32_to_rgb_u8_scalar,
+    rgb_u8_to_rgba_f32_scalar,
+    rgba_f32_to_rgb_f32_scalar,
+    rgb_f32_to_rgba_f32_scalar,
+    rgba_f32_to_planar_f32_scalar,
+    planar_f32_to_rgba_f32_scalar,
+    rgba_f32_to_rgba_f16_scalar,
+    rgba_f16_to_rgba_f32_scalar,
+};
+
+} // namespace detail
+} // namespace ares
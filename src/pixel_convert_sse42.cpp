@@ -0,0 +1,190 @@
+#include "isa_dispatch.hpp"
+#include <immintrin.h>
+
+// Built with -msse4.2 (PSHUFB, PMOVZX, PACKUSDW). Packed RGB rows have 3
+// elements per pixel but vectors move 4, so the RGB loops load/store a few
+// elements past the pixels they own and rely on the next iteration to
+// overwrite them; each loop stops early enough that those accesses stay
+// inside the buffer, and the rest goes through the scalar tail.
+
+namespace ares {
+namespace detail {
+
+static inline uint8_t to_u8(float v) {
+    v = v < 0.0f ? 0.0f : (v > 1.0f ? 1.0f : v);
+    return static_cast<uint8_t>(static_cast<int>(v * 255.0f + 0.5f));
+}
+
+// 4 RGBA float pixels -> 16 bytes RGBA, clamped and rounded
+static inline __m128i pack_rgba_u8_sse42(const float* src) {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(255.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+
+    __m128i q[4];
+    for (int k = 0; k < 4; ++k) {
+        __m128 p = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + k * 4), zero), one);
+        q[k] = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(p, scale), half));
+    }
+    // Values are already in [0, 255]; the saturating packs just narrow
+    return _mm_packus_epi16(_mm_packus_epi32(q[0], q[1]), _mm_packus_epi32(q[2], q[3]));
+}
+
+// 16 bytes RGBA -> 4 RGBA float pixels in [0, 1], OR-ed with `set_bits`
+static inline void unpack_rgba_u8_sse42(__m128i bytes, float* dst, __m128 set_bits) {
+    const __m128 scale = _mm_set1_ps(1.0f / 255.0f);
+    for (int k = 0; k < 4; ++k) {
+        __m128 p = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(bytes)), scale);
+        _mm_storeu_ps(dst + k * 4, _mm_or_ps(p, set_bits));
+        bytes = _mm_srli_si128(bytes, 4);
+    }
+}
+
+static void rgba_f32_to_rgba_u8_sse42(const float* src, uint8_t* dst, size_t pixels) {
+    size_t i = 0;
+    for (; i + 4 <= pixels; i += 4) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), pack_rgba_u8_sse42(src + i * 4));
+    }
+    for (; i < pixels; ++i) {
+        for (int c = 0; c < 4; ++c) {
+            dst[i * 4 + c] = to_u8(src[i * 4 + c]);
+        }
+    }
+}
+
+static void rgba_u8_to_rgba_f32_sse42(const uint8_t* src, float* dst, size_t pixels) {
+    size_t i = 0;
+    for (; i + 4 <= pixels; i += 4) {
+        unpack_rgba_u8_sse42(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4)),
+                             dst + i * 4, _mm_setzero_ps());
+    }
+    const float s = 1.0f / 255.0f;
+    for (; i < pixels; ++i) {
+        for (int c = 0; c < 4; ++c) {
+            dst[i * 4 + c] = src[i * 4 + c] * s;
+        }
+    }
+}
+
+static void rgba_f32_to_rgb_u8_sse42(const float* src, uint8_t* dst, size_t pixels) {
+    // Drop every fourth byte; the last 4 bytes of the store are garbage
+    const __m128i drop_alpha = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14,
+                                             -1, -1, -1, -1);
+    size_t i = 0;
+    // 16-byte store at 3 * i covers 12 bytes owned + 4 of the next 2 pixels
+    for (; i + 6 <= pixels; i += 4) {
+        __m128i rgb = _mm_shuffle_epi8(pack_rgba_u8_sse42(src + i * 4), drop_alpha);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 3), rgb);
+    }
+    for (; i < pixels; ++i) {
+        dst[i * 3 + 0] = to_u8(src[i * 4 + 0]);
+        dst[i * 3 + 1] = to_u8(src[i * 4 + 1]);
+        dst[i * 3 + 2] = to_u8(src[i * 4 + 2]);
+    }
+}
+
+static void rgb_u8_to_rgba_f32_sse42(const uint8_t* src, float* dst, size_t pixels) {
+    // Spread RGB to RGBA with a zero alpha byte; OR-ing 1.0f into the
+    // resulting 0.0f alpha sets it to 1
+    const __m128i add_alpha = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1,
+                                            9, 10, 11, -1);
+    const __m128 alpha_one = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+    size_t i = 0;
+    // 16-byte load at 3 * i reads 12 bytes owned + 4 of the next 2 pixels
+    for (; i + 6 <= pixels; i += 4) {
+        __m128i rgb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 3));
+        unpack_rgba_u8_sse42(_mm_shuffle_epi8(rgb, add_alpha), dst + i * 4, alpha_one);
+    }
+    const float s = 1.0f / 255.0f;
+    for (; i < pixels; ++i) {
+        dst[i * 4 + 0] = src[i * 3 + 0] * s;
+        dst[i * 4 + 1] = src[i * 3 + 1] * s;
+        dst[i * 4 + 2] = src[i * 3 + 2] * s;
+        dst[i * 4 + 3] = 1.0f;
+    }
+}
+
+static void rgba_f32_to_rgb_f32_sse42(const float* src, float* dst, size_t pixels) {
+    size_t i = 0;
+    for (; i + 1 < pixels; ++i) {
+        // Alpha lands on the next pixel's R and is overwritten
+        _mm_storeu_ps(dst + i * 3, _mm_loadu_ps(src + i * 4));
+    }
+    for (; i < pixels; ++i) {
+        dst[i * 3 + 0] = src[i * 4 + 0];
+        dst[i * 3 + 1] = src[i * 4 + 1];
+        dst[i * 3 + 2] = src[i * 4 + 2];
+    }
+}
+
+static void rgb_f32_to_rgba_f32_sse42(const float* src, float* dst, size_t pixels) {
+    size_t i = 0;
+    for (; i + 1 < pixels; ++i) {
+        // Fourth float is the next pixel's R; replaced by alpha = 1
+        _mm_storeu_ps(dst + i * 4, _mm_blend_ps(_mm_loadu_ps(src + i * 3), _mm_set1_ps(1.0f), 0x8));
+    }
+    for (; i < pixels; ++i) {
+        dst[i * 4 + 0] = src[i * 3 + 0];
+        dst[i * 4 + 1] = src[i * 3 + 1];
+        dst[i * 4 + 2] = src[i * 3 + 2];
+        dst[i * 4 + 3] = 1.0f;
+    }
+}
+
+static void rgba_f32_to_planar_f32_sse42(const float* src, float* const planes[4], size_t pixels) {
+    size_t i = 0;
+    for (; i + 4 <= pixels; i += 4) {
+        __m128 p0 = _mm_loadu_ps(src + i * 4 + 0);
+        __m128 p1 = _mm_loadu_ps(src + i * 4 + 4);
+        __m128 p2 = _mm_loadu_ps(src + i * 4 + 8);
+        __m128 p3 = _mm_loadu_ps(src + i * 4 + 12);
+        _MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+        _mm_storeu_ps(planes[0] + i, p0);
+        _mm_storeu_ps(planes[1] + i, p1);
+        _mm_storeu_ps(planes[2] + i, p2);
+        _mm_storeu_ps(planes[3] + i, p3);
+    }
+    for (; i < pixels; ++i) {
+        for (int c = 0; c < 4; ++c) {
+            planes[c][i] = src[i * 4 + c];
+        }
+    }
+}
+
+static void planar_f32_to_rgba_f32_sse42(const float* const planes[4], float* dst, size_t pixels) {
+    size_t i = 0;
+    for (; i + 4 <= pixels; i += 4) {
+        __m128 r = _mm_loadu_ps(planes[0] + i);
+        __m128 g = _mm_loadu_ps(planes[1] + i);
+        __m128 b = _mm_loadu_ps(planes[2] + i);
+        __m128 a = _mm_loadu_ps(planes[3] + i);
+        _MM_TRANSPOSE4_PS(r, g, b, a);
+        _mm_storeu_ps(dst + i * 4 + 0, r);
+        _mm_storeu_ps(dst + i * 4 + 4, g);
+        _mm_storeu_ps(dst + i * 4 + 8, b);
+        _mm_storeu_ps(dst + i * 4 + 12, a);
+    }
+    for (; i < pixels; ++i) {
+        for (int c = 0; c < 4; ++c) {
+            dst[i * 4 + c] = planes[c][i];
+        }
+    }
+}
+
+const PixelConvertKernels pixel_convert_kernels_sse42 = {
+    "sse4.2",
+    rgba_f32_to_rgba_u8_sse42,
+    rgba_u8_to_rgba_f32_sse42,
+    rgba_f32_to_rgb_u8_sse42,
+    rgb_u8_to_rgba_f32_sse42,
+    rgba_f32_to_rgb_f32_sse42,
+    rgb_f32_to_rgba_f32_sse42,
+    rgba_f32_to_planar_f32_sse42,
+    planar_f32_to_rgba_f32_sse42,
+    rgba_f32_to_rgba_f16_scalar,
+    rgba_f16_to_rgba_f32_scalar,
+};
+
+} // namespace detail
+} // namespace ares
@@ -0,0 +1,131 @@
+#include "ares/pixel_format.hpp"
+#include "isa_dispatch.hpp"
+#include "thread_pool.hpp"
+#include <cstdint>
+#include <cstring>
+
+namespace ares {
+
+// Frames at least this large are converted on the worker pool
+constexpr size_t CONVERT_PARALLEL_PIXELS = 1 << 20;
+
+// Pixels per work item (1 MB of float RGBA)
+constexpr size_t CONVERT_CHUNK_PIXELS = 1 << 16;
+
+size_t pixel_format_size(PixelFormat format, size_t width, size_t height) {
+    const size_t pixels = width * height;
+    switch (format) {
+        case PixelFormat::RGBA_U8:    return pixels * 4;
+        case PixelFormat::RGB_U8:     return pixels * 3;
+        case PixelFormat::RGBA_F16:   return pixels * 4 * sizeof(uint16_t);
+        case PixelFormat::RGBA_F32:
+        case PixelFormat::Planar_F32: break;
+    }
+    return pixels * 4 * sizeof(float);
+}
+
+// Convert pixels [begin, end) of a float RGBA image into dst
+static void from_rgba_range(
+    const detail::PixelConvertKernels& k,
+    const float* src,
+    void* dst,
+    PixelFormat format,
+    size_t total,
+    size_t begin,
+    size_t end
+) {
+    const float* s = src + begin * 4;
+    const size_t n = end - begin;
+    switch (format) {
+        case PixelFormat::RGBA_F32:
+            std::memcpy(static_cast<float*>(dst) + begin * 4, s, n * 4 * sizeof(float));
+            break;
+        case PixelFormat::RGBA_U8:
+            k.rgba_f32_to_rgba_u8(s, static_cast<uint8_t*>(dst) + begin * 4, n);
+            break;
+        case PixelFormat::RGB_U8:
+            k.rgba_f32_to_rgb_u8(s, static_cast<uint8_t*>(dst) + begin * 3, n);
+            break;
+        case PixelFormat::Planar_F32: {
+            float* base = static_cast<float*>(dst) + begin;
+            float* const planes[4] = { base, base + total, base + 2 * total, base + 3 * total };
+            k.rgba_f32_to_planar_f32(s, planes, n);
+            break;
+        }
+        case PixelFormat::RGBA_F16:
+            k.rgba_f32_to_rgba_f16(s, static_cast<uint16_t*>(dst) + begin * 4, n);
+            break;
+    }
+}
+
+// Convert pixels [begin, end) of src into a float RGBA image
+static void to_rgba_range(
+    const detail::PixelConvertKernels& k,
+    const void* src,
+    PixelFormat format,
+    float* dst,
+    size_t total,
+    size_t begin,
+    size_t end
+) {
+    float* d = dst + begin * 4;
+    const size_t n = end - begin;
+    switch (format) {
+        case PixelFormat::RGBA_F32:
+            std::memcpy(d, static_cast<const float*>(src) + begin * 4, n * 4 * sizeof(float));
+            break;
+        case PixelFormat::RGBA_U8:
+            k.rgba_u8_to_rgba_f32(static_cast<const uint8_t*>(src) + begin * 4, d, n);
+            break;
+        case PixelFormat::RGB_U8:
+            k.rgb_u8_to_rgba_f32(static_cast<const uint8_t*>(src) + begin * 3, d, n);
+            break;
+        case PixelFormat::Planar_F32: {
+            const float* base = static_cast<const float*>(src) + begin;
+            const float* const planes[4] = { base, base + total, base + 2 * total, base + 3 * total };
+            k.planar_f32_to_rgba_f32(planes, d, n);
+            break;
+        }
+        case PixelFormat::RGBA_F16:
+            k.rgba_f16_to_rgba_f32(static_cast<const uint16_t*>(src) + begin * 4, d, n);
+            break;
+    }
+}
+
+// Chunk size for parallel_chunks(): pool chunks of at least
+// CONVERT_CHUNK_PIXELS for large frames, one inline chunk otherwise
+static size_t min_chunk_pixels(size_t pixels) {
+    return pixels >= CONVERT_PARALLEL_PIXELS ? CONVERT_CHUNK_PIXELS : SIZE_MAX;
+}
+
+void convert_from_rgba_f32(const float* src, void* dst, PixelFormat dst_format,
+                           size_t width, size_t height) {
+    const detail::PixelConvertKernels& k = detail::pixel_convert_kernels();
+    const size_t pixels = width * height;
+    detail::parallel_chunks(pixels, min_chunk_pixels(pixels), [&](size_t begin, size_t end, unsigned int) {
+        from_rgba_range(k, src, dst, dst_format, pixels, begin, end);
+    });
+}
+
+void convert_to_rgba_f32(const void* src, PixelFormat src_format, float* dst,
+                         size_t width, size_t height) {
+    const detail::PixelConvertKernels& k = detail::pixel_convert_kernels();
+    const size_t pixels = width * height;
+    detail::parallel_chunks(pixels, min_chunk_pixels(pixels), [&](size_t begin, size_t end, unsigned int) {
+        to_rgba_range(k, src, src_format, dst, pixels, begin, end);
+    });
+}
+
+void convert_from_rgba_f32_baseline(const float* src, void* dst, PixelFormat dst_format,
+                                    size_t width, size_t height) {
+    const size_t pixels = width * height;
+    from_rgba_range(detail::pixel_convert_kernels_scalar, src, dst, dst_format, pixels, 0, pixels);
+}
+
+void convert_to_rgba_f32_baseline(const void* src, PixelFormat src_format, float* dst,
+                                  size_t width, size_t height) {
+    const size_t pixels = width * height;
+    to_rgba_range(detail::pixel_convert_kernels_scalar, src, src_format, dst, pixels, 0, pixels);
+}
+
+} // namespace ares
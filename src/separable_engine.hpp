@@ -0,0 +1,481 @@
+#pragma once
+
+// Row loops of the separable filter engine, written once over an ISA
+// traits type. Included only by the per-ISA kernel translation units
+// (separable_kernels_*.cpp): each defines its traits in an anonymous
+// namespace, so every instantiation is private to the file that was built
+// with the matching -m flags, and fills its SeparableRowKernels table with
+// make_separable_kernels<Traits>().
+//
+// Traits provide, for a vector type V of W floats:
+//   zero(), set1(f), add(a, b), sub(a, b), fmadd(a, b, c)   a * b + c
+//   load(p), store(p, v)             unaligned, W floats
+//   load_n(p, n), store_n(p, v, n)   first n < W floats only; other lanes
+//                                    of memory are neither read nor written
+//   load_rgba_decimated(p)           lane l from p[2l - l % 4]: every other
+//                                    RGBA pixel, reading no float past the
+//                                    last one used
+//   stream(p, v)                     non-temporal store, p aligned to W floats
+//   has_stream                       false when stream() must not be used
+//   min(a, b), max(a, b), abs(a)
+//   keep_ge(x, a, b)                 x in lanes where a >= b, else 0
+//   transpose_pixels(v)              W >= 4 only: v[0..W/4) hold W/4 rows
+//                                    of W/4 RGBA pixels; transposed in place
+
+#include "isa_dispatch.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+namespace ares {
+namespace detail {
+namespace engine {
+
+// Source float of lane l of a decimated load over pixels of C floats
+template<int C>
+constexpr int decimated_offset(int l) {
+    return 2 * l - l % C;
+}
+
+// Partial decimated load for row tails: gathered through a stack buffer
+template<class T, int C>
+inline typename T::V load_decimated_n(const float* p, int n) {
+    alignas(64) float lanes[T::W] = {};
+    for (int l = 0; l < n; ++l) {
+        lanes[l] = p[decimated_offset<C>(l)];
+    }
+    return T::load(lanes);
+}
+
+/**
+ * Weighted sum of n taps, at(k) being the vector for tap k. Two
+ * accumulators alternate so consecutive FMAs are independent. Symmetric
+ * kernels fold tap k with tap n - 1 - k first (added for Even, subtracted
+ * for Odd, whose centre weight is zero), halving the multiplies. With a
+ * non-zero Taps the count is a constant and the loop unrolls completely.
+ */
+template<class T, int Taps, TapSymmetry S, class At>
+inline typename T::V tap_sum(At at, const float* kernel, int kernel_size) {
+    using V = typename T::V;
+    const int n = Taps > 0 ? Taps : kernel_size;
+    V acc0 = T::zero();
+    V acc1 = T::zero();
+
+    if constexpr (S == TapSymmetry::None) {
+        int k = 0;
+        for (; k + 1 < n; k += 2) {
+            acc0 = T::fmadd(at(k), T::set1(kernel[k]), acc0);
+            acc1 = T::fmadd(at(k + 1), T::set1(kernel[k + 1]), acc1);
+        }
+        if (k < n) {
+            acc0 = T::fmadd(at(k), T::set1(kernel[k]), acc0);
+        }
+    } else {
+        auto fold = [&](int k) {
+            if constexpr (S == TapSymmetry::Even) {
+                return T::add(at(k), at(n - 1 - k));
+            } else {
+                return T::sub(at(k), at(n - 1 - k));
+            }
+        };
+        const int half = n / 2;
+        int k = 0;
+        for (; k + 1 < half; k += 2) {
+            acc0 = T::fmadd(fold(k), T::set1(kernel[k]), acc0);
+            acc1 = T::fmadd(fold(k + 1), T::set1(kernel[k + 1]), acc1);
+        }
+        if (k < half) {
+            acc0 = T::fmadd(fold(k), T::set1(kernel[k]), acc0);
+        }
+        if constexpr (S == TapSymmetry::Even) {
+            acc1 = T::fmadd(at(half), T::set1(kernel[half]), acc1);
+        }
+    }
+    return T::add(acc0, acc1);
+}
+
+// One pixel of C floats with border-mapped taps (border columns only).
+// Templated on T although it does not use it, so no instantiation is
+// shared between translation units built for different ISA levels.
+template<class T, int C, BorderMode B>
+inline void border_pixel(
+    const float* src,
+    float* out,
+    const float* kernel,
+    int radius,
+    int width,
+    int x
+) {
+    float sum[C] = {};
+    for (int k = -radius; k <= radius; ++k) {
+        const int sx = border_index<B>(x + k, width);
+        if (sx < 0) {
+            continue;  // BorderMode::Constant: zero outside the image
+        }
+        const float w = kernel[k + radius];
+        for (int c = 0; c < C; ++c) {
+            sum[c] += src[sx * C + c] * w;
+        }
+    }
+    for (int c = 0; c < C; ++c) {
+        out[c] = sum[c];
+    }
+}
+
+// Horizontal pass over pixels of C floats. The interior is one run of
+// floats, so RGBA and single-plane rows share the vector loop; a run that
+// is not a whole number of vectors ends in one partial vector.
+template<class T, int C, int Taps, TapSymmetry S, BorderMode B>
+void horizontal_row(
+    const float* src,
+    float* dst,
+    int width,
+    int x_begin,
+    int x_end,
+    const float* kernel,
+    int radius
+) {
+    const int r = Taps > 0 ? Taps / 2 : radius;
+    const int n = 2 * r + 1;
+
+    // Pixels in [interior_begin, interior_end) never touch the row edges
+    const int interior_begin = std::min(std::max(x_begin, r), x_end);
+    const int interior_end = std::max(std::min(x_end, width - r), interior_begin);
+
+    for (int x = x_begin; x < interior_begin; ++x) {
+        border_pixel<T, C, B>(src, dst + (x - x_begin) * C, kernel, r, width, x);
+    }
+
+    // Output float i reads source floats from i - r * C, one pixel per tap
+    int i = interior_begin * C;
+    const int end = interior_end * C;
+    for (; i + T::W <= end; i += T::W) {
+        const float* p = src + (i - r * C);
+        T::store(dst + (i - x_begin * C),
+                 tap_sum<T, Taps, S>([p](int k) { return T::load(p + k * C); }, kernel, n));
+    }
+    if (i < end) {
+        const float* p = src + (i - r * C);
+        const int rest = end - i;
+        T::store_n(dst + (i - x_begin * C),
+                   tap_sum<T, Taps, S>([p, rest](int k) { return T::load_n(p + k * C, rest); },
+                                       kernel, n),
+                   rest);
+    }
+
+    for (int x = interior_end; x < x_end; ++x) {
+        border_pixel<T, C, B>(src, dst + (x - x_begin) * C, kernel, r, width, x);
+    }
+}
+
+// Horizontal pass with 2x decimation over RGBA pixels: output float j
+// (pixel j / 4) is centred on source float 2j - j % 4
+template<class T, int Taps, TapSymmetry S, BorderMode B>
+void horizontal_down_row(
+    const float* src,
+    float* dst,
+    int width,
+    int x_begin,
+    int x_end,
+    const float* kernel,
+    int radius
+) {
+    constexpr int C = 4;
+    const int r = Taps > 0 ? Taps / 2 : radius;
+    const int n = 2 * r + 1;
+
+    // Output pixels in [interior_begin, interior_end) never touch the edges
+    const int interior_begin = std::min(std::max(x_begin, (r + 1) / 2), x_end);
+    const int interior_end = std::max(std::min(x_end, (width - r + 1) / 2), interior_begin);
+
+    for (int x = x_begin; x < interior_begin; ++x) {
+        border_pixel<T, C, B>(src, dst + (x - x_begin) * C, kernel, r, width, 2 * x);
+    }
+
+    int j = interior_begin * C;
+    const int end = interior_end * C;
+    for (; j + T::W <= end; j += T::W) {
+        const float* p = src + (2 * j - j % C - r * C);
+        T::store(dst + (j - x_begin * C),
+                 tap_sum<T, Taps, S>([p](int k) { return T::load_rgba_decimated(p + k * C); },
+                                     kernel, n));
+    }
+    if (j < end) {
+        const float* p = src + (2 * j - j % C - r * C);
+        const int rest = end - j;
+        T::store_n(dst + (j - x_begin * C),
+                   tap_sum<T, Taps, S>([p, rest](int k) { return load_decimated_n<T, C>(p + k * C, rest); },
+                                       kernel, n),
+                   rest);
+    }
+
+    for (int x = interior_end; x < x_end; ++x) {
+        border_pixel<T, C, B>(src, dst + (x - x_begin) * C, kernel, r, width, 2 * x);
+    }
+}
+
+// Vertical pass epilogues: out(v, i, rest) turns the weighted sum for
+// floats [i, i + rest) into the value stored, rest < W only for the tail
+
+// Plain filter: the sum is the output
+template<class T>
+struct StoreSum {
+    typename T::V operator()(typename T::V sum, size_t, int) const { return sum; }
+};
+
+// Unsharp mask against the source row: s + amount * (s - sum) on colour
+// channels whose difference reaches the threshold, clamped to [0, 1];
+// alpha lanes get a zero amount, so they pass through
+template<class T>
+struct Sharpen {
+    using V = typename T::V;
+    const float* src;
+    alignas(64) float amounts[T::W + 4];
+    V threshold;
+
+    Sharpen(const float* src_row, const SharpenParams& params)
+        : src(src_row), threshold(T::set1(params.threshold)) {
+        for (int l = 0; l < T::W + 4; ++l) {
+            amounts[l] = l % 4 == 3 ? 0.0f : params.amount;
+        }
+    }
+
+    V operator()(V sum, size_t i, int rest) const {
+        const V s = rest == T::W ? T::load(src + i) : T::load_n(src + i, rest);
+        const V detail = T::sub(s, sum);
+        // Vectors start on a pixel, except the one-float scalar "vector"
+        const V amount = T::load(amounts + (T::W % 4 == 0 ? 0 : i % 4));
+        const V sharpened = T::fmadd(T::keep_ge(detail, T::abs(detail), threshold), amount, s);
+        return T::min(T::max(sharpened, T::zero()), T::set1(1.0f));
+    }
+};
+
+template<class T, int Taps, TapSymmetry S, class Out>
+inline void vertical_span(
+    const float* const* rows,
+    float* dst,
+    size_t begin,
+    size_t end,
+    const float* kernel,
+    int kernel_size,
+    const Out& out
+) {
+    size_t i = begin;
+    for (; i + T::W <= end; i += T::W) {
+        T::store(dst + i, out(tap_sum<T, Taps, S>([rows, i](int k) { return T::load(rows[k] + i); },
+                                                  kernel, kernel_size), i, T::W));
+    }
+    if (i < end) {
+        const int rest = static_cast<int>(end - i);
+        T::store_n(dst + i,
+                   out(tap_sum<T, Taps, S>([rows, i, rest](int k) { return T::load_n(rows[k] + i, rest); },
+                                           kernel, kernel_size), i, rest),
+                   rest);
+    }
+}
+
+// Plain stores up to the first vector-aligned float and for the tail;
+// every whole vector in between streams
+template<class T, int Taps, TapSymmetry S, class Out>
+inline void vertical_span_stream(
+    const float* const* rows,
+    float* dst,
+    size_t begin,
+    size_t end,
+    const float* kernel,
+    int kernel_size,
+    const Out& out
+) {
+    if constexpr (!T::has_stream) {
+        vertical_span<T, Taps, S>(rows, dst, begin, end, kernel, kernel_size, out);
+    } else {
+        size_t i = begin;
+        const size_t misaligned = (reinterpret_cast<uintptr_t>(dst + i) / sizeof(float)) % T::W;
+        if (misaligned != 0) {
+            const size_t head = std::min(i + (T::W - misaligned), end);
+            vertical_span<T, Taps, S>(rows, dst, i, head, kernel, kernel_size, out);
+            i = head;
+        }
+        for (; i + T::W <= end; i += T::W) {
+            T::stream(dst + i, out(tap_sum<T, Taps, S>([rows, i](int k) { return T::load(rows[k] + i); },
+                                                       kernel, kernel_size), i, T::W));
+        }
+        vertical_span<T, Taps, S>(rows, dst, i, end, kernel, kernel_size, out);
+    }
+}
+
+template<class T, int Taps, TapSymmetry S>
+void vertical_row(
+    const float* const* rows,
+    float* dst,
+    size_t begin,
+    size_t end,
+    const float* kernel,
+    int kernel_size
+) {
+    vertical_span<T, Taps, S>(rows, dst, begin, end, kernel, kernel_size, StoreSum<T>{});
+}
+
+template<class T, int Taps, TapSymmetry S>
+void vertical_row_stream(
+    const float* const* rows,
+    float* dst,
+    size_t begin,
+    size_t end,
+    const float* kernel,
+    int kernel_size
+) {
+    vertical_span_stream<T, Taps, S>(rows, dst, begin, end, kernel, kernel_size, StoreSum<T>{});
+}
+
+template<class T, int Taps, TapSymmetry S>
+void vertical_row_sharpen(
+    const float* const* rows,
+    const float* src,
+    float* dst,
+    size_t begin,
+    size_t end,
+    const float* kernel,
+    int kernel_size,
+    const SharpenParams& params
+) {
+    vertical_span<T, Taps, S>(rows, dst, begin, end, kernel, kernel_size, Sharpen<T>(src, params));
+}
+
+template<class T, int Taps, TapSymmetry S>
+void vertical_row_sharpen_stream(
+    const float* const* rows,
+    const float* src,
+    float* dst,
+    size_t begin,
+    size_t end,
+    const float* kernel,
+    int kernel_size,
+    const SharpenParams& params
+) {
+    vertical_span_stream<T, Taps, S>(rows, dst, begin, end, kernel, kernel_size, Sharpen<T>(src, params));
+}
+
+// Pixels per side of the cache tiles of transpose_rgba: a 16x16 tile is
+// 4 KB of source and 4 KB of destination, both resident in L1
+constexpr size_t TRANSPOSE_TILE = 16;
+
+// Transpose of an RGBA block: pixel (x, y) of src becomes pixel (y, x) of
+// dst. Inside each cache tile, blocks of W/4 x W/4 pixels go through
+// registers; pixels left over at the tile edges are copied one by one.
+template<class T>
+void transpose_rgba(
+    const float* src,
+    size_t src_stride,
+    float* dst,
+    size_t dst_stride,
+    size_t width,
+    size_t height
+) {
+    constexpr size_t P = T::W >= 4 ? T::W / 4 : 0;
+    auto copy_pixel = [&](size_t x, size_t y) {
+        const float* s = src + y * src_stride + x * 4;
+        float* d = dst + x * dst_stride + y * 4;
+        d[0] = s[0];
+        d[1] = s[1];
+        d[2] = s[2];
+        d[3] = s[3];
+    };
+
+    for (size_t tx = 0; tx < width; tx += TRANSPOSE_TILE) {
+        const size_t tx_end = std::min(tx + TRANSPOSE_TILE, width);
+        for (size_t ty = 0; ty < height; ty += TRANSPOSE_TILE) {
+            const size_t ty_end = std::min(ty + TRANSPOSE_TILE, height);
+            size_t y = ty;
+            if constexpr (P > 0) {
+                for (; y + P <= ty_end; y += P) {
+                    size_t x = tx;
+                    for (; x + P <= tx_end; x += P) {
+                        typename T::V v[P];
+                        for (size_t i = 0; i < P; ++i) {
+                            v[i] = T::load(src + (y + i) * src_stride + x * 4);
+                        }
+                        T::transpose_pixels(v);
+                        for (size_t i = 0; i < P; ++i) {
+                            T::store(dst + (x + i) * dst_stride + y * 4, v[i]);
+                        }
+                    }
+                    for (; x < tx_end; ++x) {
+                        for (size_t i = 0; i < P; ++i) {
+                            copy_pixel(x, y + i);
+                        }
+                    }
+                }
+            }
+            for (; y < ty_end; ++y) {
+                for (size_t x = tx; x < tx_end; ++x) {
+                    copy_pixel(x, y);
+                }
+            }
+        }
+    }
+}
+
+// One instantiation per border mode, in BorderMode order
+template<template<BorderMode> class Fn>
+constexpr void fill_borders(HorizontalRowFn (&out)[BORDER_MODE_COUNT]) {
+    out[0] = Fn<BorderMode::Clamp>::row;
+    out[1] = Fn<BorderMode::Mirror>::row;
+    out[2] = Fn<BorderMode::Wrap>::row;
+    out[3] = Fn<BorderMode::Constant>::row;
+}
+
+template<class T, int C, int Taps, TapSymmetry S>
+struct Horizontal {
+    template<BorderMode B>
+    struct At {
+        static constexpr HorizontalRowFn row = horizontal_row<T, C, Taps, S, B>;
+    };
+};
+
+template<class T, int Taps, TapSymmetry S>
+struct HorizontalDown {
+    template<BorderMode B>
+    struct At {
+        static constexpr HorizontalRowFn row = horizontal_down_row<T, Taps, S, B>;
+    };
+};
+
+template<class T, TapSymmetry S, int Class>
+constexpr void fill_tap_class(SeparableRowKernels& kernels) {
+    constexpr int Taps = TAP_CLASS_TAPS[Class];
+    constexpr int sym = static_cast<int>(S);
+    constexpr int rgba = static_cast<int>(ChannelLayout::RGBA);
+    constexpr int plane = static_cast<int>(ChannelLayout::Plane);
+
+    fill_borders<Horizontal<T, 4, Taps, S>::template At>(kernels.horizontal[rgba][sym][Class]);
+    fill_borders<Horizontal<T, 1, Taps, S>::template At>(kernels.horizontal[plane][sym][Class]);
+    fill_borders<HorizontalDown<T, Taps, S>::template At>(kernels.horizontal_down[sym][Class]);
+    kernels.vertical[sym][Class] = vertical_row<T, Taps, S>;
+    kernels.vertical_stream[sym][Class] = vertical_row_stream<T, Taps, S>;
+    kernels.vertical_sharpen[sym][Class] = vertical_row_sharpen<T, Taps, S>;
+    kernels.vertical_sharpen_stream[sym][Class] = vertical_row_sharpen_stream<T, Taps, S>;
+}
+
+template<class T, TapSymmetry S, int... Class>
+constexpr void fill_symmetry(SeparableRowKernels& kernels, std::integer_sequence<int, Class...>) {
+    (fill_tap_class<T, S, Class>(kernels), ...);
+}
+
+} // namespace engine
+
+// Every row primitive of one ISA level, for every symmetry and tap class
+template<class T>
+constexpr SeparableRowKernels make_separable_kernels(const char* name) {
+    SeparableRowKernels kernels{};
+    kernels.name = name;
+    constexpr auto classes = std::make_integer_sequence<int, TAP_CLASS_COUNT>{};
+    engine::fill_symmetry<T, TapSymmetry::None>(kernels, classes);
+    engine::fill_symmetry<T, TapSymmetry::Even>(kernels, classes);
+    engine::fill_symmetry<T, TapSymmetry::Odd>(kernels, classes);
+    kernels.transpose_rgba = engine::transpose_rgba<T>;
+    return kernels;
+}
+
+} // namespace detail
+} // namespace ares
@@ -0,0 +1,180 @@
+#include "ares/separable_filter.hpp"
+#include "ares/tile_tuning.hpp"
+#include "ares/trace.hpp"
+#include "separable_region.hpp"
+#include <immintrin.h>
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
+namespace ares {
+
+// Exact comparisons: only kernels that really are mirror images fold
+static TapSymmetry detect_symmetry(const std::vector<float>& taps) {
+    const size_t n = taps.size();
+    bool even = true;
+    bool odd = taps[n / 2] == 0.0f;
+    for (size_t k = 0; k < n / 2; ++k) {
+        even = even && taps[k] == taps[n - 1 - k];
+        odd = odd && taps[k] == -taps[n - 1 - k];
+    }
+    if (even) {
+        return TapSymmetry::Even;
+    }
+    return odd ? TapSymmetry::Odd : TapSymmetry::None;
+}
+
+SeparableFilter::SeparableFilter(std::span<const float> horizontal, std::span<const float> vertical) {
+    if (horizontal.size() % 2 == 0 || vertical.size() % 2 == 0) {
+        return;  // Empty or even length: not valid()
+    }
+    horizontal_.assign(horizontal.begin(), horizontal.end());
+    vertical_.assign(vertical.begin(), vertical.end());
+    horizontal_symmetry_ = detect_symmetry(horizontal_);
+    vertical_symmetry_ = detect_symmetry(vertical_);
+}
+
+SeparableFilter SeparableFilter::gaussian(float sigma) {
+    ARES_TRACE_SCOPE("blur.kernel");
+    const int radius = static_cast<int>(std::ceil(3.0f * sigma));
+    const int size = 2 * radius + 1;
+    std::vector<float> taps(size);
+
+    float sum = 0.0f;
+    for (int i = 0; i < size; ++i) {
+        float x = static_cast<float>(i - radius);
+        taps[i] = std::exp(-(x * x) / (2.0f * sigma * sigma));
+        sum += taps[i];
+    }
+    for (int i = 0; i < size; ++i) {
+        taps[i] /= sum;
+    }
+
+    return SeparableFilter(taps, taps);
+}
+
+SeparableFilter SeparableFilter::box(int radius) {
+    const int size = 2 * std::max(radius, 0) + 1;
+    const std::vector<float> taps(size, 1.0f / static_cast<float>(size));
+    return SeparableFilter(taps, taps);
+}
+
+SeparableFilter SeparableFilter::sobel_x() {
+    const float derivative[] = { -1.0f, 0.0f, 1.0f };
+    const float smooth[] = { 1.0f, 2.0f, 1.0f };
+    return SeparableFilter(derivative, smooth);
+}
+
+SeparableFilter SeparableFilter::sobel_y() {
+    const float derivative[] = { -1.0f, 0.0f, 1.0f };
+    const float smooth[] = { 1.0f, 2.0f, 1.0f };
+    return SeparableFilter(smooth, derivative);
+}
+
+SeparableFilter SeparableFilter::scharr_x() {
+    const float derivative[] = { -1.0f, 0.0f, 1.0f };
+    const float smooth[] = { 3.0f, 10.0f, 3.0f };
+    return SeparableFilter(derivative, smooth);
+}
+
+SeparableFilter SeparableFilter::scharr_y() {
+    const float derivative[] = { -1.0f, 0.0f, 1.0f };
+    const float smooth[] = { 3.0f, 10.0f, 3.0f };
+    return SeparableFilter(smooth, derivative);
+}
+
+namespace detail {
+
+void filter_image(
+    const SeparableRowKernels& kernels,
+    const float* input,
+    float* output,
+    size_t width,
+    size_t height,
+    ChannelLayout layout,
+    const SeparableFilter& filter,
+    BorderMode border
+) {
+    const int channels = layout == ChannelLayout::RGBA ? 4 : 1;
+    const int w = static_cast<int>(width);
+    const int h = static_cast<int>(height);
+    const size_t row_floats = width * channels;
+    const int vertical_radius = filter.vertical_radius();
+
+    // Temporary buffer for horizontal pass: every float is written before
+    // the vertical pass reads it
+    float* temp;
+    {
+        ARES_TRACE_SCOPE("blur.temp_alloc");
+        temp = static_cast<float*>(_mm_malloc(row_floats * height * sizeof(float), 64));
+    }
+
+    // Horizontal pass (border mode, tap count and symmetry are template
+    // parameters of the row kernel)
+    const HorizontalRowFn horizontal = kernels.horizontal_for(border, layout, filter);
+    {
+        ARES_TRACE_SCOPE("blur.horizontal");
+        for (int y = 0; y < h; ++y) {
+            horizontal(input + y * row_floats, temp + y * row_floats,
+                       w, 0, w, filter.horizontal().data(), filter.horizontal_radius());
+        }
+    }
+
+    // Vertical pass: border-resolved source row per tap, once per row, so
+    // the vertical kernel itself has no bounds logic
+    std::vector<const float*> rows(filter.vertical().size());
+    std::vector<float> zero_row(border == BorderMode::Constant ? row_floats : 0, 0.0f);
+    const bool stream = gaussian_streams_output(row_floats * height * sizeof(float));
+    const VerticalRowFn vertical = kernels.vertical_for(stream, filter);
+    {
+        ARES_TRACE_SCOPE("blur.vertical");
+        for (int y = 0; y < h; ++y) {
+            resolve_tap_rows(border, temp, row_floats, zero_row.data(),
+                             y, vertical_radius, h, rows.data());
+            vertical(rows.data(), output + y * row_floats, 0, row_floats,
+                     filter.vertical().data(), static_cast<int>(rows.size()));
+        }
+        if (stream) {
+            _mm_sfence();
+        }
+    }
+
+    _mm_free(temp);
+}
+
+} // namespace detail
+
+void separable_filter_simd(
+    const Image& input,
+    Image& output,
+    const SeparableFilter& filter,
+    BorderMode border
+) {
+    ARES_TRACE_SCOPE("separable_filter_simd");
+    if (input.width != output.width || input.height != output.height || !filter.valid()) {
+        return;
+    }
+
+    // Widest ISA the CPU supports (or ARES_FORCE_ISA), resolved once
+    detail::filter_image(detail::separable_kernels(), input.data, output.data,
+                         input.width, input.height, ChannelLayout::RGBA, filter, border);
+}
+
+void separable_filter_plane(
+    const float* src,
+    float* dst,
+    size_t width,
+    size_t height,
+    const SeparableFilter& filter,
+    BorderMode border
+) {
+    ARES_TRACE_SCOPE("separable_filter_plane");
+    if (width == 0 || height == 0 || !filter.valid()) {
+        return;
+    }
+
+    detail::filter_image(detail::separable_kernels(), src, dst, width, height,
+                         ChannelLayout::Plane, filter, border);
+}
+
+} // namespace ares
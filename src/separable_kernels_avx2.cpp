@@ -0,0 +1,56 @@
+#include "separable_engine.hpp"
+#include <immintrin.h>
+
+// Built with -mavx2 -mfma. Each __m256 holds two RGBA pixels or eight
+// plane pixels; a row that ends mid-register uses masked loads/stores.
+
+namespace ares {
+namespace detail {
+
+namespace {
+
+struct Avx2 {
+    using V = __m256;
+    static constexpr int W = 8;
+    static constexpr bool has_stream = true;
+
+    // Lane mask for _mm256_maskload_ps: the first n lanes
+    static __m256i mask(int n) {
+        return _mm256_cmpgt_epi32(_mm256_set1_epi32(n), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    }
+
+    static V zero() { return _mm256_setzero_ps(); }
+    static V set1(float f) { return _mm256_set1_ps(f); }
+    static V add(V a, V b) { return _mm256_add_ps(a, b); }
+    static V sub(V a, V b) { return _mm256_sub_ps(a, b); }
+    static V fmadd(V a, V b, V c) { return _mm256_fmadd_ps(a, b, c); }
+    static V load(const float* p) { return _mm256_loadu_ps(p); }
+    static void store(float* p, V v) { _mm256_storeu_ps(p, v); }
+    static V load_n(const float* p, int n) { return _mm256_maskload_ps(p, mask(n)); }
+    static void store_n(float* p, V v, int n) { _mm256_maskstore_ps(p, mask(n), v); }
+
+    // Source pixels 0 and 2 in the two halves
+    static V load_rgba_decimated(const float* p) {
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(p + 8), 1);
+    }
+
+    static void stream(float* p, V v) { _mm256_stream_ps(p, v); }
+
+    // 2x2 pixels: swap the high pixel of row 0 with the low pixel of row 1
+    static void transpose_pixels(V (&v)[2]) {
+        const V row0 = v[0];
+        v[0] = _mm256_permute2f128_ps(row0, v[1], 0x20);
+        v[1] = _mm256_permute2f128_ps(row0, v[1], 0x31);
+    }
+    static V min(V a, V b) { return _mm256_min_ps(a, b); }
+    static V max(V a, V b) { return _mm256_max_ps(a, b); }
+    static V abs(V a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    static V keep_ge(V x, V a, V b) { return _mm256_and_ps(_mm256_cmp_ps(a, b, _CMP_GE_OQ), x); }
+};
+
+} // namespace
+
+constinit const SeparableRowKernels separable_kernels_avx2 = make_separable_kernels<Avx2>("avx2");
+
+} // namespace detail
+} // namespace ares
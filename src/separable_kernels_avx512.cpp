@@ -0,0 +1,68 @@
+#include "separable_engine.hpp"
+#include <immintrin.h>
+
+// Built with -mavx512f. Nothing in here may be reached before the runtime
+// dispatch in cpu_dispatch.cpp has confirmed AVX-512F support. Each
+// __m512 holds four RGBA pixels or sixteen plane pixels; row tails use
+// masked loads/stores instead of scalar cleanup loops.
+
+namespace ares {
+namespace detail {
+
+namespace {
+
+struct Avx512 {
+    using V = __m512;
+    static constexpr int W = 16;
+    static constexpr bool has_stream = true;
+
+    // Mask selecting the first n float lanes (n in [0, 16])
+    static __mmask16 mask(int n) { return static_cast<__mmask16>((1u << n) - 1u); }
+
+    static V zero() { return _mm512_setzero_ps(); }
+    static V set1(float f) { return _mm512_set1_ps(f); }
+    static V add(V a, V b) { return _mm512_add_ps(a, b); }
+    static V sub(V a, V b) { return _mm512_sub_ps(a, b); }
+    static V fmadd(V a, V b, V c) { return _mm512_fmadd_ps(a, b, c); }
+    static V load(const float* p) { return _mm512_loadu_ps(p); }
+    static void store(float* p, V v) { _mm512_storeu_ps(p, v); }
+    static V load_n(const float* p, int n) { return _mm512_maskz_loadu_ps(mask(n), p); }
+    static void store_n(float* p, V v, int n) { _mm512_mask_storeu_ps(p, mask(n), v); }
+
+    // Source pixels 0, 2, 4 and 6: the 7 pixels spanned are loaded (the
+    // second load masked so it stops at the last one used) and the even
+    // ones picked with a two-source permute
+    static V load_rgba_decimated(const float* p) {
+        const __m512i even = _mm512_setr_epi32(0, 1, 2, 3, 8, 9, 10, 11,
+                                               16, 17, 18, 19, 24, 25, 26, 27);
+        return _mm512_permutex2var_ps(_mm512_loadu_ps(p), even, _mm512_maskz_loadu_ps(mask(12), p + 16));
+    }
+
+    static void stream(float* p, V v) { _mm512_stream_ps(p, v); }
+
+    // 4x4 pixels in two rounds of 128-bit lane shuffles: pairs of rows
+    // first, then pairs of those (zero-masked forms, see min/max below)
+    static void transpose_pixels(V (&v)[4]) {
+        const V t0 = _mm512_maskz_shuffle_f32x4(0xFFFF, v[0], v[1], 0x44);  // r0p0 r0p1 r1p0 r1p1
+        const V t1 = _mm512_maskz_shuffle_f32x4(0xFFFF, v[0], v[1], 0xEE);  // r0p2 r0p3 r1p2 r1p3
+        const V t2 = _mm512_maskz_shuffle_f32x4(0xFFFF, v[2], v[3], 0x44);
+        const V t3 = _mm512_maskz_shuffle_f32x4(0xFFFF, v[2], v[3], 0xEE);
+        v[0] = _mm512_maskz_shuffle_f32x4(0xFFFF, t0, t2, 0x88);
+        v[1] = _mm512_maskz_shuffle_f32x4(0xFFFF, t0, t2, 0xDD);
+        v[2] = _mm512_maskz_shuffle_f32x4(0xFFFF, t1, t3, 0x88);
+        v[3] = _mm512_maskz_shuffle_f32x4(0xFFFF, t1, t3, 0xDD);
+    }
+    // Zero-masked forms: GCC 12 flags the unmasked ones' undefined
+    // passthrough operand as maybe-uninitialized
+    static V min(V a, V b) { return _mm512_maskz_min_ps(0xFFFF, a, b); }
+    static V max(V a, V b) { return _mm512_maskz_max_ps(0xFFFF, a, b); }
+    static V abs(V a) { return _mm512_abs_ps(a); }
+    static V keep_ge(V x, V a, V b) { return _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(a, b, _CMP_GE_OQ), x); }
+};
+
+} // namespace
+
+constinit const SeparableRowKernels separable_kernels_avx512 = make_separable_kernels<Avx512>("avx512");
+
+} // namespace detail
+} // namespace ares
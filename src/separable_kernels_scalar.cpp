@@ -0,0 +1,39 @@
+#include "separable_engine.hpp"
+
+// Portable row kernels used when ARES_FORCE_ISA=scalar or the CPU lacks
+// SSE4.2: the engine's loops with a one-float "vector".
+
+namespace ares {
+namespace detail {
+
+namespace {
+
+struct Scalar {
+    using V = float;
+    static constexpr int W = 1;
+    static constexpr bool has_stream = false;  // no portable non-temporal store
+
+    static V zero() { return 0.0f; }
+    static V set1(float f) { return f; }
+    static V add(V a, V b) { return a + b; }
+    static V sub(V a, V b) { return a - b; }
+    static V fmadd(V a, V b, V c) { return a * b + c; }
+    static V load(const float* p) { return *p; }
+    static void store(float* p, V v) { *p = v; }
+    // W == 1: rows never end in a partial vector
+    static V load_n(const float* p, int) { return *p; }
+    static void store_n(float* p, V v, int) { *p = v; }
+    static V load_rgba_decimated(const float* p) { return *p; }
+    static void stream(float* p, V v) { *p = v; }
+    static V min(V a, V b) { return a < b ? a : b; }
+    static V max(V a, V b) { return a > b ? a : b; }
+    static V abs(V a) { return a < 0.0f ? -a : a; }
+    static V keep_ge(V x, V a, V b) { return a >= b ? x : 0.0f; }
+};
+
+} // namespace
+
+constinit const SeparableRowKernels separable_kernels_scalar = make_separable_kernels<Scalar>("scalar");
+
+} // namespace detail
+} // namespace ares
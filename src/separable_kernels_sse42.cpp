@@ -0,0 +1,55 @@
+#include "separable_engine.hpp"
+#include <immintrin.h>
+#include <cstring>
+
+// Built with -msse4.2. One RGBA pixel is exactly one __m128, so RGBA rows
+// have no tail; single-plane tails go through a small stack buffer. No
+// FMA at this level: multiply and add are separate.
+
+namespace ares {
+namespace detail {
+
+namespace {
+
+struct Sse42 {
+    using V = __m128;
+    static constexpr int W = 4;
+    static constexpr bool has_stream = true;
+
+    static V zero() { return _mm_setzero_ps(); }
+    static V set1(float f) { return _mm_set1_ps(f); }
+    static V add(V a, V b) { return _mm_add_ps(a, b); }
+    static V sub(V a, V b) { return _mm_sub_ps(a, b); }
+    static V fmadd(V a, V b, V c) { return _mm_add_ps(c, _mm_mul_ps(a, b)); }
+    static V load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, V v) { _mm_storeu_ps(p, v); }
+
+    static V load_n(const float* p, int n) {
+        alignas(16) float lanes[4] = {};
+        std::memcpy(lanes, p, n * sizeof(float));
+        return _mm_load_ps(lanes);
+    }
+
+    static void store_n(float* p, V v, int n) {
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, v);
+        std::memcpy(p, lanes, n * sizeof(float));
+    }
+
+    static V load_rgba_decimated(const float* p) { return _mm_loadu_ps(p); }
+    static void stream(float* p, V v) { _mm_stream_ps(p, v); }
+
+    // One pixel per register: nothing to move
+    static void transpose_pixels(V (&)[1]) {}
+    static V min(V a, V b) { return _mm_min_ps(a, b); }
+    static V max(V a, V b) { return _mm_max_ps(a, b); }
+    static V abs(V a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+    static V keep_ge(V x, V a, V b) { return _mm_and_ps(_mm_cmpge_ps(a, b), x); }
+};
+
+} // namespace
+
+constinit const SeparableRowKernels separable_kernels_sse42 = make_separable_kernels<Sse42>("sse4.2");
+
+} // namespace detail
+} // namespace ares
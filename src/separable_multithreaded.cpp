@@ -0,0 +1,163 @@
+#include "ares/separable_filter.hpp"
+#include "ares/numa.hpp"
+#include "ares/tile_tuning.hpp"
+#include "ares/trace.hpp"
+#include "isa_dispatch.hpp"
+#include "numa_placement.hpp"
+#include <immintrin.h>
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace ares {
+
+// Worker function for horizontal pass
+static void horizontal_pass_worker(
+    detail::HorizontalRowFn horizontal,
+    const Image& input,
+    Image& temp,
+    const SeparableFilter& filter,
+    size_t start_row,
+    size_t end_row,
+    int cpu
+) {
+    if (cpu >= 0) {
+        detail::pin_current_thread(static_cast<unsigned int>(cpu));
+    }
+    ARES_TRACE_THREAD_NAME("blur worker");
+    ARES_TRACE_SCOPE("blur.horizontal");
+    const int width = static_cast<int>(input.width);
+    const size_t row_floats = input.width * 4;
+    
+    for (size_t y = start_row; y < end_row; ++y) {
+        horizontal(input.data + y * row_floats,
+                           temp.data + y * row_floats,
+                           width, 0, width, filter.horizontal().data(), filter.horizontal_radius());
+    }
+}
+
+// Worker function for vertical pass
+static void vertical_pass_worker(
+    const detail::SeparableRowKernels& kernels,
+    const Image& temp,
+    Image& output,
+    const SeparableFilter& filter,
+    BorderMode border,
+    bool stream_output,
+    size_t start_row,
+    size_t end_row,
+    int cpu
+) {
+    if (cpu >= 0) {
+        detail::pin_current_thread(static_cast<unsigned int>(cpu));
+    }
+    ARES_TRACE_THREAD_NAME("blur worker");
+    ARES_TRACE_SCOPE("blur.vertical");
+    const int radius = filter.vertical_radius();
+    const int kernel_size = 2 * radius + 1;
+    const int height = static_cast<int>(temp.height);
+    const size_t row_floats = temp.width * 4;
+    std::vector<const float*> rows(kernel_size);
+    std::vector<float> zero_row(border == BorderMode::Constant ? row_floats : 0, 0.0f);
+    
+    const detail::VerticalRowFn vertical = kernels.vertical_for(stream_output, filter);
+    
+    for (size_t y = start_row; y < end_row; ++y) {
+        detail::resolve_tap_rows(border, temp.data, row_floats, zero_row.data(),
+                                 static_cast<int>(y), radius, height, rows.data());
+        vertical(rows.data(), output.data + y * row_floats,
+                 0, row_floats, filter.vertical().data(), kernel_size);
+    }
+    
+    // Streaming stores are weakly ordered: drain them before the join
+    if (stream_output) {
+        _mm_sfence();
+    }
+}
+
+void separable_filter_multithreaded(
+    const Image& input,
+    Image& output,
+    const SeparableFilter& filter,
+    BorderMode border
+) {
+    ARES_TRACE_SCOPE("separable_filter_multithreaded");
+    if (input.width != output.width || input.height != output.height || !filter.valid()) {
+        return;
+    }
+    
+    // Not zero-filled: the horizontal pass writes every row, so each band's
+    // pages are first touched by the worker that later reads them
+    Image temp = Image::uninitialized(input.width, input.height);
+    
+    // Row kernels for the widest ISA the CPU supports
+    const detail::SeparableRowKernels& kernels = detail::separable_kernels();
+    
+    // With NUMA placement, one pinned worker per allowed CPU, node by node;
+    // otherwise one unpinned worker per hardware thread
+    const std::vector<unsigned int> cpus = blur_worker_cpus();
+    unsigned int num_threads = static_cast<unsigned int>(cpus.size());
+    if (num_threads == 0) {
+        num_threads = std::thread::hardware_concurrency();
+        if (num_threads == 0) num_threads = 4; // fallback
+    }
+    auto worker_cpu = [&](unsigned int t) { return cpus.empty() ? -1 : static_cast<int>(cpus[t]); };
+    
+    // Horizontal pass with multi-threading
+    {
+        std::vector<std::thread> threads;
+        
+        for (unsigned int t = 0; t < num_threads; ++t) {
+            size_t start_row, end_row;
+            detail::band_rows(t, num_threads, input.height, start_row, end_row);
+            
+            threads.emplace_back(horizontal_pass_worker,
+                               kernels.horizontal_for(border, ChannelLayout::RGBA, filter),
+                               std::ref(input),
+                               std::ref(temp),
+                               std::cref(filter),
+                               start_row,
+                               end_row,
+                               worker_cpu(t));
+        }
+        
+        // Static row partitions: time spent here is the imbalance
+        ARES_TRACE_SCOPE("blur.join");
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+    
+    // Large outputs bypass the cache (see tile_tuning.hpp)
+    const bool stream = gaussian_streams_output(output.size_bytes());
+    
+    // Vertical pass with multi-threading: same bands on the same CPUs, so
+    // only the radius rows at band edges are read from another worker
+    {
+        std::vector<std::thread> threads;
+        
+        for (unsigned int t = 0; t < num_threads; ++t) {
+            size_t start_row, end_row;
+            detail::band_rows(t, num_threads, input.height, start_row, end_row);
+            
+            threads.emplace_back(vertical_pass_worker,
+                               std::cref(kernels),
+                               std::ref(temp),
+                               std::ref(output),
+                               std::cref(filter),
+                               border,
+                               stream,
+                               start_row,
+                               end_row,
+                               worker_cpu(t));
+        }
+        
+        ARES_TRACE_SCOPE("blur.join");
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+}
+
+} // namespace ares
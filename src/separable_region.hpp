@@ -0,0 +1,56 @@
+#pragma once
+
+// Whole-image and region passes of the separable filter engine, shared by
+// the separable_filter_* and gaussian_blur_* front-ends.
+
+#include "ares/gaussian_blur.hpp"
+#include "ares/separable_filter.hpp"
+#include "isa_dispatch.hpp"
+
+namespace ares {
+namespace detail {
+
+/**
+ * Full horizontal pass into a temporary buffer, then the vertical pass
+ * (separable_filter.cpp). Rows are width pixels of `layout`, contiguous;
+ * output must not alias input. Large outputs are streamed past the cache.
+ */
+void filter_image(
+    const SeparableRowKernels& kernels,
+    const float* input,
+    float* output,
+    size_t width,
+    size_t height,
+    ChannelLayout layout,
+    const SeparableFilter& filter,
+    BorderMode border
+);
+
+/**
+ * Filter the rectangle `roi` of input into the same rectangle of output
+ * using cache-sized tiles (separable_tiled.cpp). `temp` must hold
+ * region_temp_floats(roi, filter) floats. With `stream_output` the output
+ * is written with non-temporal stores, fenced after every band of tiles.
+ * With `sharpen` the output is the unsharp mask of the input by the
+ * filtered values (vertical_sharpen) instead of the filtered values.
+ */
+void filter_region_tiled(
+    const SeparableRowKernels& kernels,
+    const Image& input,
+    Image& output,
+    const Rect& roi,
+    const SeparableFilter& filter,
+    BorderMode border,
+    float* temp,
+    bool stream_output,
+    const SharpenParams* sharpen = nullptr
+);
+
+// Floats of horizontal-pass scratch needed for one region
+size_t region_temp_floats(const Rect& roi, const SeparableFilter& filter);
+
+// Clip a rectangle to the image bounds
+Rect clip_rect(const Rect& r, const Image& image);
+
+} // namespace detail
+} // namespace ares
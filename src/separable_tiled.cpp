@@ -0,0 +1,253 @@
+#include "ares/separable_filter.hpp"
+#include "ares/tile_tuning.hpp"
+#include "ares/trace.hpp"
+#include "separable_region.hpp"
+#include "thread_pool.hpp"
+#include <immintrin.h>
+#include <algorithm>
+#include <vector>
+
+namespace ares {
+
+namespace detail {
+
+// Software prefetch of `floats` contiguous floats, one hint per cache line
+static inline void prefetch_span(const float* p, size_t floats, size_t line_bytes) {
+    const char* bytes = reinterpret_cast<const char*>(p);
+    for (size_t offset = 0; offset < floats * sizeof(float); offset += line_bytes) {
+        _mm_prefetch(bytes + offset, _MM_HINT_T0);
+    }
+}
+
+// The horizontal pass convolves only the ROI columns of the roi.height +
+// 2 * radius apron rows (radius of the vertical kernel) into `temp`
+// (roi.width * 4 floats per row). Apron rows beyond the image are resolved
+// by the border mode here, once per row, so the vertical pass reads temp
+// rows with no bounds logic at all.
+void filter_region_tiled(
+    const SeparableRowKernels& kernels,
+    const Image& input,
+    Image& output,
+    const Rect& roi,
+    const SeparableFilter& filter,
+    BorderMode border,
+    float* temp,
+    bool stream_output,
+    const SharpenParams* sharpen
+) {
+    const float* horizontal_kernel = filter.horizontal().data();
+    const float* vertical_kernel = filter.vertical().data();
+    const int horizontal_radius = filter.horizontal_radius();
+    const int radius = filter.vertical_radius();
+    const int kernel_size = 2 * radius + 1;
+    const int width = static_cast<int>(input.width);
+    const int height = static_cast<int>(input.height);
+    const size_t row_floats = input.width * 4;
+    const size_t temp_row_floats = roi.width * 4;
+    const HorizontalRowFn horizontal = kernels.horizontal_for(border, ChannelLayout::RGBA, filter);
+    const VerticalRowFn vertical = kernels.vertical_for(stream_output, filter);
+    const VerticalSharpenFn vertical_sharpen = kernels.vertical_sharpen_for(stream_output, filter);
+    
+    // Tile geometry from the cache sizes (see tile_tuning.hpp)
+    const TileConfig tiles = gaussian_tile_config(std::max(radius, horizontal_radius), roi.width);
+    const size_t ahead = static_cast<size_t>(tiles.prefetch_rows);
+    const size_t line_bytes = cache_info().line_bytes;
+    
+    const size_t roi_end_x = roi.x + roi.width;
+    const size_t roi_end_y = roi.y + roi.height;
+    
+    // Apron rows, as offsets from roi.y - radius
+    const size_t apron_rows = roi.height + 2 * radius;
+    const int apron_y = static_cast<int>(roi.y) - radius;
+    
+    // Horizontal pass with tiling
+    {
+        ARES_TRACE_SCOPE("blur.horizontal");
+        for (size_t tile_r = 0; tile_r < apron_rows; tile_r += tiles.height) {
+            size_t tile_end_r = std::min(tile_r + tiles.height, apron_rows);
+        
+            for (size_t tile_x = roi.x; tile_x < roi_end_x; tile_x += tiles.width) {
+                size_t tile_end_x = std::min(tile_x + tiles.width, roi_end_x);
+            
+                // Process current tile
+                for (size_t r = tile_r; r < tile_end_r; ++r) {
+                    // Prefetch the source row this loop reaches `ahead` rows
+                    // from now: further down the tile, or the top of the next
+                    // tile to the right (taps included)
+                    if (ahead > 0) {
+                        size_t pr = r + ahead;
+                        size_t px = tile_x;
+                        size_t px_end = tile_end_x;
+                        if (pr >= tile_end_r) {
+                            pr = tile_r + (pr - tile_end_r);
+                            px = tile_end_x;
+                            px_end = std::min(tile_end_x + tiles.width, roi_end_x);
+                        }
+                        int py = border_index(border, apron_y + static_cast<int>(pr), height);
+                        if (pr < tile_end_r && px < px_end && py >= 0) {
+                            size_t from = px > static_cast<size_t>(horizontal_radius) ? px - horizontal_radius : 0;
+                            size_t to = std::min(px_end + horizontal_radius, input.width);
+                            prefetch_span(input.data + py * row_floats + from * 4, (to - from) * 4, line_bytes);
+                        }
+                    }
+                
+                    float* dst = temp + r * temp_row_floats + (tile_x - roi.x) * 4;
+                    int sample_y = border_index(border, apron_y + static_cast<int>(r), height);
+                    if (sample_y < 0) {
+                        // Constant border: the whole row is outside the image
+                        std::fill(dst, dst + (tile_end_x - tile_x) * 4, 0.0f);
+                        continue;
+                    }
+                
+                    const float* src = input.data + sample_y * row_floats;
+                    horizontal(src, dst, width,
+                               static_cast<int>(tile_x),
+                               static_cast<int>(tile_end_x),
+                               horizontal_kernel, horizontal_radius);
+                }
+            }
+        }
+    }
+    
+    // Vertical pass with tiling
+    std::vector<const float*> rows(kernel_size);
+    {
+        ARES_TRACE_SCOPE("blur.vertical");
+        for (size_t tile_y = roi.y; tile_y < roi_end_y; tile_y += tiles.height) {
+            size_t tile_end_y = std::min(tile_y + tiles.height, roi_end_y);
+        
+            for (size_t tile_x = roi.x; tile_x < roi_end_x; tile_x += tiles.width) {
+                size_t tile_end_x = std::min(tile_x + tiles.width, roi_end_x);
+            
+                for (size_t y = tile_y; y < tile_end_y; ++y) {
+                    // Prefetch the temp row entering the kernel window `ahead`
+                    // rows from now, or a top row of the next tile's window
+                    if (ahead > 0) {
+                        size_t pr = y - roi.y + 2 * radius + ahead;
+                        size_t px = tile_x;
+                        size_t px_end = tile_end_x;
+                        if (y + ahead >= tile_end_y) {
+                            pr = tile_y - roi.y + (y + ahead - tile_end_y);
+                            px = tile_end_x;
+                            px_end = std::min(tile_end_x + tiles.width, roi_end_x);
+                        }
+                        if (pr < apron_rows && px < px_end) {
+                            prefetch_span(temp + pr * temp_row_floats + (px - roi.x) * 4,
+                                          (px_end - px) * 4, line_bytes);
+                        }
+                    }
+                
+                    // Output row y uses apron rows [y - roi.y, y - roi.y + 2 * radius]
+                    const float* first = temp + (y - roi.y) * temp_row_floats;
+                    for (int k = 0; k < kernel_size; ++k) {
+                        rows[k] = first + k * temp_row_floats;
+                    }
+                    float* dst = output.data + y * row_floats + roi.x * 4;
+                    if (sharpen) {
+                        vertical_sharpen(rows.data(), input.data + y * row_floats + roi.x * 4, dst,
+                                         (tile_x - roi.x) * 4, (tile_end_x - roi.x) * 4,
+                                         vertical_kernel, kernel_size, *sharpen);
+                        continue;
+                    }
+                    vertical(rows.data(), dst,
+                             (tile_x - roi.x) * 4, (tile_end_x - roi.x) * 4,
+                             vertical_kernel, kernel_size);
+                }
+            }
+            
+            if (stream_output) {
+                _mm_sfence();
+            }
+        }
+    }
+}
+
+Rect clip_rect(const Rect& r, const Image& image) {
+    Rect clipped;
+    clipped.x = std::min(r.x, image.width);
+    clipped.y = std::min(r.y, image.height);
+    clipped.width = std::min(r.width, image.width - clipped.x);
+    clipped.height = std::min(r.height, image.height - clipped.y);
+    return clipped;
+}
+
+size_t region_temp_floats(const Rect& roi, const SeparableFilter& filter) {
+    return roi.width * 4 * (roi.height + 2 * filter.vertical_radius());
+}
+
+} // namespace detail
+
+void separable_filter_tiled(
+    const Image& input,
+    Image& output,
+    const SeparableFilter& filter,
+    BorderMode border
+) {
+    ARES_TRACE_SCOPE("separable_filter_tiled");
+    if (input.width != output.width || input.height != output.height || !filter.valid()) {
+        return;
+    }
+    
+    // Whole image is one region (plus radius border rows above and below)
+    Rect full{ 0, 0, input.width, input.height };
+    float* temp;
+    {
+        ARES_TRACE_SCOPE("blur.temp_alloc");
+        temp = static_cast<float*>(
+            _mm_malloc(detail::region_temp_floats(full, filter) * sizeof(float), 64));
+    }
+    
+    detail::filter_region_tiled(detail::separable_kernels(), input, output, full,
+                                filter, border, temp,
+                                gaussian_streams_output(output.size_bytes()));
+    
+    _mm_free(temp);
+}
+
+void separable_filter_rois(
+    const Image& input,
+    Image& output,
+    std::span<const Rect> rois,
+    const SeparableFilter& filter,
+    BorderMode border
+) {
+    ARES_TRACE_SCOPE("separable_filter_rois");
+    if (input.width != output.width || input.height != output.height || !filter.valid()) {
+        return;
+    }
+    
+    const detail::SeparableRowKernels& kernels = detail::separable_kernels();
+    
+    // The shared pool hands out ROIs one at a time so a few large
+    // rectangles do not leave the other workers idle
+    struct RoiScratch {
+        float* temp = nullptr;
+        size_t capacity = 0;
+        ~RoiScratch() { _mm_free(temp); }
+    };
+    detail::ThreadPool& pool = detail::ThreadPool::shared();
+    std::vector<RoiScratch> scratch(pool.concurrency());
+    
+    pool.parallel_for(rois.size(), [&](size_t i, unsigned int worker) {
+        ARES_TRACE_SCOPE("blur.roi");
+        Rect roi = detail::clip_rect(rois[i], input);
+        if (roi.width == 0 || roi.height == 0) {
+            return;
+        }
+        
+        // Scratch grows to the largest ROI this worker has seen
+        RoiScratch& s = scratch[worker];
+        size_t needed = detail::region_temp_floats(roi, filter);
+        if (needed > s.capacity) {
+            ARES_TRACE_SCOPE("blur.temp_alloc");
+            _mm_free(s.temp);
+            s.temp = static_cast<float*>(_mm_malloc(needed * sizeof(float), 64));
+            s.capacity = needed;
+        }
+        
+        detail::filter_region_tiled(kernels, input, output, roi, filter, border, s.temp,
+                                    gaussian_streams_output(roi.width * roi.height * 4 * sizeof(float)));
+    });
+}
+
+} // namespace ares
@@ -0,0 +1,106 @@
+#include "ares/separable_filter.hpp"
+#include "ares/tile_tuning.hpp"
+#include "ares/trace.hpp"
+#include "border.hpp"
+#include "separable_region.hpp"
+#include <immintrin.h>
+#include <algorithm>
+
+namespace ares {
+
+// The image is processed in tiles of `strip` columns by `band` rows, each
+// through two buffers of strip x (band + 2r) pixels (r: vertical radius):
+// 1. horizontal pass of the tile's columns of its apron rows into `rows`,
+//    rows beyond the image resolved by the border mode as in the tiled blur
+// 2. transpose into `columns`, where image columns are rows
+// 3. the horizontal row kernel runs the vertical taps along those rows,
+//    interior pixels only since the apron is already there, back into `rows`
+// 4. transpose into the tile of output
+// Both buffers together take the L2 share of the tile policy. Every output
+// pixel sums the same values in the same order as the tiled blur.
+void separable_filter_transposed(
+    const Image& input,
+    Image& output,
+    const SeparableFilter& filter,
+    BorderMode border
+) {
+    ARES_TRACE_SCOPE("separable_filter_transposed");
+    if (input.width != output.width || input.height != output.height || !filter.valid()) {
+        return;
+    }
+    if (input.width == 0 || input.height == 0) {
+        return;
+    }
+
+    const detail::SeparableRowKernels& kernels = detail::separable_kernels();
+    const int radius = filter.vertical_radius();
+    const int width = static_cast<int>(input.width);
+    const int height = static_cast<int>(input.height);
+    const size_t row_floats = input.width * 4;
+    const detail::HorizontalRowFn horizontal = kernels.horizontal_for(border, ChannelLayout::RGBA, filter);
+    const detail::HorizontalRowFn vertical = kernels.horizontal_for(border, ChannelLayout::RGBA,
+                                                                    filter.vertical_symmetry(),
+                                                                    static_cast<int>(filter.vertical().size()));
+
+    // Apron rows per tile: at least four times the 2r rows it shares with
+    // the next band, so the horizontal pass redoes at most a third of a
+    // band. Strip width fills the rest of the L2 budget in whole
+    // 16-pixel transpose tiles.
+    const size_t apron = (input.height + 2 * radius) < 128
+        ? input.height + 2 * radius
+        : std::max<size_t>(128, 8 * static_cast<size_t>(radius));
+    const size_t band = std::min(apron - 2 * radius, input.height);
+    const size_t l2_pixels = static_cast<size_t>(cache_info().l2_bytes * tile_policy().l2_fraction) /
+                             (2 * 4 * sizeof(float));
+    const size_t strip = std::min(std::clamp<size_t>((l2_pixels / apron) & ~size_t(15), 16, 512),
+                                  input.width);
+
+    float* rows;
+    float* columns;
+    {
+        ARES_TRACE_SCOPE("blur.temp_alloc");
+        rows = static_cast<float*>(_mm_malloc(2 * strip * apron * 4 * sizeof(float), 64));
+        columns = rows + strip * apron * 4;
+    }
+    const size_t strip_floats = strip * 4;
+
+    for (size_t y = 0; y < input.height; y += band) {
+        const size_t band_rows = std::min(band, input.height - y);
+        const size_t band_apron = band_rows + 2 * radius;
+        const int apron_y = static_cast<int>(y) - radius;
+
+        for (size_t x = 0; x < input.width; x += strip) {
+            const size_t strip_width = std::min(strip, input.width - x);
+            {
+                ARES_TRACE_SCOPE("blur.horizontal");
+                for (size_t r = 0; r < band_apron; ++r) {
+                    float* dst = rows + r * strip_floats;
+                    const int sample_y = detail::border_index(border, apron_y + static_cast<int>(r), height);
+                    if (sample_y < 0) {
+                        // Constant border: the whole row is outside the image
+                        std::fill(dst, dst + strip_width * 4, 0.0f);
+                        continue;
+                    }
+                    horizontal(input.data + sample_y * row_floats, dst, width,
+                               static_cast<int>(x), static_cast<int>(x + strip_width),
+                               filter.horizontal().data(), filter.horizontal_radius());
+                }
+            }
+
+            ARES_TRACE_SCOPE("blur.vertical");
+            const size_t column_floats = band_apron * 4;
+            kernels.transpose_rgba(rows, strip_floats, columns, column_floats, strip_width, band_apron);
+            for (size_t c = 0; c < strip_width; ++c) {
+                vertical(columns + c * column_floats, rows + c * band_rows * 4,
+                         static_cast<int>(band_apron), radius, radius + static_cast<int>(band_rows),
+                         filter.vertical().data(), radius);
+            }
+            kernels.transpose_rgba(rows, band_rows * 4, output.data + y * row_floats + x * 4, row_floats,
+                                   band_rows, strip_width);
+        }
+    }
+
+    _mm_free(rows);
+}
+
+} // namespace ares
@@ -0,0 +1,162 @@
+#include "thread_pool.hpp"
+#include "ares/trace.hpp"
+#include <algorithm>
+
+namespace ares {
+namespace detail {
+
+namespace {
+
+// Pool whose callback the current thread is running, and its worker id
+thread_local const ThreadPool* current_pool = nullptr;
+thread_local unsigned int current_worker = 0;
+
+} // namespace
+
+class ThreadPool::CallbackScope {
+public:
+    CallbackScope(const ThreadPool* pool, unsigned int worker_id)
+        : pool_(current_pool), worker_(current_worker) {
+        current_pool = pool;
+        current_worker = worker_id;
+    }
+    ~CallbackScope() {
+        current_pool = pool_;
+        current_worker = worker_;
+    }
+
+private:
+    const ThreadPool* pool_;
+    unsigned int worker_;
+};
+
+ThreadPool::ThreadPool(unsigned int num_threads) {
+    workers_.reserve(num_threads);
+    for (unsigned int i = 0; i < num_threads; ++i) {
+        // Worker ids 1..n; id 0 is the thread calling parallel_for()
+        workers_.emplace_back(&ThreadPool::worker_loop, this, i + 1);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    work_ready_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void ThreadPool::run_inline(size_t count, const std::function<void(size_t, unsigned int)>& fn,
+                            unsigned int worker_id) {
+    CallbackScope scope(this, worker_id);
+    for (size_t item = 0; item < count; ++item) {
+        fn(item, worker_id);
+    }
+}
+
+void ThreadPool::run_items(unsigned int worker_id) {
+    CallbackScope scope(this, worker_id);
+    for (size_t item = next_.fetch_add(1); item < count_; item = next_.fetch_add(1)) {
+        (*fn_)(item, worker_id);
+    }
+}
+
+void ThreadPool::worker_loop(unsigned int worker_id) {
+    ARES_TRACE_THREAD_NAME("pool worker");
+    unsigned long long seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            work_ready_.wait(lock, [&] { return stop_ || generation_ != seen; });
+            if (stop_) {
+                return;
+            }
+            seen = generation_;
+        }
+
+        run_items(worker_id);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--active_ == 0) {
+                work_done_.notify_one();
+            }
+        }
+    }
+}
+
+void ThreadPool::parallel_for(size_t count, const std::function<void(size_t, unsigned int)>& fn) {
+    if (count == 0) {
+        return;
+    }
+
+    // Nested call from one of our own callbacks: the job in progress
+    // holds submit_mutex_ until this callback returns
+    if (current_pool == this) {
+        run_inline(count, fn, current_worker);
+        return;
+    }
+
+    std::lock_guard<std::mutex> submit(submit_mutex_);
+
+    // Not worth waking anyone for a single item
+    if (count == 1 || workers_.empty()) {
+        run_inline(count, fn, 0);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        fn_ = &fn;
+        count_ = count;
+        next_.store(0);
+        active_ = static_cast<unsigned int>(workers_.size());
+        ++generation_;
+    }
+    work_ready_.notify_all();
+
+    run_items(0);
+
+    // Caller ran out of items; the rest is waiting for the slowest worker
+    ARES_TRACE_SCOPE("pool.wait");
+    std::unique_lock<std::mutex> lock(mutex_);
+    work_done_.wait(lock, [&] { return active_ == 0; });
+    fn_ = nullptr;
+}
+
+unsigned int ThreadPool::calling_worker() const {
+    return current_pool == this ? current_worker : 0;
+}
+
+void parallel_chunks(size_t count, size_t min_chunk,
+                     const std::function<void(size_t, size_t, unsigned int)>& fn) {
+    if (count == 0) {
+        return;
+    }
+    ThreadPool& pool = ThreadPool::shared();
+    const size_t split = static_cast<size_t>(pool.concurrency()) * 4;
+    const size_t chunk = std::max((count + split - 1) / split, std::max<size_t>(min_chunk, 1));
+    const size_t chunks = count / chunk + (count % chunk != 0);  // min_chunk may be SIZE_MAX
+    if (chunks == 1) {
+        fn(0, count, pool.calling_worker());
+        return;
+    }
+    pool.parallel_for(chunks, [&](size_t c, unsigned int worker) {
+        fn(c * chunk, std::min(count, (c + 1) * chunk), worker);
+    });
+}
+
+ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool([] {
+        unsigned int n = std::thread::hardware_concurrency();
+        if (n == 0) n = 4; // fallback
+        return n - 1;      // the caller is the remaining worker
+    }());
+    return pool;
+}
+
+} // namespace detail
+} // namespace ares
@@ -0,0 +1,99 @@
+#pragma once
+
+// Persistent worker pool shared by the batched entry points. Threads are
+// created once, on first use, instead of per call.
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ares {
+namespace detail {
+
+class ThreadPool {
+public:
+    /**
+     * @param num_threads Background workers; the calling thread of
+     *                    parallel_for() always participates as well
+     */
+    explicit ThreadPool(unsigned int num_threads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Number of distinct worker ids passed to parallel_for() callbacks:
+     * background workers plus the calling thread.
+     */
+    unsigned int concurrency() const { return static_cast<unsigned int>(workers_.size()) + 1; }
+
+    /**
+     * Run fn(item, worker_id) for every item in [0, count) and return when
+     * all have finished. Items are handed out dynamically, one at a time.
+     * worker_id is in [0, concurrency()) and is stable per thread, so it
+     * can index per-worker scratch.
+     *
+     * Calls from different threads are serialized: the pool runs one job
+     * at a time, and a call waits for the job in progress to finish. It
+     * is not reentrant. A call made from inside a callback of this pool
+     * (directly, or through parallel_chunks() or any entry point that uses
+     * the shared pool) would wait for its own job, so it is detected and
+     * run inline on the calling thread with that thread's worker_id.
+     */
+    void parallel_for(size_t count, const std::function<void(size_t, unsigned int)>& fn);
+
+    /**
+     * worker_id of the calling thread if it is inside a callback of this
+     * pool, else 0 (the id a caller of parallel_for() runs as)
+     */
+    unsigned int calling_worker() const;
+
+    /**
+     * Process-wide pool sized to std::thread::hardware_concurrency()
+     */
+    static ThreadPool& shared();
+
+private:
+    // Marks the calling thread as inside a callback of this pool for the
+    // lifetime of the guard
+    class CallbackScope;
+
+    void run_inline(size_t count, const std::function<void(size_t, unsigned int)>& fn,
+                    unsigned int worker_id);
+    void worker_loop(unsigned int worker_id);
+    void run_items(unsigned int worker_id);
+
+    std::vector<std::thread> workers_;
+
+    std::mutex submit_mutex_;  // one parallel_for at a time
+    std::mutex mutex_;
+    std::condition_variable work_ready_;
+    std::condition_variable work_done_;
+
+    // Current job (guarded by mutex_ except for the atomics)
+    const std::function<void(size_t, unsigned int)>* fn_ = nullptr;
+    size_t count_ = 0;
+    std::atomic<size_t> next_{0};
+    unsigned int active_ = 0;
+    unsigned long long generation_ = 0;
+    bool stop_ = false;
+};
+
+/**
+ * Run fn(begin, end, worker_id) over consecutive chunks of [0, count) on
+ * the shared pool: about four chunks per worker, so a slow chunk does not
+ * leave the others idle, each of at least min_chunk items. When that
+ * leaves a single chunk it runs on the calling thread without touching
+ * the pool, so min_chunk >= count (SIZE_MAX, say) keeps small work
+ * serial.
+ */
+void parallel_chunks(size_t count, size_t min_chunk,
+                     const std::function<void(size_t, size_t, unsigned int)>& fn);
+
+} // namespace detail
+} // namespace ares
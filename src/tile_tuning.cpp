@@ -0,0 +1,255 @@
+#include "ares/tile_tuning.hpp"
+#include "ares/gaussian_blur.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string>
+
+namespace ares {
+
+namespace {
+
+// Bounds on the model's tile height: below 8 rows the per-tile overhead
+// dominates, above 512 the band no longer needs to fit anywhere useful
+constexpr size_t MIN_TILE_ROWS = 8;
+constexpr size_t MAX_TILE_ROWS = 512;
+
+constexpr int MAX_PREFETCH_ROWS = 64;
+
+bool valid_policy(const TilePolicy& p) {
+    return p.l1_fraction > 0.0f && p.l1_fraction <= 1.0f &&
+           p.l2_fraction > 0.0f && p.l2_fraction <= 1.0f &&
+           p.prefetch_rows >= 0 && p.prefetch_rows <= MAX_PREFETCH_ROWS &&
+           (p.fixed_width == 0) == (p.fixed_height == 0);
+}
+
+TilePolicy initial_policy() {
+    TilePolicy policy;
+    if (const char* path = std::getenv("ARES_TILE_POLICY")) {
+        load_tile_policy(path, policy);
+    }
+    return policy;
+}
+
+// Readers load an immutable policy and hold a reference to it, so a
+// policy replaced by set_tile_policy() lives until its last reader drops
+// it rather than for the rest of the process
+std::atomic<std::shared_ptr<const TilePolicy>>& policy_slot() {
+    static std::atomic<std::shared_ptr<const TilePolicy>> slot{
+        std::make_shared<const TilePolicy>(initial_policy()) };
+    return slot;
+}
+
+StreamingStores initial_streaming_stores() {
+    if (const char* mode = std::getenv("ARES_STREAMING_STORES")) {
+        if (std::strcmp(mode, "always") == 0) return StreamingStores::Always;
+        if (std::strcmp(mode, "never") == 0) return StreamingStores::Never;
+    }
+    return StreamingStores::Auto;
+}
+
+std::atomic<StreamingStores>& streaming_slot() {
+    static std::atomic<StreamingStores> slot{ initial_streaming_stores() };
+    return slot;
+}
+
+} // namespace
+
+TileConfig gaussian_tile_config(int radius, size_t region_width) {
+    const std::shared_ptr<const TilePolicy> policy = policy_slot().load(std::memory_order_acquire);
+    const TilePolicy& p = *policy;
+    if (p.fixed_width > 0 && p.fixed_height > 0) {
+        return TileConfig{ p.fixed_width, p.fixed_height, p.prefetch_rows };
+    }
+
+    const CacheInfo& cache = cache_info();
+    const size_t pixel_bytes = 4 * sizeof(float);
+    const size_t line_pixels = std::max<size_t>(1, cache.line_bytes / pixel_bytes);
+    const size_t window_rows = 2 * static_cast<size_t>(radius) + 1;
+    const size_t region = std::max<size_t>(region_width, 1);
+
+    // Vertical pass: the 2r + 1 temp rows under one tile stay in L1 while
+    // the tile walks down, so each row is loaded from L2 once
+    const size_t l1_budget = static_cast<size_t>(static_cast<double>(cache.l1d_bytes) * p.l1_fraction);
+    size_t width = l1_budget / (window_rows * pixel_bytes);
+    width = std::max(line_pixels, width / line_pixels * line_pixels);
+    width = std::min(width, (region + line_pixels - 1) / line_pixels * line_pixels);
+
+    // A band of height + 2r region rows fits in L2, so the 2r rows the
+    // next band shares with this one are still there when it starts
+    const size_t l2_budget = static_cast<size_t>(static_cast<double>(cache.l2_bytes) * p.l2_fraction);
+    const size_t band_rows = l2_budget / (region * pixel_bytes);
+    size_t height = band_rows > 2 * static_cast<size_t>(radius) ? band_rows - 2 * radius : 0;
+    height = std::clamp(height, MIN_TILE_ROWS, MAX_TILE_ROWS);
+
+    return TileConfig{ width, height, p.prefetch_rows };
+}
+
+TilePolicy tile_policy() {
+    return *policy_slot().load(std::memory_order_acquire);
+}
+
+void set_tile_policy(const TilePolicy& policy) {
+    if (!valid_policy(policy)) {
+        return;
+    }
+    policy_slot().store(std::make_shared<const TilePolicy>(policy), std::memory_order_release);
+}
+
+bool save_tile_policy(const std::string& path, const TilePolicy& policy) {
+    std::ofstream file(path);
+    if (!file) {
+        return false;
+    }
+    const CacheInfo& cache = cache_info();
+    file << "# ARES tile policy (tune_tile_policy); only valid for these cache sizes\n";
+    file << "l1d_bytes " << cache.l1d_bytes << "\n";
+    file << "l2_bytes " << cache.l2_bytes << "\n";
+    file << "l1_fraction " << policy.l1_fraction << "\n";
+    file << "l2_fraction " << policy.l2_fraction << "\n";
+    file << "prefetch_rows " << policy.prefetch_rows << "\n";
+    file << "fixed_width " << policy.fixed_width << "\n";
+    file << "fixed_height " << policy.fixed_height << "\n";
+    return static_cast<bool>(file);
+}
+
+bool load_tile_policy(const std::string& path, TilePolicy& policy) {
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+
+    TilePolicy loaded;
+    size_t l1d = 0, l2 = 0;
+    int seen = 0;  // bit per required key
+    std::string key;
+    while (file >> key) {
+        if (key[0] == '#') {
+            std::getline(file, key);
+            continue;
+        }
+        bool ok = false;
+        if (key == "l1d_bytes") {
+            ok = static_cast<bool>(file >> l1d);
+            seen |= 1;
+        } else if (key == "l2_bytes") {
+            ok = static_cast<bool>(file >> l2);
+            seen |= 2;
+        } else if (key == "l1_fraction") {
+            ok = static_cast<bool>(file >> loaded.l1_fraction);
+            seen |= 4;
+        } else if (key == "l2_fraction") {
+            ok = static_cast<bool>(file >> loaded.l2_fraction);
+            seen |= 8;
+        } else if (key == "prefetch_rows") {
+            ok = static_cast<bool>(file >> loaded.prefetch_rows);
+            seen |= 16;
+        } else if (key == "fixed_width") {
+            ok = static_cast<bool>(file >> loaded.fixed_width);
+        } else if (key == "fixed_height") {
+            ok = static_cast<bool>(file >> loaded.fixed_height);
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+
+    // Tuned for another machine: the fractions mean something else there
+    const CacheInfo& cache = cache_info();
+    if (seen != 31 || l1d != cache.l1d_bytes || l2 != cache.l2_bytes || !valid_policy(loaded)) {
+        return false;
+    }
+    policy = loaded;
+    return true;
+}
+
+TilePolicy tune_tile_policy(const std::string& path, bool force) {
+    TilePolicy policy;
+    if (!force && load_tile_policy(path, policy)) {
+        set_tile_policy(policy);
+        return policy;
+    }
+
+    const size_t width = 1920;
+    const size_t height = 1080;
+    const float sigma = 2.0f;
+    Image input(width, height);
+    Image output(width, height);
+    for (size_t i = 0; i < width * height * 4; ++i) {
+        input.data[i] = static_cast<float>(i % 251) / 250.0f;
+    }
+
+    // Best of three after a warm-up run
+    auto measure = [&](const TilePolicy& candidate) {
+        set_tile_policy(candidate);
+        gaussian_blur_tiled(input, output, sigma);
+        double best = std::numeric_limits<double>::max();
+        for (int run = 0; run < 3; ++run) {
+            const auto start = std::chrono::steady_clock::now();
+            gaussian_blur_tiled(input, output, sigma);
+            const auto end = std::chrono::steady_clock::now();
+            best = std::min(best, std::chrono::duration<double>(end - start).count());
+        }
+        return best;
+    };
+
+    // Coordinate descent from the defaults, one parameter at a time
+    TilePolicy best;
+    double best_time = measure(best);
+    auto try_candidate = [&](TilePolicy candidate) {
+        const double t = measure(candidate);
+        if (t < best_time) {
+            best_time = t;
+            best = candidate;
+        }
+    };
+    for (float f : { 0.25f, 0.75f, 1.0f }) {
+        TilePolicy candidate = best;
+        candidate.l1_fraction = f;
+        try_candidate(candidate);
+    }
+    for (float f : { 0.25f, 0.75f, 1.0f }) {
+        TilePolicy candidate = best;
+        candidate.l2_fraction = f;
+        try_candidate(candidate);
+    }
+    for (int rows : { 0, 1, 4, 8 }) {
+        TilePolicy candidate = best;
+        candidate.prefetch_rows = rows;
+        try_candidate(candidate);
+    }
+
+    set_tile_policy(best);
+    save_tile_policy(path, best);
+    return best;
+}
+
+size_t streaming_store_threshold() {
+    // Without an L3 the L2 is the last level
+    const CacheInfo& cache = cache_info();
+    return cache.l3_bytes > 0 ? cache.l3_bytes : cache.l2_bytes;
+}
+
+StreamingStores streaming_stores() {
+    return streaming_slot().load(std::memory_order_relaxed);
+}
+
+void set_streaming_stores(StreamingStores mode) {
+    streaming_slot().store(mode, std::memory_order_relaxed);
+}
+
+bool gaussian_streams_output(size_t output_bytes) {
+    switch (streaming_stores()) {
+        case StreamingStores::Always: return true;
+        case StreamingStores::Never: return false;
+        default: return output_bytes > streaming_store_threshold();
+    }
+}
+
+} // namespace ares
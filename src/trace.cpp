@@ -0,0 +1,242 @@
+#include "ares/trace.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <utility>
+
+namespace ares {
+
+namespace detail {
+std::atomic<bool> trace_recording{ false };
+} // namespace detail
+
+namespace {
+
+// Single-producer ring: only the owning thread writes events and bumps
+// `written`; exporters read behind it
+struct TraceBuffer {
+    std::vector<TraceEvent> events;
+    std::atomic<uint64_t> written{ 0 };
+};
+
+struct TraceRegistry {
+    std::mutex mutex;
+    std::deque<TraceBuffer> buffers;      // never shrinks, so pointers stay valid
+    std::vector<TraceBuffer*> free_list;  // buffers of exited threads
+    size_t capacity = 65536;
+    uint64_t origin_ns = 0;
+    uint32_t next_thread = 1;
+    std::vector<std::pair<uint32_t, const char*>> thread_names;
+};
+
+// Leaked on purpose: threads may exit (and return their buffer) after
+// static destructors have run
+TraceRegistry& registry() {
+    static TraceRegistry* r = new TraceRegistry;
+    return *r;
+}
+
+// Buffers outlive their threads and are handed to the next new thread,
+// so per-call threads (gaussian_blur_multithreaded) do not leak one each
+struct ThreadTrace {
+    TraceBuffer* buffer = nullptr;
+    uint32_t thread = 0;
+    const char* name = nullptr;
+
+    ~ThreadTrace() {
+        if (buffer) {
+            TraceRegistry& r = registry();
+            std::lock_guard<std::mutex> lock(r.mutex);
+            r.free_list.push_back(buffer);
+        }
+    }
+};
+
+thread_local ThreadTrace current_thread;
+
+void attach_thread(ThreadTrace& t) {
+    TraceRegistry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    if (!r.free_list.empty()) {
+        t.buffer = r.free_list.back();
+        r.free_list.pop_back();
+    } else {
+        t.buffer = &r.buffers.emplace_back();
+        t.buffer->events.resize(r.capacity);
+    }
+    t.thread = r.next_thread++;
+    if (t.name) {
+        r.thread_names.emplace_back(t.thread, t.name);
+    }
+}
+
+size_t round_up_pow2(size_t n) {
+    size_t p = 1;
+    while (p < n) {
+        p <<= 1;
+    }
+    return p;
+}
+
+void append_json_string(std::string& out, const char* s) {
+    out += '"';
+    for (; *s; ++s) {
+        if (*s == '"' || *s == '\\') {
+            out += '\\';
+        }
+        if (static_cast<unsigned char>(*s) >= 0x20) {
+            out += *s;
+        }
+    }
+    out += '"';
+}
+
+} // namespace
+
+namespace detail {
+
+void trace_record(const char* name, uint64_t start_ns, uint64_t end_ns) {
+    ThreadTrace& t = current_thread;
+    if (!t.buffer) {
+        attach_thread(t);
+    }
+    TraceBuffer& b = *t.buffer;
+    const uint64_t n = b.written.load(std::memory_order_relaxed);
+    b.events[n & (b.events.size() - 1)] = TraceEvent{ name, start_ns, end_ns - start_ns, t.thread };
+    b.written.store(n + 1, std::memory_order_release);
+}
+
+} // namespace detail
+
+bool tracing_compiled_in() {
+#ifdef ARES_ENABLE_TRACING
+    return true;
+#else
+    return false;
+#endif
+}
+
+void trace_start(size_t events_per_thread) {
+    TraceRegistry& r = registry();
+    {
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.capacity = round_up_pow2(std::max<size_t>(events_per_thread, 16));
+        for (TraceBuffer& b : r.buffers) {
+            b.events.assign(r.capacity, TraceEvent{});
+            b.written.store(0, std::memory_order_relaxed);
+        }
+        r.origin_ns = detail::trace_clock_ns();
+    }
+    detail::trace_recording.store(true, std::memory_order_release);
+}
+
+void trace_stop() {
+    detail::trace_recording.store(false, std::memory_order_release);
+}
+
+void trace_resume() {
+    detail::trace_recording.store(true, std::memory_order_release);
+}
+
+std::vector<TraceEvent> trace_events() {
+    TraceRegistry& r = registry();
+    std::vector<TraceEvent> events;
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for (TraceBuffer& b : r.buffers) {
+        const uint64_t size = b.events.size();
+        const uint64_t end = b.written.load(std::memory_order_acquire);
+        const uint64_t begin = end > size ? end - size : 0;
+        const size_t first = events.size();
+        for (uint64_t i = begin; i < end; ++i) {
+            events.push_back(b.events[i & (size - 1)]);
+        }
+        // Slots the owner overwrote while we copied are not trustworthy
+        const uint64_t now = b.written.load(std::memory_order_acquire);
+        const uint64_t overwritten = now > size ? now - size : 0;
+        if (overwritten > begin) {
+            const uint64_t lost = std::min(overwritten, end) - begin;
+            events.erase(events.begin() + first, events.begin() + first + lost);
+        }
+    }
+    std::sort(events.begin(), events.end(), [](const TraceEvent& a, const TraceEvent& b) {
+        return a.start_ns < b.start_ns;
+    });
+    return events;
+}
+
+uint64_t trace_dropped_events() {
+    TraceRegistry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    uint64_t dropped = 0;
+    for (TraceBuffer& b : r.buffers) {
+        const uint64_t written = b.written.load(std::memory_order_acquire);
+        if (written > b.events.size()) {
+            dropped += written - b.events.size();
+        }
+    }
+    return dropped;
+}
+
+std::string chrome_trace_json() {
+    const std::vector<TraceEvent> events = trace_events();
+    const uint64_t dropped = trace_dropped_events();
+
+    TraceRegistry& r = registry();
+    uint64_t origin;
+    std::vector<std::pair<uint32_t, const char*>> names;
+    {
+        std::lock_guard<std::mutex> lock(r.mutex);
+        origin = r.origin_ns;
+        names = r.thread_names;
+    }
+
+    std::string out = "{\"traceEvents\":[\n";
+    bool first = true;
+    char buf[128];
+    for (const auto& [thread, name] : names) {
+        out += first ? "" : ",\n";
+        first = false;
+        std::snprintf(buf, sizeof(buf), "{\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"name\":\"thread_name\",\"args\":{\"name\":",
+                      thread);
+        out += buf;
+        append_json_string(out, name);
+        out += "}}";
+    }
+    for (const TraceEvent& e : events) {
+        out += first ? "" : ",\n";
+        first = false;
+        const double ts = e.start_ns >= origin ? static_cast<double>(e.start_ns - origin) / 1000.0 : 0.0;
+        out += "{\"ph\":\"X\",\"pid\":1,\"cat\":\"ares\",\"name\":";
+        append_json_string(out, e.name);
+        std::snprintf(buf, sizeof(buf), ",\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                      e.thread, ts, static_cast<double>(e.duration_ns) / 1000.0);
+        out += buf;
+    }
+    std::snprintf(buf, sizeof(buf), "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped_events\":%llu}}\n",
+                  static_cast<unsigned long long>(dropped));
+    out += buf;
+    return out;
+}
+
+bool write_chrome_trace(const std::string& path) {
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    file << chrome_trace_json();
+    return static_cast<bool>(file);
+}
+
+void trace_thread_name(const char* name) {
+    ThreadTrace& t = current_thread;
+    t.name = name;
+    if (t.thread != 0) {
+        TraceRegistry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.thread_names.emplace_back(t.thread, name);
+    }
+}
+
+} // namespace ares
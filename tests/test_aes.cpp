@@ -103,6 +103,31 @@ TEST(aes_baseline_vs_simd) {
     return true;
 }
 
+TEST(aes_fips197_known_answer) {
+    // FIPS-197 Appendix C.1 (AES-128)
+    uint8_t key[16];
+    uint8_t plaintext[16];
+    const uint8_t expected[16] = {
+        0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+        0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a
+    };
+    for (int i = 0; i < 16; ++i) {
+        key[i] = static_cast<uint8_t>(i);
+        plaintext[i] = static_cast<uint8_t>((i << 4) | i);
+    }
+    
+    uint8_t ciphertext[16] = {0};
+    aes_encrypt_baseline(plaintext, ciphertext, key, 1);
+    ASSERT_TRUE(std::memcmp(ciphertext, expected, 16) == 0);
+    
+    std::memset(ciphertext, 0, 16);
+    aes_encrypt_simd(plaintext, ciphertext, key, 1);
+    ASSERT_TRUE(std::memcmp(ciphertext, expected, 16) == 0);
+    
+    printf("✓ AES matches FIPS-197 known-answer vector\n");
+    return true;
+}
+
 TEST(aes_multiple_blocks) {
     const size_t num_blocks = 4;
     uint8_t plaintext[64];
@@ -137,6 +162,7 @@ int main() {
     all_passed &= test_aes_baseline_encryption();
     all_passed &= test_aes_simd_encryption();
     all_passed &= test_aes_baseline_vs_simd();
+    all_passed &= test_aes_fips197_known_answer();
     all_passed &= test_aes_multiple_blocks();
     
     printf("\n");
@@ -0,0 +1,284 @@
+#include "ares/async.hpp"
+#include "ares/aes.hpp"
+#include "ares/gaussian_blur.hpp"
+#include "test_util.hpp"
+#include <algorithm>
+#include <atomic>
+#include <coroutine>
+#include <cstdio>
+#include <exception>
+#include <memory>
+#include <vector>
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        printf("FAILED: %s (line %d)\n", #cond, __LINE__); \
+        return false; \
+    }
+
+#define TEST(name) \
+    bool test_##name(); \
+    bool test_##name()
+
+using namespace ares;
+using namespace ares_test;
+
+static std::vector<uint8_t> make_bytes(size_t count) {
+    std::vector<uint8_t> bytes(count);
+    for (size_t i = 0; i < count; ++i) {
+        bytes[i] = static_cast<uint8_t>(i * 131 + 7);
+    }
+    return bytes;
+}
+
+static const uint8_t KEY[16] = { 0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+                                 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c };
+
+// Eager coroutine that nobody awaits, enough to drive co_await in a test
+struct Detached {
+    struct promise_type {
+        Detached get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+TEST(matches_blocking_calls) {
+    AsyncExecutor executor;
+
+    // One part, and a 1500x900 image cut into bands
+    Image small = make_pattern(300, 200);
+    Image large = make_pattern(1500, 900);
+    Image small_out(300, 200);
+    Image large_out(1500, 900);
+    Image expected_small(300, 200);
+    Image expected_large(1500, 900);
+
+    // 40000 blocks: three parts
+    const size_t blocks = 40000;
+    const std::vector<uint8_t> plaintext = make_bytes(blocks * 16);
+    std::vector<uint8_t> ciphertext(blocks * 16);
+    std::vector<uint8_t> expected_cipher(blocks * 16);
+
+    AsyncJob jobs[] = {
+        executor.submit_gaussian_blur(small, small_out, 1.5f, BorderMode::Mirror),
+        executor.submit_gaussian_blur(large, large_out, 3.0f, BorderMode::Wrap),
+        executor.submit_aes_encrypt(plaintext.data(), ciphertext.data(), KEY, blocks),
+    };
+    gaussian_blur_tiled(small, expected_small, 1.5f, BorderMode::Mirror);
+    gaussian_blur_tiled(large, expected_large, 3.0f, BorderMode::Wrap);
+    aes_encrypt_simd(plaintext.data(), expected_cipher.data(), KEY, blocks);
+
+    for (AsyncJob& job : jobs) {
+        ASSERT_TRUE(job.wait() == JobStatus::Completed);
+    }
+    ASSERT_TRUE(same_pixels(small_out, expected_small));
+    ASSERT_TRUE(same_pixels(large_out, expected_large));
+    ASSERT_TRUE(ciphertext == expected_cipher);
+    ASSERT_TRUE(executor.jobs_in_flight() == 0);
+
+    printf("✓ Async blur (whole and banded) and AES are bitwise identical to the blocking calls\n");
+    return true;
+}
+
+TEST(completion_queue) {
+    AsyncExecutor executor({ true });
+    const size_t count = 1000;
+    Image input = make_pattern(32, 32);
+    std::vector<Image> outputs;
+    outputs.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        outputs.emplace_back(32, 32);
+        executor.submit_gaussian_blur(input, outputs.back(), 1.0f, BorderMode::Clamp, i);
+    }
+    Image wrong_size(16, 16);
+    executor.submit_gaussian_blur(input, wrong_size, 1.0f, BorderMode::Clamp, count);
+
+    // Handles were dropped: the queue is the only way to learn the results
+    std::vector<int> seen(count + 1, 0);
+    Completion completions[64];
+    size_t received = 0;
+    while (received < count + 1) {
+        const size_t n = executor.wait_completions(completions, 64, std::chrono::milliseconds(5000));
+        ASSERT_TRUE(n > 0);
+        for (size_t i = 0; i < n; ++i) {
+            const uint64_t tag = completions[i].tag;
+            ASSERT_TRUE(tag <= count);
+            ASSERT_TRUE(completions[i].status == (tag == count ? JobStatus::Rejected : JobStatus::Completed));
+            ++seen[tag];
+        }
+        received += n;
+    }
+    ASSERT_TRUE(std::all_of(seen.begin(), seen.end(), [](int n) { return n == 1; }));
+    ASSERT_TRUE(executor.poll_completions(completions, 64) == 0);
+    ASSERT_TRUE(executor.jobs_in_flight() == 0);
+
+    Image expected(32, 32);
+    gaussian_blur_tiled(input, expected, 1.0f);
+    for (const Image& output : outputs) {
+        ASSERT_TRUE(same_pixels(output, expected));
+    }
+
+    printf("✓ %zu jobs in flight, each tag posted to the completion queue exactly once\n", count);
+    return true;
+}
+
+TEST(cancellation) {
+    // The pool is busy with a large blur while the small jobs are cancelled
+    AsyncExecutor executor;
+    Image large = make_pattern(2048, 2048);
+    Image large_out(2048, 2048);
+    AsyncJob busy = executor.submit_gaussian_blur(large, large_out, 6.0f);
+
+    Image input = make_pattern(64, 64);
+    std::vector<Image> outputs;
+    std::vector<AsyncJob> jobs;
+    outputs.reserve(50);
+    for (int i = 0; i < 50; ++i) {
+        outputs.emplace_back(64, 64);
+        std::fill(outputs.back().data, outputs.back().data + 64 * 64 * 4, 7.0f);
+        jobs.push_back(executor.submit_gaussian_blur(input, outputs.back(), 2.0f));
+    }
+    for (AsyncJob& job : jobs) {
+        ASSERT_TRUE(job.cancel());
+    }
+
+    ASSERT_TRUE(busy.wait() == JobStatus::Completed);
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        ASSERT_TRUE(jobs[i].wait() == JobStatus::Cancelled);
+        ASSERT_TRUE(std::all_of(outputs[i].data, outputs[i].data + 64 * 64 * 4,
+                                [](float v) { return v == 7.0f; }));
+    }
+    ASSERT_TRUE(!busy.cancel() && !jobs[0].cancel());
+
+    printf("✓ Cancelled jobs are skipped without touching their outputs\n");
+    return true;
+}
+
+static Detached blur_then_encrypt(
+    AsyncExecutor& executor,
+    const Image& input,
+    Image& output,
+    const uint8_t* plaintext,
+    uint8_t* ciphertext,
+    size_t blocks,
+    JobStatus* results,
+    std::atomic<int>& finished
+) {
+    results[0] = co_await executor.submit_gaussian_blur(input, output, 2.0f);
+    results[1] = co_await executor.submit_aes_encrypt(plaintext, ciphertext, KEY, blocks);
+    finished.store(1);
+    finished.notify_all();
+}
+
+static Detached await_finished(AsyncJob job, JobStatus* result, std::atomic<int>& finished) {
+    *result = co_await job;
+    finished.store(1);
+}
+
+TEST(coroutine_awaitables) {
+    AsyncExecutor executor;
+    Image input = make_pattern(640, 480);
+    Image output(640, 480);
+    Image expected(640, 480);
+    const size_t blocks = 20000;
+    const std::vector<uint8_t> plaintext = make_bytes(blocks * 16);
+    std::vector<uint8_t> ciphertext(blocks * 16);
+    std::vector<uint8_t> expected_cipher(blocks * 16);
+
+    JobStatus results[2] = { JobStatus::Pending, JobStatus::Pending };
+    std::atomic<int> finished{ 0 };
+    blur_then_encrypt(executor, input, output, plaintext.data(), ciphertext.data(), blocks,
+                      results, finished);
+    finished.wait(0);
+
+    ASSERT_TRUE(results[0] == JobStatus::Completed && results[1] == JobStatus::Completed);
+    gaussian_blur_tiled(input, expected, 2.0f);
+    aes_encrypt_simd(plaintext.data(), expected_cipher.data(), KEY, blocks);
+    ASSERT_TRUE(same_pixels(output, expected));
+    ASSERT_TRUE(ciphertext == expected_cipher);
+
+    // Awaiting a finished job does not suspend
+    AsyncJob done = executor.submit_gaussian_blur(input, output, 1.0f);
+    done.wait();
+    JobStatus result = JobStatus::Pending;
+    std::atomic<int> resumed{ 0 };
+    await_finished(done, &result, resumed);
+    ASSERT_TRUE(resumed.load() == 1 && result == JobStatus::Completed);
+
+    printf("✓ co_await resumes the coroutine with each job's status\n");
+    return true;
+}
+
+TEST(destructor_cancels_queued_jobs) {
+    Image large = make_pattern(2048, 2048);
+    Image large_out(2048, 2048);
+    Image input = make_pattern(64, 64);
+    std::vector<Image> outputs;
+    outputs.reserve(20);
+    std::vector<AsyncJob> jobs;
+    {
+        AsyncExecutor executor;
+        jobs.push_back(executor.submit_gaussian_blur(large, large_out, 6.0f));
+        for (int i = 0; i < 20; ++i) {
+            outputs.emplace_back(64, 64);
+            jobs.push_back(executor.submit_gaussian_blur(input, outputs.back(), 2.0f));
+        }
+    }
+
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        ASSERT_TRUE(jobs[i].done());
+        if (i > 0) {
+            ASSERT_TRUE(jobs[i].status() == JobStatus::Cancelled);
+        }
+    }
+
+    printf("✓ Destroying the executor finishes every job, cancelling the queued ones\n");
+    return true;
+}
+
+TEST(invalid_arguments_rejected) {
+    Image input = make_pattern(32, 32);
+    Image wrong(31, 32);
+    std::fill(wrong.data, wrong.data + 31 * 32 * 4, 7.0f);
+    uint8_t block[16] = {};
+
+    AsyncJob blur = gaussian_blur_async(input, wrong);
+    ASSERT_TRUE(blur.done() && blur.status() == JobStatus::Rejected);
+    ASSERT_TRUE(std::all_of(wrong.data, wrong.data + 31 * 32 * 4, [](float v) { return v == 7.0f; }));
+    ASSERT_TRUE(aes_encrypt_async(nullptr, block, KEY, 1).wait() == JobStatus::Rejected);
+    ASSERT_TRUE(aes_encrypt_async(block, block, KEY, 0).wait() == JobStatus::Rejected);
+
+    // The shared executor runs valid jobs
+    Image output(32, 32);
+    Image expected(32, 32);
+    ASSERT_TRUE(gaussian_blur_async(input, output, 1.0f).wait() == JobStatus::Completed);
+    gaussian_blur_tiled(input, expected, 1.0f);
+    ASSERT_TRUE(same_pixels(output, expected));
+
+    printf("✓ Invalid jobs are rejected at submission without writing anything\n");
+    return true;
+}
+
+int main() {
+    printf("=== ARES Async Tests ===\n\n");
+
+    bool all_passed = true;
+    all_passed &= test_matches_blocking_calls();
+    all_passed &= test_completion_queue();
+    all_passed &= test_cancellation();
+    all_passed &= test_coroutine_awaitables();
+    all_passed &= test_destructor_cancels_queued_jobs();
+    all_passed &= test_invalid_arguments_rejected();
+
+    printf("\n");
+    if (all_passed) {
+        printf("✓ All async tests passed!\n");
+        return 0;
+    } else {
+        printf("✗ Some tests failed\n");
+        return 1;
+    }
+}
@@ -0,0 +1,168 @@
+#include "ares/bilateral_grid.hpp"
+#include "ares/gaussian_blur.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        printf("FAILED: %s (line %d)\n", #cond, __LINE__); \
+        return false; \
+    }
+
+#define TEST(name) \
+    bool test_##name(); \
+    bool test_##name()
+
+using namespace ares;
+
+// Skin-like test card: smooth shading on both sides of a hard diagonal
+// edge, plus deterministic noise the filter should remove
+static Image make_card(size_t width, size_t height) {
+    Image img(width, height);
+    uint32_t state = 12345;
+    for (size_t y = 0; y < height; ++y) {
+        for (size_t x = 0; x < width; ++x) {
+            state = state * 1664525u + 1013904223u;
+            const float noise = (static_cast<float>(state >> 8) / 16777216.0f - 0.5f) * 0.04f;
+            const bool dark = x + y < (width + height) / 2;
+            const float base = dark ? 0.2f + 0.1f * x / width : 0.7f + 0.1f * y / height;
+            float* p = img.data + (y * width + x) * 4;
+            p[0] = base + noise;
+            p[1] = base * 0.8f + noise;
+            p[2] = base * 0.6f + noise;
+            p[3] = static_cast<float>(x % 7) / 6.0f;
+        }
+    }
+    return img;
+}
+
+static double psnr(const Image& a, const Image& b) {
+    double mse = 0.0;
+    size_t n = 0;
+    for (size_t i = 0; i < a.width * a.height * 4; ++i) {
+        if (i % 4 != 3) {
+            const double d = a.data[i] - b.data[i];
+            mse += d * d;
+            ++n;
+        }
+    }
+    mse /= static_cast<double>(n);
+    return mse > 0.0 ? 10.0 * std::log10(1.0 / mse) : 99.0;
+}
+
+TEST(close_to_brute_force) {
+    Image img = make_card(160, 112);
+    Image reference(160, 112);
+    Image output(160, 112);
+
+    double worst = 99.0;
+    const float settings[][2] = { { 4.0f, 0.1f }, { 6.0f, 0.2f }, { 3.0f, 0.05f } };
+    for (const auto& s : settings) {
+        bilateral_filter_baseline(img, reference, s[0], s[1]);
+        BilateralGrid grid(s[0], s[1]);
+        ASSERT_TRUE(grid.apply(img, output));
+        // The unfiltered input is about 38 dB from the reference
+        const double db = psnr(output, reference);
+        if (db < 40.0 || db < psnr(img, reference) + 8.0) {
+            printf("FAILED: sigma_spatial %.1f, sigma_range %.2f: %.1f dB\n", s[0], s[1], db);
+            return false;
+        }
+        worst = std::min(worst, db);
+
+        // Alpha is copied
+        for (size_t i = 3; i < 160 * 112 * 4; i += 4) {
+            ASSERT_TRUE(output.data[i] == img.data[i]);
+        }
+    }
+
+    printf("✓ Bilateral grid is within %.1f dB PSNR of the brute-force filter\n", worst);
+    return true;
+}
+
+TEST(preserves_edges) {
+    // Across the edge the grid stays close to the input while a Gaussian
+    // of the same spatial sigma smears it; inside a side it smooths
+    Image img = make_card(160, 112);
+    Image output(160, 112);
+    Image blurred(160, 112);
+    bilateral_filter_grid(img, output, 6.0f, 0.1f);
+    gaussian_blur_tiled(img, blurred, 6.0f);
+
+    // Pixel just on the dark side of the edge, row 56
+    const size_t edge = (160 + 112) / 2 - 56 - 2;
+    const float* in = img.data + (56 * 160 + edge) * 4;
+    const float* bf = output.data + (56 * 160 + edge) * 4;
+    const float* gb = blurred.data + (56 * 160 + edge) * 4;
+    ASSERT_TRUE(std::fabs(bf[0] - in[0]) < 0.05f);
+    ASSERT_TRUE(gb[0] - in[0] > 0.15f);
+
+    // Noise inside the dark side is reduced
+    double noise_in = 0.0;
+    double noise_out = 0.0;
+    for (size_t x = 20; x < 40; ++x) {
+        noise_in += std::fabs(img.data[(20 * 160 + x + 1) * 4] - img.data[(20 * 160 + x) * 4]);
+        noise_out += std::fabs(output.data[(20 * 160 + x + 1) * 4] - output.data[(20 * 160 + x) * 4]);
+    }
+    ASSERT_TRUE(noise_out < noise_in * 0.3);
+
+    printf("✓ Edges survive (Gaussian moves them by %.2f, the grid by %.3f) while noise drops %.0fx\n",
+           gb[0] - in[0], std::fabs(bf[0] - in[0]), noise_in / noise_out);
+    return true;
+}
+
+TEST(flat_and_reuse) {
+    // A constant image comes back unchanged, at any size
+    BilateralGrid grid(5.0f, 0.15f);
+    for (size_t size : { 1, 9, 333 }) {
+        Image img(size, size / 2 + 1);
+        for (size_t i = 0; i < img.width * img.height * 4; ++i) {
+            img.data[i] = i % 4 == 3 ? 1.0f : 0.4f;
+        }
+        Image output(img.width, img.height);
+        ASSERT_TRUE(grid.apply(img, output));
+        for (size_t i = 0; i < img.width * img.height * 4; ++i) {
+            ASSERT_TRUE(std::fabs(output.data[i] - img.data[i]) < 1e-5f);
+        }
+    }
+    ASSERT_TRUE(grid.grid_width() == static_cast<size_t>(332 / 5.0f) + 2);
+    ASSERT_TRUE(grid.grid_depth() == static_cast<size_t>(1 / 0.15f) + 2);
+
+    // The grid only grows
+    const size_t bytes = grid.grid_bytes();
+    Image small(20, 20);
+    Image small_out(20, 20);
+    ASSERT_TRUE(grid.apply(small, small_out));
+    ASSERT_TRUE(grid.grid_bytes() == bytes);
+
+    // Mismatched sizes and out-of-range sigmas write nothing
+    Image wrong(19, 20);
+    wrong.data[0] = 0.5f;
+    ASSERT_TRUE(!grid.apply(small, wrong));
+    ASSERT_TRUE(!BilateralGrid(0.5f, 0.1f).apply(small, small_out));
+    ASSERT_TRUE(!BilateralGrid(4.0f, 0.0f).apply(small, small_out));
+    ASSERT_TRUE(wrong.data[0] == 0.5f);
+
+    printf("✓ Flat images pass through; the grid is reused and bad arguments are rejected\n");
+    return true;
+}
+
+int main() {
+    printf("=== ARES Bilateral Grid Tests ===\n\n");
+
+    bool all_passed = true;
+    all_passed &= test_close_to_brute_force();
+    all_passed &= test_preserves_edges();
+    all_passed &= test_flat_and_reuse();
+
+    printf("\n");
+    if (all_passed) {
+        printf("✓ All bilateral grid tests passed!\n");
+        return 0;
+    } else {
+        printf("✗ Some tests failed\n");
+        return 1;
+    }
+}
@@ -0,0 +1,143 @@
+#include "ares/cpu_dispatch.hpp"
+#include "ares/gaussian_blur.hpp"
+#include "ares/aes.hpp"
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        printf("FAILED: %s (line %d)\n", #cond, __LINE__); \
+        return false; \
+    }
+
+#define TEST(name) \
+    bool test_##name(); \
+    bool test_##name()
+
+using namespace ares;
+
+static const IsaLevel all_levels[] = {
+    IsaLevel::Scalar, IsaLevel::SSE42, IsaLevel::AVX2, IsaLevel::AVX512
+};
+
+TEST(level_query) {
+    IsaLevel detected = detected_isa_level();
+    IsaLevel active = active_isa_level();
+    
+    // The active level can be forced lower, never higher
+    ASSERT_TRUE(static_cast<int>(active) <= static_cast<int>(detected));
+    ASSERT_TRUE(std::strcmp(active_gaussian_kernel(), "") != 0);
+    ASSERT_TRUE(std::strcmp(active_aes_kernel(), "") != 0);
+    ASSERT_TRUE(std::strcmp(active_pixel_convert_kernel(), "") != 0);
+    
+    printf("  Detected: %s, active: %s (gaussian=%s, aes=%s)\n",
+           isa_level_name(detected), isa_level_name(active),
+           active_gaussian_kernel(), active_aes_kernel());
+    printf("✓ ISA level query works\n");
+    return true;
+}
+
+TEST(set_level_clamps) {
+    IsaLevel original = active_isa_level();
+    
+    IsaLevel applied = set_isa_level(IsaLevel::AVX512);
+    ASSERT_TRUE(applied == detected_isa_level());
+    
+    applied = set_isa_level(IsaLevel::Scalar);
+    ASSERT_TRUE(applied == IsaLevel::Scalar);
+    ASSERT_TRUE(std::strcmp(active_gaussian_kernel(), "scalar") == 0);
+    ASSERT_TRUE(std::strcmp(active_aes_kernel(), "baseline") == 0);
+    ASSERT_TRUE(std::strcmp(active_pixel_convert_kernel(), "scalar") == 0);
+    
+    set_isa_level(original);
+    printf("✓ set_isa_level clamps to the detected level\n");
+    return true;
+}
+
+TEST(gaussian_all_levels_match_baseline) {
+    // Odd width exercises masked tails and border columns at every level
+    const size_t width = 45;
+    const size_t height = 23;
+    Image input(width, height);
+    Image expected(width, height);
+    Image output(width, height);
+    
+    for (size_t i = 0; i < width * height * 4; ++i) {
+        input.data[i] = static_cast<float>((i * 7919) % 101) / 100.0f;
+    }
+    gaussian_blur_baseline(input, expected, 1.5f);
+    
+    IsaLevel original = active_isa_level();
+    for (IsaLevel level : all_levels) {
+        IsaLevel applied = set_isa_level(level);
+        
+        gaussian_blur_simd(input, output, 1.5f);
+        float max_diff = 0.0f;
+        for (size_t i = 0; i < width * height * 4; ++i) {
+            max_diff = std::max(max_diff, std::abs(output.data[i] - expected.data[i]));
+        }
+        ASSERT_TRUE(max_diff < 1e-4f);
+        
+        gaussian_blur_tiled(input, output, 1.5f);
+        for (size_t i = 0; i < width * height * 4; ++i) {
+            max_diff = std::max(max_diff, std::abs(output.data[i] - expected.data[i]));
+        }
+        ASSERT_TRUE(max_diff < 1e-4f);
+        
+        printf("  %-7s (%s): max diff %.2e\n", isa_level_name(applied),
+               active_gaussian_kernel(), max_diff);
+    }
+    set_isa_level(original);
+    
+    printf("✓ Gaussian kernels match baseline at every ISA level\n");
+    return true;
+}
+
+TEST(aes_all_levels_match_baseline) {
+    // 37 blocks: full VAES groups plus a remainder at every width
+    const size_t num_blocks = 37;
+    std::vector<uint8_t> plaintext(num_blocks * 16);
+    std::vector<uint8_t> expected(num_blocks * 16);
+    std::vector<uint8_t> ciphertext(num_blocks * 16);
+    uint8_t key[16] = "DispatchKey1234";
+    
+    for (size_t i = 0; i < plaintext.size(); ++i) {
+        plaintext[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+    aes_encrypt_baseline(plaintext.data(), expected.data(), key, num_blocks);
+    
+    IsaLevel original = active_isa_level();
+    for (IsaLevel level : all_levels) {
+        set_isa_level(level);
+        std::fill(ciphertext.begin(), ciphertext.end(), 0);
+        aes_encrypt_simd(plaintext.data(), ciphertext.data(), key, num_blocks);
+        ASSERT_TRUE(ciphertext == expected);
+        printf("  %-7s -> %s\n", isa_level_name(active_isa_level()), active_aes_kernel());
+    }
+    set_isa_level(original);
+    
+    printf("✓ AES kernels match baseline at every ISA level\n");
+    return true;
+}
+
+int main() {
+    printf("=== ARES ISA Dispatch Tests ===\n\n");
+    
+    bool all_passed = true;
+    all_passed &= test_level_query();
+    all_passed &= test_set_level_clamps();
+    all_passed &= test_gaussian_all_levels_match_baseline();
+    all_passed &= test_aes_all_levels_match_baseline();
+    
+    printf("\n");
+    if (all_passed) {
+        printf("✓ All dispatch tests passed!\n");
+        return 0;
+    } else {
+        printf("✗ Some tests failed\n");
+        return 1;
+    }
+}
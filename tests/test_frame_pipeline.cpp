@@ -0,0 +1,265 @@
+#include "ares/frame_pipeline.hpp"
+#include "ares/frame_queue.hpp"
+#include "ares/gaussian_blur.hpp"
+#include "test_util.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        printf("FAILED: %s (line %d)\n", #cond, __LINE__); \
+        return false; \
+    }
+
+#define TEST(name) \
+    bool test_##name(); \
+    bool test_##name()
+
+using namespace ares;
+using namespace ares_test;
+
+static const size_t WIDTH = 67;
+static const size_t HEIGHT = 41;
+
+// Different content for every frame
+static void fill_frame(Image& image, size_t frame) {
+    for (size_t i = 0; i < image.width * image.height * 4; ++i) {
+        image.data[i] = static_cast<float>((i * 37 + frame * 101) % 251) / 250.0f;
+    }
+}
+
+TEST(queues_across_threads) {
+    const size_t count = 200000;
+
+    // SPSC: everything arrives, in order
+    {
+        SpscQueue<size_t> queue(8);
+        ASSERT_TRUE(queue.capacity() == 8);
+        std::thread producer([&]() {
+            for (size_t i = 0; i < count; ++i) {
+                size_t value = i;
+                while (!queue.try_push(value)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        bool in_order = true;
+        for (size_t expected = 0; expected < count; ++expected) {
+            size_t value;
+            while (!queue.try_pop(value)) {
+                std::this_thread::yield();
+            }
+            in_order = in_order && value == expected;
+        }
+        producer.join();
+        size_t value;
+        ASSERT_TRUE(in_order);
+        ASSERT_TRUE(!queue.try_pop(value));
+    }
+
+    // MPMC: two producers, two consumers; every value popped exactly once
+    {
+        MpmcQueue<size_t> queue(5);
+        ASSERT_TRUE(queue.capacity() == 8);
+        std::vector<std::atomic<int>> seen(2 * count);
+        std::atomic<size_t> popped{0};
+        std::vector<std::thread> threads;
+        for (size_t p = 0; p < 2; ++p) {
+            threads.emplace_back([&, p]() {
+                for (size_t i = p * count; i < (p + 1) * count; ++i) {
+                    size_t value = i;
+                    while (!queue.try_push(value)) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+            threads.emplace_back([&]() {
+                while (popped.load() < 2 * count) {
+                    size_t value;
+                    if (queue.try_pop(value)) {
+                        seen[value].fetch_add(1);
+                        popped.fetch_add(1);
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        ASSERT_TRUE(std::all_of(seen.begin(), seen.end(), [](const std::atomic<int>& n) { return n.load() == 1; }));
+    }
+
+    // Full and empty are reported without blocking
+    {
+        MpmcQueue<int> queue(2);
+        int value = 1;
+        ASSERT_TRUE(queue.try_push(value) && queue.try_push(value));
+        ASSERT_TRUE(!queue.try_push(value));
+        ASSERT_TRUE(queue.try_pop(value) && queue.try_pop(value));
+        ASSERT_TRUE(!queue.try_pop(value));
+    }
+
+    printf("✓ SPSC keeps order and MPMC delivers every value once across threads\n");
+    return true;
+}
+
+TEST(matches_serial_blur) {
+    const size_t frames = 23;
+    const float sigma = 1.5f;
+
+    for (unsigned int workers : { 1u, 3u }) {
+        FramePipelineOptions options;
+        options.filter_workers = workers;
+        FramePipeline pipeline(WIDTH, HEIGHT, options);
+        ASSERT_TRUE(pipeline.buffer_count() == workers + 2);
+
+        bool matches = true;
+        size_t next = 0;
+        Image input(WIDTH, HEIGHT);
+        Image expected(WIDTH, HEIGHT);
+        const FramePipelineStats stats = pipeline.run(
+            [&](size_t frame, Image& image) {
+                if (frame == frames) {
+                    return false;
+                }
+                fill_frame(image, frame);
+                return true;
+            },
+            [&](size_t frame, const Image& image) {
+                matches = matches && frame == next++;
+                fill_frame(input, frame);
+                gaussian_blur_tiled(input, expected, sigma, BorderMode::Mirror);
+                matches = matches && same_pixels(image, expected);
+                return true;
+            },
+            sigma, BorderMode::Mirror);
+
+        ASSERT_TRUE(matches);
+        ASSERT_TRUE(stats.completed && stats.frames == frames && next == frames);
+        ASSERT_TRUE(stats.fps > 0.0);
+        ASSERT_TRUE(stats.latency_p50_ms <= stats.latency_p95_ms);
+        ASSERT_TRUE(stats.latency_p95_ms <= stats.latency_p99_ms);
+        ASSERT_TRUE(stats.latency_p99_ms <= stats.latency_max_ms);
+    }
+
+    printf("✓ Pipelined frames match gaussian_blur_tiled() and arrive in order (1 and 3 workers)\n");
+    return true;
+}
+
+TEST(uneven_filter_times) {
+    // Every third frame is slow, so the other workers finish later frames
+    // first; the storer still gets them in order and nothing stalls
+    FramePipelineOptions options;
+    options.filter_workers = 3;
+    FramePipeline pipeline(WIDTH, HEIGHT, options);
+
+    size_t next = 0;
+    const FramePipelineStats stats = pipeline.run(
+        [](size_t frame, Image& image) {
+            image.data[0] = static_cast<float>(frame);
+            return frame < 60;
+        },
+        [](const Image& input, Image& output) {
+            if (static_cast<size_t>(input.data[0]) % 3 == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+            output.data[0] = input.data[0];
+        },
+        [&](size_t frame, const Image& image) {
+            next += frame == next && static_cast<size_t>(image.data[0]) == frame ? 1 : 0;
+            return true;
+        });
+    ASSERT_TRUE(stats.completed && stats.frames == 60 && next == 60);
+
+    printf("✓ Frames finishing out of order across workers are stored in order\n");
+    return true;
+}
+
+TEST(buffers_recycled) {
+    FramePipeline pipeline(WIDTH, HEIGHT);
+    ASSERT_TRUE(pipeline.buffer_count() == 3);
+
+    std::set<const float*> inputs;
+    std::set<const float*> outputs;
+    const FramePipelineStats stats = pipeline.run(
+        [&](size_t frame, Image& image) {
+            inputs.insert(image.data);
+            fill_frame(image, frame);
+            return frame < 40;
+        },
+        [&](const Image& input, Image& output) {
+            std::memcpy(output.data, input.data, input.width * input.height * 4 * sizeof(float));
+        },
+        [&](size_t, const Image& image) {
+            outputs.insert(image.data);
+            return true;
+        });
+    ASSERT_TRUE(stats.completed && stats.frames == 40);
+
+    // 41 loads and 40 stores touched only the pool images
+    ASSERT_TRUE(inputs.size() <= pipeline.buffer_count());
+    ASSERT_TRUE(outputs.size() <= pipeline.buffer_count());
+    for (size_t i = 0; i < pipeline.buffer_count(); ++i) {
+        inputs.erase(pipeline.input_buffer(i).data);
+        outputs.erase(pipeline.output_buffer(i).data);
+    }
+    ASSERT_TRUE(inputs.empty() && outputs.empty());
+
+    printf("✓ 40 frames run through the %zu-image input and output pools\n", pipeline.buffer_count());
+    return true;
+}
+
+TEST(storer_stops_pipeline) {
+    FramePipelineOptions options;
+    options.filter_workers = 2;
+    FramePipeline pipeline(WIDTH, HEIGHT, options);
+
+    std::atomic<size_t> loaded{0};
+    auto endless = [&](size_t frame, Image& image) {
+        ++loaded;
+        fill_frame(image, frame);
+        return true;
+    };
+    const FramePipelineStats stopped = pipeline.run(
+        endless, [](size_t frame, const Image&) { return frame < 5; });
+    ASSERT_TRUE(!stopped.completed && stopped.frames == 6);
+    // The reader runs ahead by at most the buffered frames
+    ASSERT_TRUE(loaded.load() <= 6 + 2 * pipeline.buffer_count());
+
+    // The pools are whole again for the next run
+    const FramePipelineStats again = pipeline.run(
+        [&](size_t frame, Image& image) { return frame < 10 && endless(frame, image); },
+        [](size_t, const Image&) { return true; });
+    ASSERT_TRUE(again.completed && again.frames == 10);
+
+    printf("✓ A storer returning false stops every stage; the pipeline can run again\n");
+    return true;
+}
+
+int main() {
+    printf("=== ARES Frame Pipeline Tests ===\n\n");
+
+    bool all_passed = true;
+    all_passed &= test_queues_across_threads();
+    all_passed &= test_matches_serial_blur();
+    all_passed &= test_uneven_filter_times();
+    all_passed &= test_buffers_recycled();
+    all_passed &= test_storer_stops_pipeline();
+
+    printf("\n");
+    if (all_passed) {
+        printf("✓ All frame pipeline tests passed!\n");
+        return 0;
+    } else {
+        printf("✗ Some tests failed\n");
+        return 1;
+    }
+}
@@ -1,7 +1,9 @@
 #include "ares/gaussian_blur.hpp"
+#include "ares/gaussian_stream.hpp"
 #include <cstdio>
 #include <cmath>
 #include <algorithm>
+#include <vector>
 
 #define ASSERT_TRUE(cond) \
     if (!(cond)) { \
@@ -67,12 +69,13 @@ TEST(gaussian_simd_blur) {
     Image input(size, size);
     Image output(size, size);
     
-    // Fill with pattern
+    // Fill with step pattern (a linear ramp is a fixed point of the blur
+    // away from the edges, so it cannot show that anything happened)
     for (size_t y = 0; y < size; ++y) {
         for (size_t x = 0; x < size; ++x) {
             size_t idx = (y * size + x) * 4;
-            input.data[idx + 0] = static_cast<float>(x) / size;
-            input.data[idx + 1] = static_cast<float>(y) / size;
+            input.data[idx + 0] = (x < size/2) ? 1.0f : 0.0f;
+            input.data[idx + 1] = (y < size/2) ? 1.0f : 0.0f;
             input.data[idx + 2] = 0.5f;
             input.data[idx + 3] = 1.0f;
         }
@@ -168,6 +171,250 @@ TEST(gaussian_tiled_blur) {
     return true;
 }
 
+TEST(gaussian_avx512_blur) {
+    if (!has_avx512_support()) {
+        printf("⊘ AVX-512 not supported, skipping AVX-512 test\n");
+        return true;
+    }
+    
+    // Odd sizes exercise the masked row tail and the border columns
+    const size_t width = 37;
+    const size_t height = 29;
+    Image input(width, height);
+    Image output_baseline(width, height);
+    Image output_avx512(width, height);
+    
+    for (size_t y = 0; y < height; ++y) {
+        for (size_t x = 0; x < width; ++x) {
+            size_t idx = (y * width + x) * 4;
+            input.data[idx + 0] = std::sin(x * 0.3f) * 0.5f + 0.5f;
+            input.data[idx + 1] = std::cos(y * 0.2f) * 0.5f + 0.5f;
+            input.data[idx + 2] = ((x + y) % 5) * 0.25f;
+            input.data[idx + 3] = 1.0f;
+        }
+    }
+    
+    gaussian_blur_baseline(input, output_baseline, 2.0f);
+    gaussian_blur_avx512(input, output_avx512, 2.0f);
+    
+    float max_diff = 0.0f;
+    for (size_t i = 0; i < width * height * 4; ++i) {
+        max_diff = std::max(max_diff,
+                            std::abs(output_baseline.data[i] - output_avx512.data[i]));
+    }
+    ASSERT_TRUE(max_diff < 1e-4f);
+    
+    printf("✓ Gaussian AVX-512 blur matches baseline (max diff %.2e)\n", max_diff);
+    return true;
+}
+
+TEST(gaussian_roi_blur) {
+    const size_t width = 96;
+    const size_t height = 80;
+    Image input(width, height);
+    Image output_full(width, height);
+    Image output_roi(width, height);
+    
+    for (size_t i = 0; i < width * height * 4; ++i) {
+        input.data[i] = static_cast<float>((i * 2654435761u) % 97) / 96.0f;
+    }
+    // Sentinel so untouched pixels can be detected
+    for (size_t i = 0; i < width * height * 4; ++i) {
+        output_roi.data[i] = -1.0f;
+    }
+    
+    gaussian_blur_tiled(input, output_full, 2.0f);
+    
+    // Interior, corner-touching, and partially out-of-bounds rectangles
+    const Rect rois[] = {
+        { 20, 15, 33, 21 },
+        { 0, 0, 7, 5 },
+        { 80, 70, 40, 40 },
+    };
+    gaussian_blur_rois(input, output_roi, rois, 2.0f);
+    
+    auto inside = [&](size_t x, size_t y) {
+        for (const Rect& r : rois) {
+            if (x >= r.x && x < r.x + r.width && y >= r.y && y < r.y + r.height) {
+                return true;
+            }
+        }
+        return false;
+    };
+    
+    float max_diff = 0.0f;
+    for (size_t y = 0; y < height; ++y) {
+        for (size_t x = 0; x < width; ++x) {
+            for (int c = 0; c < 4; ++c) {
+                size_t idx = (y * width + x) * 4 + c;
+                if (inside(x, y)) {
+                    max_diff = std::max(max_diff,
+                                        std::abs(output_roi.data[idx] - output_full.data[idx]));
+                } else {
+                    ASSERT_TRUE(output_roi.data[idx] == -1.0f);
+                }
+            }
+        }
+    }
+    ASSERT_TRUE(max_diff < 1e-5f);
+    
+    printf("✓ Gaussian ROI blur matches full blur and writes only the ROIs\n");
+    return true;
+}
+
+TEST(gaussian_border_modes) {
+    const BorderMode modes[] = {
+        BorderMode::Clamp, BorderMode::Mirror, BorderMode::Wrap, BorderMode::Constant
+    };
+    const char* names[] = { "clamp", "mirror", "wrap", "constant" };
+    
+    // Second size is smaller than the kernel radius in both directions
+    const size_t sizes[][2] = { { 23, 17 }, { 3, 2 } };
+    
+    for (const auto& sz : sizes) {
+        const size_t width = sz[0];
+        const size_t height = sz[1];
+        Image input(width, height);
+        Image expected(width, height);
+        Image output(width, height);
+        
+        for (size_t i = 0; i < width * height * 4; ++i) {
+            input.data[i] = static_cast<float>((i * 37) % 53) / 52.0f;
+        }
+        
+        for (int m = 0; m < 4; ++m) {
+            gaussian_blur_baseline(input, expected, 2.0f, modes[m]);
+            
+            auto max_diff = [&]() {
+                float d = 0.0f;
+                for (size_t i = 0; i < width * height * 4; ++i) {
+                    d = std::max(d, std::abs(output.data[i] - expected.data[i]));
+                }
+                return d;
+            };
+            
+            gaussian_blur_simd(input, output, 2.0f, modes[m]);
+            ASSERT_TRUE(max_diff() < 1e-4f);
+            gaussian_blur_tiled(input, output, 2.0f, modes[m]);
+            ASSERT_TRUE(max_diff() < 1e-4f);
+            gaussian_blur_multithreaded(input, output, 2.0f, modes[m]);
+            ASSERT_TRUE(max_diff() < 1e-4f);
+            gaussian_blur_roi(input, output, Rect{ 0, 0, width, height }, 2.0f, modes[m]);
+            ASSERT_TRUE(max_diff() < 1e-4f);
+            
+            if (width > 3) {
+                printf("  %-8s all variants match baseline\n", names[m]);
+            }
+        }
+    }
+    
+    printf("✓ Gaussian border modes match baseline in every variant\n");
+    return true;
+}
+
+TEST(gaussian_batch_blur) {
+    // Mixed sizes, sigmas and borders; the last image is large enough to be
+    // split into row bands
+    const size_t sizes[][2] = { { 16, 16 }, { 33, 7 }, { 128, 128 }, { 5, 40 }, { 720, 400 } };
+    const float sigmas[] = { 1.0f, 2.0f, 0.7f, 3.0f, 1.5f };
+    const BorderMode borders[] = {
+        BorderMode::Clamp, BorderMode::Mirror, BorderMode::Wrap,
+        BorderMode::Constant, BorderMode::Clamp
+    };
+    
+    std::vector<Image> inputs;
+    std::vector<Image> outputs;
+    std::vector<Image> expected;
+    for (const auto& sz : sizes) {
+        inputs.emplace_back(sz[0], sz[1]);
+        outputs.emplace_back(sz[0], sz[1]);
+        expected.emplace_back(sz[0], sz[1]);
+        Image& img = inputs.back();
+        for (size_t i = 0; i < sz[0] * sz[1] * 4; ++i) {
+            img.data[i] = static_cast<float>((i * 131) % 61) / 60.0f;
+        }
+    }
+    
+    std::vector<BlurJob> jobs;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        jobs.push_back(BlurJob{ &inputs[i], &outputs[i], sigmas[i], borders[i] });
+        gaussian_blur_tiled(inputs[i], expected[i], sigmas[i], borders[i]);
+    }
+    
+    gaussian_blur_batch(jobs);
+    
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        const size_t n = inputs[i].width * inputs[i].height * 4;
+        float max_diff = 0.0f;
+        for (size_t k = 0; k < n; ++k) {
+            max_diff = std::max(max_diff, std::abs(outputs[i].data[k] - expected[i].data[k]));
+        }
+        ASSERT_TRUE(max_diff < 1e-5f);
+    }
+    
+    printf("✓ Gaussian batch blur matches per-image tiled blur\n");
+    return true;
+}
+
+TEST(gaussian_stream_blur) {
+    const BorderMode modes[] = { BorderMode::Clamp, BorderMode::Mirror, BorderMode::Constant };
+    
+    // Second size is shorter than the rolling window
+    const size_t sizes[][2] = { { 41, 57 }, { 19, 5 } };
+    
+    for (const auto& sz : sizes) {
+        const size_t width = sz[0];
+        const size_t height = sz[1];
+        const size_t row_floats = width * 4;
+        Image input(width, height);
+        Image expected(width, height);
+        Image output(width, height);
+        
+        for (size_t i = 0; i < width * height * 4; ++i) {
+            input.data[i] = static_cast<float>((i * 29) % 47) / 46.0f;
+        }
+        
+        for (BorderMode mode : modes) {
+            gaussian_blur_simd(input, expected, 2.0f, mode);
+            
+            size_t rows_in = 0;
+            size_t rows_out = 0;
+            bool ok = gaussian_blur_stream(
+                width, height,
+                [&](float* row) {
+                    std::copy(input.data + rows_in * row_floats,
+                              input.data + (rows_in + 1) * row_floats, row);
+                    ++rows_in;
+                    return true;
+                },
+                [&](const float* row) {
+                    std::copy(row, row + row_floats, output.data + rows_out * row_floats);
+                    ++rows_out;
+                    return true;
+                },
+                2.0f, mode);
+            ASSERT_TRUE(ok);
+            ASSERT_TRUE(rows_in == height && rows_out == height);
+            
+            for (size_t i = 0; i < width * height * 4; ++i) {
+                ASSERT_TRUE(output.data[i] == expected.data[i]);
+            }
+        }
+    }
+    
+    // Wrap needs the last rows before the first ones; rejected up front
+    size_t reads = 0;
+    bool ok = gaussian_blur_stream(
+        8, 8,
+        [&](float*) { ++reads; return true; },
+        [&](const float*) { return true; },
+        2.0f, BorderMode::Wrap);
+    ASSERT_TRUE(!ok && reads == 0);
+    
+    printf("✓ Gaussian streaming blur matches whole-image SIMD blur\n");
+    return true;
+}
+
 int main() {
     printf("=== ARES Gaussian Blur Tests ===\n\n");
     
@@ -177,6 +424,11 @@ int main() {
     all_passed &= test_gaussian_simd_blur();
     all_passed &= test_gaussian_baseline_vs_simd();
     all_passed &= test_gaussian_tiled_blur();
+    all_passed &= test_gaussian_avx512_blur();
+    all_passed &= test_gaussian_roi_blur();
+    all_passed &= test_gaussian_border_modes();
+    all_passed &= test_gaussian_batch_blur();
+    all_passed &= test_gaussian_stream_blur();
     
     printf("\n");
     if (all_passed) {
@@ -0,0 +1,333 @@
+#include "ares/image_io.hpp"
+#include "ares/gaussian_stream.hpp"
+#include <cstdio>
+#include <cmath>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        printf("FAILED: %s (line %d)\n", #cond, __LINE__); \
+        return false; \
+    }
+
+#define TEST(name) \
+    bool test_##name(); \
+    bool test_##name()
+
+using namespace ares;
+
+// Image with 8-bit-exact values so PPM round trips are lossless
+static Image make_pattern(size_t width, size_t height) {
+    Image img(width, height);
+    for (size_t i = 0; i < width * height; ++i) {
+        img.data[i * 4 + 0] = static_cast<float>((i * 7) % 256) / 255.0f;
+        img.data[i * 4 + 1] = static_cast<float>((i * 13 + 50) % 256) / 255.0f;
+        img.data[i * 4 + 2] = static_cast<float>((i * 31 + 100) % 256) / 255.0f;
+        img.data[i * 4 + 3] = 1.0f;
+    }
+    return img;
+}
+
+static bool write_rows(const Image& img, const std::string& filename, ImageFileFormat format) {
+    ImageRowWriter writer;
+    if (!writer.open(filename, img.width, img.height, format)) {
+        return false;
+    }
+    for (size_t y = 0; y < img.height; ++y) {
+        if (!writer.write_row(img.data + y * img.width * 4)) {
+            return false;
+        }
+    }
+    return writer.close();
+}
+
+static bool read_rows(Image& img, const std::string& filename, ImageFileFormat format) {
+    ImageRowReader reader;
+    if (!reader.open(filename) || reader.format() != format ||
+        reader.width() != img.width || reader.height() != img.height) {
+        return false;
+    }
+    for (size_t y = 0; y < img.height; ++y) {
+        if (!reader.read_row(img.data + y * img.width * 4)) {
+            return false;
+        }
+    }
+    // Reading past the last row fails
+    std::vector<float> extra(img.width * 4);
+    return !reader.read_row(extra.data());
+}
+
+TEST(row_stream_ppm_roundtrip) {
+    const std::string path = "ares_test_rows.ppm";
+    Image input = make_pattern(37, 11);
+    Image output(37, 11);
+    
+    ASSERT_TRUE(write_rows(input, path, ImageFileFormat::PPM));
+    ASSERT_TRUE(read_rows(output, path, ImageFileFormat::PPM));
+    std::remove(path.c_str());
+    
+    for (size_t i = 0; i < 37 * 11 * 4; ++i) {
+        ASSERT_TRUE(std::abs(output.data[i] - input.data[i]) < 1e-6f);
+    }
+    
+    printf("✓ PPM row writer/reader round trip is lossless\n");
+    return true;
+}
+
+TEST(row_stream_pfm_roundtrip) {
+    const std::string path = "ares_test_rows.pfm";
+    Image input(29, 13);
+    for (size_t i = 0; i < 29 * 13; ++i) {
+        input.data[i * 4 + 0] = std::sin(i * 0.1f) * 3.0f;   // PFM keeps out-of-range values
+        input.data[i * 4 + 1] = static_cast<float>(i);
+        input.data[i * 4 + 2] = -0.5f / (i + 1);
+        input.data[i * 4 + 3] = 1.0f;
+    }
+    Image output(29, 13);
+    
+    ASSERT_TRUE(write_rows(input, path, ImageFileFormat::PFM));
+    ASSERT_TRUE(read_rows(output, path, ImageFileFormat::PFM));
+    std::remove(path.c_str());
+    
+    for (size_t i = 0; i < 29 * 13 * 4; ++i) {
+        ASSERT_TRUE(output.data[i] == input.data[i]);
+    }
+    
+    printf("✓ PFM row writer/reader round trip is exact\n");
+    return true;
+}
+
+TEST(stream_blur_file_to_file) {
+    const std::string in_path = "ares_test_stream_in.pfm";
+    const std::string out_path = "ares_test_stream_out.pfm";
+    const size_t width = 53;
+    const size_t height = 71;
+    
+    Image input = make_pattern(width, height);
+    Image expected(width, height);
+    Image output(width, height);
+    gaussian_blur_simd(input, expected, 1.5f);
+    
+    ASSERT_TRUE(write_rows(input, in_path, ImageFileFormat::PFM));
+    
+    ImageRowReader reader;
+    ImageRowWriter writer;
+    ASSERT_TRUE(reader.open(in_path));
+    ASSERT_TRUE(writer.open(out_path, reader.width(), reader.height(), ImageFileFormat::PFM));
+    ASSERT_TRUE(gaussian_blur_stream(reader, writer, 1.5f));
+    ASSERT_TRUE(writer.close());
+    
+    ASSERT_TRUE(read_rows(output, out_path, ImageFileFormat::PFM));
+    std::remove(in_path.c_str());
+    std::remove(out_path.c_str());
+    
+    // Alpha is not stored in the file; compare RGB
+    for (size_t i = 0; i < width * height; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            ASSERT_TRUE(output.data[i * 4 + c] == expected.data[i * 4 + c]);
+        }
+    }
+    
+    printf("✓ Streaming file-to-file blur matches in-memory blur\n");
+    return true;
+}
+
+TEST(whole_image_ppm_roundtrip) {
+    const std::string path = "ares_test_image.ppm";
+    
+    // Odd widths exercise the vector body and the scalar tail
+    const size_t widths[] = { 1, 5, 67 };
+    for (size_t width : widths) {
+        Image input = make_pattern(width, 9);
+        ASSERT_TRUE(save_image_ppm(input, path));
+        
+        Image output(1, 1);
+        ASSERT_TRUE(load_image(path, output));
+        ASSERT_TRUE(output.width == width && output.height == 9);
+        
+        // Every channel, including G, survives the round trip
+        for (size_t i = 0; i < width * 9 * 4; ++i) {
+            ASSERT_TRUE(std::abs(output.data[i] - input.data[i]) < 1e-6f);
+        }
+        
+        // The row reader sees the same file
+        Image rows(width, 9);
+        ASSERT_TRUE(read_rows(rows, path, ImageFileFormat::PPM));
+        for (size_t i = 0; i < width * 9 * 4; ++i) {
+            ASSERT_TRUE(rows.data[i] == output.data[i]);
+        }
+    }
+    std::remove(path.c_str());
+    
+    printf("✓ PPM save/load round trip is lossless\n");
+    return true;
+}
+
+TEST(whole_image_ppm_clamps_and_rounds) {
+    const std::string path = "ares_test_clamp.ppm";
+    Image input(6, 1);
+    const float values[6] = { -0.5f, 0.0f, 0.1f, 0.5f, 1.0f, 2.0f };
+    const int expected[6] = { 0, 0, 26, 128, 255, 255 };
+    for (size_t x = 0; x < 6; ++x) {
+        for (int c = 0; c < 4; ++c) {
+            input.data[x * 4 + c] = values[x];
+        }
+    }
+    ASSERT_TRUE(save_image_ppm(input, path));
+    
+    FILE* f = std::fopen(path.c_str(), "rb");
+    ASSERT_TRUE(f != nullptr);
+    unsigned char bytes[64];
+    size_t n = std::fread(bytes, 1, sizeof(bytes), f);
+    std::fclose(f);
+    std::remove(path.c_str());
+    
+    const size_t header = std::string("P6\n6 1\n255\n").size();
+    ASSERT_TRUE(n == header + 18);
+    for (size_t x = 0; x < 6; ++x) {
+        for (int c = 0; c < 3; ++c) {
+            ASSERT_TRUE(bytes[header + x * 3 + c] == expected[x]);
+        }
+    }
+    
+    printf("✓ PPM writer clamps and rounds to 8 bits\n");
+    return true;
+}
+
+TEST(whole_image_pfm_roundtrip) {
+    const std::string path = "ares_test_image.pfm";
+    Image input(31, 17);
+    for (size_t i = 0; i < 31 * 17; ++i) {
+        input.data[i * 4 + 0] = std::cos(i * 0.3f) * 10.0f;
+        input.data[i * 4 + 1] = static_cast<float>(i) * 0.25f;
+        input.data[i * 4 + 2] = -static_cast<float>(i);
+        input.data[i * 4 + 3] = 1.0f;
+    }
+    ASSERT_TRUE(save_image_pfm(input, path));
+    
+    Image output(31, 17);
+    float* original = output.data;
+    ASSERT_TRUE(load_image(path, output));
+    ASSERT_TRUE(output.data == original);  // same size: loaded in place
+    for (size_t i = 0; i < 31 * 17 * 4; ++i) {
+        ASSERT_TRUE(output.data[i] == input.data[i]);
+    }
+    
+    // Files from the row writer and the mapped writer are interchangeable
+    Image rows(31, 17);
+    ASSERT_TRUE(read_rows(rows, path, ImageFileFormat::PFM));
+    std::remove(path.c_str());
+    for (size_t i = 0; i < 31 * 17 * 4; ++i) {
+        ASSERT_TRUE(rows.data[i] == input.data[i]);
+    }
+    
+    printf("✓ PFM save/load round trip is exact\n");
+    return true;
+}
+
+TEST(reader_rejects_bad_files) {
+    ImageRowReader reader;
+    ASSERT_TRUE(!reader.open("ares_test_missing_file.ppm"));
+    
+    const std::string path = "ares_test_bad.ppm";
+    FILE* f = std::fopen(path.c_str(), "wb");
+    ASSERT_TRUE(f != nullptr);
+    std::fputs("P3\n2 2\n255\n0 0 0 0 0 0 0 0 0 0 0 0\n", f);  // ASCII PPM
+    std::fclose(f);
+    ASSERT_TRUE(!reader.open(path));
+    Image img(2, 2);
+    ASSERT_TRUE(!load_image(path, img));
+    
+    // Truncated pixel data
+    f = std::fopen(path.c_str(), "wb");
+    ASSERT_TRUE(f != nullptr);
+    std::fputs("P6\n4 4\n255\n", f);
+    std::fputc(0, f);
+    std::fclose(f);
+    ASSERT_TRUE(!load_image(path, img));
+    ASSERT_TRUE(!load_image("ares_test_missing_file.ppm", img));
+    
+    // Header comments are skipped
+    f = std::fopen(path.c_str(), "wb");
+    ASSERT_TRUE(f != nullptr);
+    std::fputs("P6\n# comment\n1 1\n255\n", f);
+    std::fputc(255, f); std::fputc(0, f); std::fputc(51, f);
+    std::fclose(f);
+    ASSERT_TRUE(reader.open(path));
+    float px[4];
+    ASSERT_TRUE(reader.read_row(px));
+    ASSERT_TRUE(px[0] == 1.0f && px[1] == 0.0f && std::abs(px[2] - 0.2f) < 1e-6f && px[3] == 1.0f);
+    std::remove(path.c_str());
+    
+    printf("✓ Reader rejects unsupported files and skips header comments\n");
+    return true;
+}
+
+TEST(oversized_header_rejected) {
+    // Dimensions whose pixel count overflows size_t once multiplied out;
+    // the PPM one wraps width * height * 3 to 0 on 64-bit
+    const std::string path = "ares_test_oversized.ppm";
+    const char* headers[] = {
+        "P6\n4294967296 4294967296\n255\n",
+        "PF\n2147483648 2147483648\n-1.0\n",
+        "P6\n18446744073709551615 1\n255\n",
+    };
+    for (const char* header : headers) {
+        FILE* f = std::fopen(path.c_str(), "wb");
+        ASSERT_TRUE(f != nullptr);
+        std::fputs(header, f);
+        for (int i = 0; i < 64; ++i) {
+            std::fputc(0, f);
+        }
+        std::fclose(f);
+
+        Image img(2, 2);
+        float* data = img.data;
+        ASSERT_TRUE(!load_image(path, img));
+        ASSERT_TRUE(img.width == 2 && img.height == 2 && img.data == data);
+
+        ImageRowReader reader;
+        ASSERT_TRUE(!reader.open(path));
+    }
+
+    // A header that fits but promises more rows than the file holds
+    FILE* f = std::fopen(path.c_str(), "wb");
+    ASSERT_TRUE(f != nullptr);
+    std::fputs("PF\n1000000 1000000\n-1.0\n", f);
+    std::fclose(f);
+    ImageRowReader reader;
+    ASSERT_TRUE(!reader.open(path));
+    std::remove(path.c_str());
+
+    ImageRowWriter writer;
+    ASSERT_TRUE(!writer.open(path, size_t(1) << 32, size_t(1) << 32, ImageFileFormat::PFM));
+    std::remove(path.c_str());
+
+    printf("✓ Oversized headers are rejected before anything is allocated\n");
+    return true;
+}
+
+int main() {
+    printf("=== ARES Image I/O Tests ===\n\n");
+    
+    bool all_passed = true;
+    all_passed &= test_row_stream_ppm_roundtrip();
+    all_passed &= test_row_stream_pfm_roundtrip();
+    all_passed &= test_stream_blur_file_to_file();
+    all_passed &= test_whole_image_ppm_roundtrip();
+    all_passed &= test_whole_image_ppm_clamps_and_rounds();
+    all_passed &= test_whole_image_pfm_roundtrip();
+    all_passed &= test_reader_rejects_bad_files();
+    all_passed &= test_oversized_header_rejected();
+    
+    printf("\n");
+    if (all_passed) {
+        printf("✓ All image I/O tests passed!\n");
+        return 0;
+    } else {
+        printf("✗ Some tests failed\n");
+        return 1;
+    }
+}
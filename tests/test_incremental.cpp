@@ -0,0 +1,170 @@
+#include "ares/gaussian_incremental.hpp"
+#include "ares/separable_filter.hpp"
+#include "ares/gaussian_blur.hpp"
+#include "test_util.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        printf("FAILED: %s (line %d)\n", #cond, __LINE__); \
+        return false; \
+    }
+
+#define TEST(name) \
+    bool test_##name(); \
+    bool test_##name()
+
+using namespace ares;
+using namespace ares_test;
+
+// Small deterministic generator for rectangles and pixel values
+struct Lcg {
+    uint32_t state = 12345;
+    uint32_t next(uint32_t n) {
+        state = state * 1664525u + 1013904223u;
+        return (state >> 8) % n;
+    }
+};
+
+// Paint `rect` (clipped) of frame with new values
+static void paint(Image& frame, const Rect& rect, Lcg& rng) {
+    for (size_t y = rect.y; y < std::min(rect.y + rect.height, frame.height); ++y) {
+        for (size_t x = rect.x; x < std::min(rect.x + rect.width, frame.width); ++x) {
+            for (size_t c = 0; c < 4; ++c) {
+                frame.data[(y * frame.width + x) * 4 + c] = static_cast<float>(rng.next(1000)) / 999.0f;
+            }
+        }
+    }
+}
+
+TEST(matches_full_filter) {
+    struct Case {
+        const char* name;
+        SeparableFilter filter;
+        size_t width;
+        size_t height;
+    };
+    const Case cases[] = {
+        { "gaussian 1.5", SeparableFilter::gaussian(1.5f), 61, 47 },
+        { "sobel_x", SeparableFilter::sobel_x(), 61, 47 },
+        // Apron longer than the image: Mirror folds more than once
+        { "gaussian 8", SeparableFilter::gaussian(8.0f), 20, 15 },
+    };
+    const BorderMode borders[] = { BorderMode::Clamp, BorderMode::Mirror, BorderMode::Wrap, BorderMode::Constant };
+
+    Lcg rng;
+    for (const Case& c : cases) {
+        for (BorderMode border : borders) {
+            Image frame = make_pattern(c.width, c.height);
+            Image expected(c.width, c.height);
+            IncrementalBlur blur(c.filter, border);
+            blur.reset(frame);
+            separable_filter_simd(frame, expected, c.filter, border);
+            ASSERT_TRUE(same_pixels(blur.output(), expected));
+
+            for (int step = 0; step < 12; ++step) {
+                // 1-3 rectangles, some touching or crossing the edges, some overlapping
+                std::vector<Rect> dirty;
+                const uint32_t count = 1 + rng.next(3);
+                for (uint32_t i = 0; i < count; ++i) {
+                    Rect r;
+                    r.x = rng.next(static_cast<uint32_t>(c.width));
+                    r.y = rng.next(static_cast<uint32_t>(c.height));
+                    r.width = 1 + rng.next(static_cast<uint32_t>(c.width / 2));
+                    r.height = 1 + rng.next(static_cast<uint32_t>(c.height / 2));
+                    paint(frame, r, rng);
+                    dirty.push_back(r);
+                }
+                ASSERT_TRUE(blur.update(frame, dirty));
+                separable_filter_simd(frame, expected, c.filter, border);
+                if (!same_pixels(blur.output(), expected)) {
+                    printf("FAILED: %s, border %d, step %d\n", c.name, static_cast<int>(border), step);
+                    return false;
+                }
+                ASSERT_TRUE(same_pixels(blur.input(), frame));
+            }
+        }
+    }
+
+    printf("✓ Incremental updates match separable_filter_simd() bitwise (3 filters, 4 borders)\n");
+    return true;
+}
+
+TEST(cost_follows_changed_area) {
+    const size_t size = 512;
+    Image frame = make_pattern(size, size);
+    IncrementalBlur blur(2.0f);  // radius 6
+    blur.reset(frame);
+    ASSERT_TRUE(blur.recomputed_pixels() == 2 * size * size);
+
+    // 8x8 change: rows 8 x (8 + 12) columns, then (8 + 12) x (8 + 12)
+    Lcg rng;
+    const Rect small = { 200, 300, 8, 8 };
+    paint(frame, small, rng);
+    ASSERT_TRUE(blur.update(frame, std::span<const Rect>(&small, 1)));
+    ASSERT_TRUE(blur.recomputed_pixels() == 8 * 20 + 20 * 20);
+
+    // Nothing changed: nothing recomputed, output untouched
+    Image expected(size, size);
+    gaussian_blur_simd(frame, expected, 2.0f);
+    ASSERT_TRUE(blur.update(frame, {}));
+    ASSERT_TRUE(blur.recomputed_pixels() == 0);
+    ASSERT_TRUE(same_pixels(blur.output(), expected));
+
+    // At the image corner the apron is clipped
+    const Rect corner = { 0, 0, 4, 4 };
+    ASSERT_TRUE(blur.update(frame, std::span<const Rect>(&corner, 1)));
+    ASSERT_TRUE(blur.recomputed_pixels() == 4 * 10 + 10 * 10);
+
+    printf("✓ An 8x8 change recomputes %zu pixels instead of %zu\n", size_t{ 8 * 20 + 20 * 20 }, 2 * size * size);
+    return true;
+}
+
+TEST(rejects_bad_updates) {
+    Image frame = make_pattern(32, 24);
+    const Rect all = { 0, 0, 32, 24 };
+
+    IncrementalBlur blur(1.0f);
+    ASSERT_TRUE(!blur.valid());
+    ASSERT_TRUE(!blur.update(frame, std::span<const Rect>(&all, 1)));
+
+    blur.reset(frame);
+    ASSERT_TRUE(blur.valid());
+    Image other = make_pattern(24, 32);
+    ASSERT_TRUE(!blur.update(other, std::span<const Rect>(&all, 1)));
+
+    // Resetting with another size re-sizes the state
+    blur.reset(other);
+    Image expected(24, 32);
+    gaussian_blur_simd(other, expected, 1.0f);
+    ASSERT_TRUE(same_pixels(blur.output(), expected));
+
+    // Invalid filters never become valid
+    const float even[] = { 0.5f, 0.5f };
+    IncrementalBlur invalid(SeparableFilter(even, even));
+    invalid.reset(frame);
+    ASSERT_TRUE(!invalid.valid());
+
+    printf("✓ Updates before reset() or of another size are rejected\n");
+    return true;
+}
+
+int main() {
+    printf("=== ARES Incremental Blur Tests ===\n\n");
+
+    bool all_passed = true;
+    all_passed &= test_matches_full_filter();
+    all_passed &= test_cost_follows_changed_area();
+    all_passed &= test_rejects_bad_updates();
+
+    printf("\n");
+    if (all_passed) {
+        printf("✓ All incremental blur tests passed!\n");
+        return 0;
+    } else {
+        printf("✗ Some tests failed\n");
+        return 1;
+    }
+}
@@ -0,0 +1,199 @@
+#include "ares/integral_image.hpp"
+#include "ares/separable_filter.hpp"
+#include "ares/gaussian_blur.hpp"
+#include "test_util.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        printf("FAILED: %s (line %d)\n", #cond, __LINE__); \
+        return false; \
+    }
+
+#define TEST(name) \
+    bool test_##name(); \
+    bool test_##name()
+
+using namespace ares;
+using namespace ares_test;
+
+struct Lcg {
+    uint32_t state = 777;
+    uint32_t next(uint32_t n) {
+        state = state * 1664525u + 1013904223u;
+        return (state >> 8) % n;
+    }
+};
+
+static Rect random_rect(Lcg& rng, size_t width, size_t height) {
+    // Some rectangles run past the right or bottom edge, some are empty
+    Rect r;
+    r.x = rng.next(static_cast<uint32_t>(width + 2));
+    r.y = rng.next(static_cast<uint32_t>(height + 2));
+    r.width = rng.next(static_cast<uint32_t>(width + 1));
+    r.height = rng.next(static_cast<uint32_t>(height + 1));
+    return r;
+}
+
+// Brute-force per-channel sum over the clipped rectangle
+static void reference_sum(const Image& img, const Rect& r, double sum[4]) {
+    for (int c = 0; c < 4; ++c) {
+        sum[c] = 0.0;
+    }
+    for (size_t y = r.y; y < std::min(r.y + r.height, img.height); ++y) {
+        for (size_t x = r.x; x < std::min(r.x + r.width, img.width); ++x) {
+            for (int c = 0; c < 4; ++c) {
+                sum[c] += img.data[(y * img.width + x) * 4 + c];
+            }
+        }
+    }
+}
+
+TEST(box_sums_match_reference) {
+    Image img = make_pattern(37, 23);
+    IntegralImage integral;
+    integral.build(img);
+    ASSERT_TRUE(integral.width() == 37 && integral.height() == 23);
+
+    // First row and column of the table are zero
+    for (int c = 0; c < 4; ++c) {
+        ASSERT_TRUE(integral.at(0, 11)[c] == 0.0 && integral.at(20, 0)[c] == 0.0);
+    }
+
+    Lcg rng;
+    double worst = 0.0;
+    for (int i = 0; i < 2000; ++i) {
+        const Rect r = random_rect(rng, img.width, img.height);
+        double sum[4];
+        double expected[4];
+        integral.box_sum(r, sum);
+        reference_sum(img, r, expected);
+        for (int c = 0; c < 4; ++c) {
+            worst = std::max(worst, std::fabs(sum[c] - expected[c]));
+        }
+    }
+    ASSERT_TRUE(worst < 1e-9);
+
+    printf("✓ Box sums match brute force, clipped and empty rectangles included (max diff %.1e)\n", worst);
+    return true;
+}
+
+TEST(double_accumulation) {
+    // A float table would hold ~1e5 with 1/128 resolution in its last
+    // entries; the double table still resolves one pixel there
+    const size_t size = 1024;
+    Image img(size, size);
+    for (size_t i = 0; i < size * size * 4; ++i) {
+        img.data[i] = 0.1f;
+    }
+    img.data[((size - 2) * size + (size - 2)) * 4] = 0.7f;
+
+    IntegralImage integral;
+    integral.build(img);
+    const Rect corner = { size - 3, size - 3, 3, 3 };
+    float mean[4];
+    integral.box_means(std::span<const Rect>(&corner, 1), mean);
+    const double expected = (8.0 * 0.1f + 0.7f) / 9.0;
+    ASSERT_TRUE(std::fabs(mean[0] - expected) < 1e-6);
+    ASSERT_TRUE(std::fabs(mean[1] - 0.1f) < 1e-6);
+
+    // Rebuilding at the same size keeps the table
+    const size_t bytes = integral.table_bytes();
+    const double* first = integral.at(0, 0);
+    integral.build(img);
+    ASSERT_TRUE(integral.table_bytes() == bytes && integral.at(0, 0) == first);
+
+    printf("✓ 3x3 mean in the last corner of a 1024x1024 table is exact to 1e-6\n");
+    return true;
+}
+
+TEST(batched_queries) {
+    Image img = make_pattern(300, 260);
+    IntegralImage integral;
+    integral.build(img);
+
+    // Large enough to be split across the pool
+    Lcg rng;
+    std::vector<Rect> rects(20000);
+    for (Rect& r : rects) {
+        r = random_rect(rng, img.width, img.height);
+    }
+    std::vector<double> sums(rects.size() * 4);
+    std::vector<float> means(rects.size() * 4);
+    integral.box_sums(rects, sums.data());
+    integral.box_means(rects, means.data());
+
+    for (size_t i = 0; i < rects.size(); ++i) {
+        double single[4];
+        integral.box_sum(rects[i], single);
+        const size_t x0 = std::min(rects[i].x, img.width);
+        const size_t y0 = std::min(rects[i].y, img.height);
+        const size_t area = std::min(rects[i].width, img.width - x0) * std::min(rects[i].height, img.height - y0);
+        for (int c = 0; c < 4; ++c) {
+            ASSERT_TRUE(sums[i * 4 + c] == single[c]);
+            const float mean = area ? static_cast<float>(single[c] / area) : 0.0f;
+            ASSERT_TRUE(means[i * 4 + c] == mean);
+        }
+    }
+
+    printf("✓ Batched sums and means match single queries (%zu rectangles)\n", rects.size());
+    return true;
+}
+
+TEST(box_blur_matches_separable) {
+    const BorderMode borders[] = { BorderMode::Clamp, BorderMode::Mirror, BorderMode::Wrap, BorderMode::Constant };
+    const int radii[] = { 0, 1, 3, 20, 40 };  // 40: box wider than the image
+    Image img = make_pattern(53, 29);
+    Image expected(53, 29);
+    Image output(53, 29);
+
+    float worst = 0.0f;
+    for (BorderMode border : borders) {
+        for (int radius : radii) {
+            separable_filter_simd(img, expected, SeparableFilter::box(radius), border);
+            box_blur(img, output, radius, border);
+            const float diff = max_difference(output, expected);
+            if (diff > 2e-5f) {
+                printf("FAILED: border %d, radius %d, max diff %.2e\n", static_cast<int>(border), radius, diff);
+                return false;
+            }
+            worst = std::max(worst, diff);
+        }
+    }
+
+    // Large enough for the parallel path
+    Image large = make_pattern(640, 480);
+    Image large_expected(640, 480);
+    Image large_output(640, 480);
+    separable_filter_simd(large, large_expected, SeparableFilter::box(7), BorderMode::Mirror);
+    box_blur(large, large_output, 7, BorderMode::Mirror);
+    for (size_t i = 0; i < 640 * 480 * 4; ++i) {
+        ASSERT_TRUE(std::fabs(large_output.data[i] - large_expected.data[i]) < 2e-5f);
+    }
+
+    printf("✓ box_blur() matches the separable box filter for every border (max diff %.2e)\n", worst);
+    return true;
+}
+
+int main() {
+    printf("=== ARES Integral Image Tests ===\n\n");
+
+    bool all_passed = true;
+    all_passed &= test_box_sums_match_reference();
+    all_passed &= test_double_accumulation();
+    all_passed &= test_batched_queries();
+    all_passed &= test_box_blur_matches_separable();
+
+    printf("\n");
+    if (all_passed) {
+        printf("✓ All integral image tests passed!\n");
+        return 0;
+    } else {
+        printf("✗ Some tests failed\n");
+        return 1;
+    }
+}
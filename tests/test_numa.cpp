@@ -0,0 +1,156 @@
+#include "ares/numa.hpp"
+#include "ares/gaussian_blur.hpp"
+#include <cstdio>
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        printf("FAILED: %s (line %d)\n", #cond, __LINE__); \
+        return false; \
+    }
+
+#define TEST(name) \
+    bool test_##name(); \
+    bool test_##name()
+
+using namespace ares;
+
+static void fill_pattern(Image& img) {
+    for (size_t i = 0; i < img.width * img.height * 4; ++i) {
+        img.data[i] = static_cast<float>((i * 37) % 251) / 250.0f;
+    }
+}
+
+static bool known_node(int node) {
+    for (const NumaNode& n : numa_nodes()) {
+        if (n.id == node) {
+            return true;
+        }
+    }
+    return false;
+}
+
+TEST(topology) {
+    const std::vector<NumaNode>& nodes = numa_nodes();
+    ASSERT_TRUE(!nodes.empty());
+
+    std::set<unsigned int> seen;
+    for (const NumaNode& node : nodes) {
+        ASSERT_TRUE(node.id >= 0);
+        ASSERT_TRUE(!node.cpus.empty());
+        for (unsigned int cpu : node.cpus) {
+            ASSERT_TRUE(seen.insert(cpu).second);  // each CPU on one node
+        }
+    }
+
+    printf("✓ NUMA topology detected (%zu node(s), %zu CPUs)\n", nodes.size(), seen.size());
+    return true;
+}
+
+TEST(worker_cpus_follow_placement) {
+    const bool initial = numa_placement();
+
+    set_numa_placement(false);
+    ASSERT_TRUE(blur_worker_cpus().empty());
+
+    set_numa_placement(true);
+    std::vector<unsigned int> cpus = blur_worker_cpus();
+    ASSERT_TRUE(!cpus.empty());
+
+    // Node-major order: once a node's CPUs are done it never comes back
+    std::vector<int> node_of_worker;
+    for (unsigned int cpu : cpus) {
+        for (const NumaNode& node : numa_nodes()) {
+            for (unsigned int c : node.cpus) {
+                if (c == cpu) {
+                    node_of_worker.push_back(node.id);
+                }
+            }
+        }
+    }
+    ASSERT_TRUE(node_of_worker.size() == cpus.size());
+    std::set<int> finished;
+    for (size_t i = 1; i < node_of_worker.size(); ++i) {
+        if (node_of_worker[i] != node_of_worker[i - 1]) {
+            ASSERT_TRUE(finished.insert(node_of_worker[i - 1]).second);
+            ASSERT_TRUE(finished.count(node_of_worker[i]) == 0);
+        }
+    }
+
+    set_numa_placement(initial);
+    printf("✓ Worker CPUs grouped by node (%zu workers)\n", cpus.size());
+    return true;
+}
+
+TEST(placed_blur_matches_unplaced) {
+    const bool initial = numa_placement();
+    const size_t width = 301;
+    const size_t height = 157;
+
+    Image input(width, height);
+    fill_pattern(input);
+    Image reference(width, height);
+    gaussian_blur_simd(input, reference, 2.0f, BorderMode::Mirror);
+
+    for (bool placed : { false, true }) {
+        set_numa_placement(placed);
+        Image placed_input = make_numa_image(width, height);
+        std::memcpy(placed_input.data, input.data, input.size_bytes());
+        Image output = make_numa_image(width, height);
+        gaussian_blur_multithreaded(placed_input, output, 2.0f, BorderMode::Mirror);
+        ASSERT_TRUE(std::memcmp(output.data, reference.data, reference.size_bytes()) == 0);
+    }
+
+    set_numa_placement(initial);
+    printf("✓ Multithreaded blur identical with and without NUMA placement\n");
+    return true;
+}
+
+TEST(first_touch_image) {
+    const bool initial = numa_placement();
+    set_numa_placement(true);
+
+    Image image = make_numa_image(640, 480);
+    ASSERT_TRUE(image.width == 640 && image.height == 480 && image.data != nullptr);
+    for (size_t i = 0; i < image.width * image.height * 4; ++i) {
+        ASSERT_TRUE(image.data[i] == 0.0f);
+    }
+
+    // Every band was touched, so its pages are resident on some node
+    // (-1 only where the page query is unavailable)
+    const int first = numa_node_of(image.data);
+    const int last = numa_node_of(image.data + image.width * image.height * 4 - 1);
+    ASSERT_TRUE(first == -1 || known_node(first));
+    ASSERT_TRUE(last == -1 || known_node(last));
+
+    // Single node: everything lands on it
+    if (numa_nodes().size() == 1 && first != -1) {
+        ASSERT_TRUE(first == numa_nodes()[0].id && last == numa_nodes()[0].id);
+    }
+
+    set_numa_placement(initial);
+    printf("✓ First-touch image zeroed by band (first page on node %d)\n", first);
+    return true;
+}
+
+int main() {
+    printf("=== ARES NUMA Tests ===\n\n");
+
+    bool all_passed = true;
+    all_passed &= test_topology();
+    all_passed &= test_worker_cpus_follow_placement();
+    all_passed &= test_placed_blur_matches_unplaced();
+    all_passed &= test_first_touch_image();
+
+    printf("\n");
+    if (all_passed) {
+        printf("✓ All NUMA tests passed!\n");
+        return 0;
+    } else {
+        printf("✗ Some tests failed\n");
+        return 1;
+    }
+}
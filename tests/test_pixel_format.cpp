@@ -0,0 +1,196 @@
+#include "ares/pixel_format.hpp"
+#include "ares/cpu_dispatch.hpp"
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        printf("FAILED: %s (line %d)\n", #cond, __LINE__); \
+        return false; \
+    }
+
+#define TEST(name) \
+    bool test_##name(); \
+    bool test_##name()
+
+using namespace ares;
+
+static const IsaLevel all_levels[] = {
+    IsaLevel::Scalar, IsaLevel::SSE42, IsaLevel::AVX2, IsaLevel::AVX512
+};
+
+static const PixelFormat all_formats[] = {
+    PixelFormat::RGBA_F32, PixelFormat::RGBA_U8, PixelFormat::RGB_U8,
+    PixelFormat::Planar_F32, PixelFormat::RGBA_F16
+};
+
+static const char* format_name(PixelFormat format) {
+    switch (format) {
+        case PixelFormat::RGBA_F32:   return "rgba-f32";
+        case PixelFormat::RGBA_U8:    return "rgba-u8";
+        case PixelFormat::RGB_U8:     return "rgb-u8";
+        case PixelFormat::Planar_F32: return "planar-f32";
+        case PixelFormat::RGBA_F16:   return "rgba-f16";
+    }
+    return "?";
+}
+
+// Includes out-of-range values so the 8-bit paths must saturate
+static std::vector<float> make_pixels(size_t pixels) {
+    std::vector<float> v(pixels * 4);
+    for (size_t i = 0; i < v.size(); ++i) {
+        v[i] = static_cast<float>((i * 7919) % 1201) / 1000.0f - 0.1f;
+    }
+    return v;
+}
+
+// Every byte of dst within `size` may differ by at most `tolerance`
+// (8-bit formats: FMA vs separate multiply-add rounding)
+static bool bytes_match(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b,
+                        PixelFormat format) {
+    if (format == PixelFormat::RGBA_U8 || format == PixelFormat::RGB_U8) {
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (std::abs(static_cast<int>(a[i]) - static_cast<int>(b[i])) > 1) {
+                return false;
+            }
+        }
+        return true;
+    }
+    return a == b;
+}
+
+TEST(all_levels_match_baseline) {
+    const size_t sizes[][2] = { { 1, 1 }, { 7, 1 }, { 13, 3 }, { 37, 5 }, { 1100, 1000 } };
+    const size_t guard = 64;
+    
+    IsaLevel original = active_isa_level();
+    for (IsaLevel level : all_levels) {
+        set_isa_level(level);
+        
+        for (const auto& sz : sizes) {
+            const size_t pixels = sz[0] * sz[1];
+            std::vector<float> src = make_pixels(pixels);
+            
+            for (PixelFormat format : all_formats) {
+                const size_t bytes = pixel_format_size(format, sz[0], sz[1]);
+                std::vector<uint8_t> expected(bytes);
+                std::vector<uint8_t> actual(bytes + guard, 0xA5);
+                
+                convert_from_rgba_f32_baseline(src.data(), expected.data(), format, sz[0], sz[1]);
+                convert_from_rgba_f32(src.data(), actual.data(), format, sz[0], sz[1]);
+                
+                // Nothing written past the end
+                for (size_t i = bytes; i < bytes + guard; ++i) {
+                    ASSERT_TRUE(actual[i] == 0xA5);
+                }
+                actual.resize(bytes);
+                ASSERT_TRUE(bytes_match(actual, expected, format));
+                
+                // Back to float: SIMD and reference agree exactly
+                std::vector<float> back_expected(pixels * 4);
+                std::vector<float> back_actual(pixels * 4 + guard, -7.0f);
+                convert_to_rgba_f32_baseline(expected.data(), format, back_expected.data(), sz[0], sz[1]);
+                convert_to_rgba_f32(expected.data(), format, back_actual.data(), sz[0], sz[1]);
+                for (size_t i = 0; i < pixels * 4; ++i) {
+                    ASSERT_TRUE(back_actual[i] == back_expected[i]);
+                }
+                for (size_t i = pixels * 4; i < back_actual.size(); ++i) {
+                    ASSERT_TRUE(back_actual[i] == -7.0f);
+                }
+            }
+        }
+        printf("  %-7s -> %s\n", isa_level_name(active_isa_level()), active_pixel_convert_kernel());
+    }
+    set_isa_level(original);
+    
+    printf("✓ Pixel conversions match the scalar reference at every ISA level\n");
+    return true;
+}
+
+TEST(round_trip_precision) {
+    const size_t width = 61;
+    const size_t height = 3;
+    const size_t pixels = width * height;
+    std::vector<float> src(pixels * 4);
+    for (size_t i = 0; i < src.size(); ++i) {
+        src[i] = static_cast<float>(i % 256) / 255.0f;
+    }
+    
+    for (PixelFormat format : all_formats) {
+        std::vector<uint8_t> packed(pixel_format_size(format, width, height));
+        std::vector<float> back(pixels * 4);
+        convert_from_rgba_f32(src.data(), packed.data(), format, width, height);
+        convert_to_rgba_f32(packed.data(), format, back.data(), width, height);
+        
+        // Half keeps 11 significant bits; 8-bit values are exact multiples of 1/255
+        const float tolerance = format == PixelFormat::RGBA_F16 ? 1e-3f : 1e-6f;
+        float max_diff = 0.0f;
+        for (size_t i = 0; i < pixels * 4; ++i) {
+            const float expected = (format == PixelFormat::RGB_U8 && i % 4 == 3) ? 1.0f : src[i];
+            max_diff = std::max(max_diff, std::abs(back[i] - expected));
+        }
+        ASSERT_TRUE(max_diff < tolerance);
+        printf("  %-10s max round-trip error %.2e\n", format_name(format), max_diff);
+    }
+    
+    printf("✓ Pixel conversions round-trip within format precision\n");
+    return true;
+}
+
+TEST(saturation_and_half_special_values) {
+    // 8-bit: clamp below 0 and above 1, round to nearest
+    const float values[8] = { -1.0f, 0.0f, 0.5f / 255.0f, 0.1f, 0.5f, 1.0f, 1.5f, 1e9f };
+    const uint8_t expected_u8[8] = { 0, 0, 1, 26, 128, 255, 255, 255 };
+    std::vector<float> src(8 * 4);
+    for (size_t i = 0; i < 8; ++i) {
+        for (int c = 0; c < 4; ++c) {
+            src[i * 4 + c] = values[i];
+        }
+    }
+    std::vector<uint8_t> u8(8 * 4);
+    convert_from_rgba_f32(src.data(), u8.data(), PixelFormat::RGBA_U8, 8, 1);
+    for (size_t i = 0; i < 8; ++i) {
+        ASSERT_TRUE(u8[i * 4] == expected_u8[i]);
+    }
+    
+    // Half: exact encodings, overflow to infinity, subnormals, ties to even
+    const float hv[8] = { 1.0f, -2.0f, 65504.0f, 70000.0f,
+                          5.960464477539063e-08f, 0.0f, 1.0f + 1.0f / 2048.0f, -0.0f };
+    const uint16_t expected_half[8] = { 0x3C00, 0xC000, 0x7BFF, 0x7C00,
+                                        0x0001, 0x0000, 0x3C00, 0x8000 };
+    for (IsaLevel level : all_levels) {
+        IsaLevel saved = active_isa_level();
+        set_isa_level(level);
+        std::vector<uint16_t> half(8);
+        convert_from_rgba_f32(hv, half.data(), PixelFormat::RGBA_F16, 2, 1);
+        for (size_t i = 0; i < 8; ++i) {
+            ASSERT_TRUE(half[i] == expected_half[i]);
+        }
+        set_isa_level(saved);
+    }
+    
+    printf("✓ 8-bit saturation and half-precision special values\n");
+    return true;
+}
+
+int main() {
+    printf("=== ARES Pixel Format Tests ===\n\n");
+    
+    bool all_passed = true;
+    all_passed &= test_all_levels_match_baseline();
+    all_passed &= test_round_trip_precision();
+    all_passed &= test_saturation_and_half_special_values();
+    
+    printf("\n");
+    if (all_passed) {
+        printf("✓ All pixel format tests passed!\n");
+        return 0;
+    } else {
+        printf("✗ Some tests failed\n");
+        return 1;
+    }
+}
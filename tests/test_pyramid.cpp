@@ -0,0 +1,149 @@
+#include "ares/gaussian_pyramid.hpp"
+#include "ares/gaussian_blur.hpp"
+#include "ares/cpu_dispatch.hpp"
+#include "test_util.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        printf("FAILED: %s (line %d)\n", #cond, __LINE__); \
+        return false; \
+    }
+
+#define TEST(name) \
+    bool test_##name(); \
+    bool test_##name()
+
+using namespace ares;
+using namespace ares_test;
+
+// Reference: full-resolution blur, then keep the even rows and columns
+static Image blur_then_decimate(const Image& src, float sigma, BorderMode border) {
+    Image blurred(src.width, src.height);
+    gaussian_blur_simd(src, blurred, sigma, border);
+    Image out((src.width + 1) / 2, (src.height + 1) / 2);
+    for (size_t y = 0; y < out.height; ++y) {
+        for (size_t x = 0; x < out.width; ++x) {
+            std::memcpy(out.data + (y * out.width + x) * 4,
+                        blurred.data + (2 * y * src.width + 2 * x) * 4, 4 * sizeof(float));
+        }
+    }
+    return out;
+}
+
+TEST(level_geometry) {
+    Image base = make_pattern(37, 20);
+    GaussianPyramid pyramid;
+    pyramid.build(base, 10);
+
+    // 37x20 -> 19x10 -> 10x5 -> 5x3 -> 3x2 -> 2x1 -> 1x1, then stops
+    ASSERT_TRUE(pyramid.levels() == 7);
+    ASSERT_TRUE(pyramid.level(0).data == base.data);
+    const size_t widths[] = { 37, 19, 10, 5, 3, 2, 1 };
+    const size_t heights[] = { 20, 10, 5, 3, 2, 1, 1 };
+    for (size_t n = 0; n < pyramid.levels(); ++n) {
+        ASSERT_TRUE(pyramid.level(n).width == widths[n] && pyramid.level(n).height == heights[n]);
+        ASSERT_TRUE(reinterpret_cast<uintptr_t>(pyramid.level(n).data) % 16 == 0);
+    }
+
+    pyramid.build(base, 3);
+    ASSERT_TRUE(pyramid.levels() == 3);
+    pyramid.build(base, 0);
+    ASSERT_TRUE(pyramid.levels() == 0);
+    pyramid.build(base, 3, 0.0f);
+    ASSERT_TRUE(pyramid.levels() == 0);
+    pyramid.build(base, 3, -1.0f);
+    ASSERT_TRUE(pyramid.levels() == 0);
+
+    printf("✓ Level sizes halve (rounding up), stop at 1x1, none for sigma <= 0\n");
+    return true;
+}
+
+TEST(matches_blur_then_downsample) {
+    const IsaLevel original = active_isa_level();
+    // Odd sizes, one above the threaded-level threshold
+    const size_t sizes[][2] = { { 203, 117 }, { 517, 301 } };
+    float worst = 0.0f;
+
+    for (IsaLevel isa : { IsaLevel::Scalar, IsaLevel::SSE42, IsaLevel::AVX2, IsaLevel::AVX512 }) {
+        set_isa_level(isa);
+        for (const auto& size : sizes) {
+            Image base = make_pattern(size[0], size[1]);
+            for (BorderMode border : { BorderMode::Clamp, BorderMode::Mirror,
+                                       BorderMode::Wrap, BorderMode::Constant }) {
+                for (float sigma : { 1.0f, 1.6f }) {
+                    GaussianPyramid pyramid;
+                    pyramid.build(base, 5, sigma, border);
+                    ASSERT_TRUE(pyramid.levels() == 5);
+
+                    // Compare each level against the reference built from
+                    // the previous pyramid level
+                    for (size_t n = 1; n < pyramid.levels(); ++n) {
+                        const PyramidLevel& prev = pyramid.level(n - 1);
+                        Image src(prev.width, prev.height);
+                        std::memcpy(src.data, prev.data, prev.size_bytes());
+                        Image reference = blur_then_decimate(src, sigma, border);
+                        ASSERT_TRUE(pyramid.level(n).width == reference.width);
+                        ASSERT_TRUE(pyramid.level(n).height == reference.height);
+                        const float diff = max_difference(pyramid.level(n).data, reference.data,
+                                                          reference.width * reference.height * 4);
+                        ASSERT_TRUE(diff < 1e-5f);
+                        worst = std::max(worst, diff);
+                    }
+                }
+            }
+        }
+    }
+
+    set_isa_level(original);
+    printf("✓ Fused levels match blur-then-downsample at every ISA level (max diff %.2e)\n", worst);
+    return true;
+}
+
+TEST(arena_reused) {
+    Image large = make_pattern(640, 480);
+    Image small = make_pattern(320, 240);
+    GaussianPyramid pyramid;
+
+    pyramid.build(large, 6);
+    const size_t bytes = pyramid.arena_bytes();
+    const float* level1 = pyramid.level(1).data;
+    ASSERT_TRUE(bytes > 0);
+
+    // Same size again and a smaller frame: no reallocation
+    pyramid.build(large, 6);
+    ASSERT_TRUE(pyramid.arena_bytes() == bytes && pyramid.level(1).data == level1);
+    pyramid.build(small, 6);
+    ASSERT_TRUE(pyramid.arena_bytes() == bytes && pyramid.level(1).data == level1);
+
+    // Moving hands the arena over
+    GaussianPyramid moved = std::move(pyramid);
+    ASSERT_TRUE(moved.arena_bytes() == bytes && moved.levels() == 6);
+    ASSERT_TRUE(pyramid.arena_bytes() == 0);
+
+    printf("✓ Arena kept across builds (%zu KB for 640x480, 6 levels)\n", bytes >> 10);
+    return true;
+}
+
+int main() {
+    printf("=== ARES Gaussian Pyramid Tests ===\n\n");
+
+    bool all_passed = true;
+    all_passed &= test_level_geometry();
+    all_passed &= test_matches_blur_then_downsample();
+    all_passed &= test_arena_reused();
+
+    printf("\n");
+    if (all_passed) {
+        printf("✓ All pyramid tests passed!\n");
+        return 0;
+    } else {
+        printf("✗ Some tests failed\n");
+        return 1;
+    }
+}
@@ -0,0 +1,155 @@
+#include "ares/gaussian_scale_space.hpp"
+#include "ares/gaussian_blur.hpp"
+#include "ares/cpu_dispatch.hpp"
+#include "ares/tile_tuning.hpp"
+#include "test_util.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        printf("FAILED: %s (line %d)\n", #cond, __LINE__); \
+        return false; \
+    }
+
+#define TEST(name) \
+    bool test_##name(); \
+    bool test_##name()
+
+using namespace ares;
+using namespace ares_test;
+
+// Owns `count` images and exposes them as the span the API takes
+struct ImageStack {
+    std::vector<std::unique_ptr<Image>> images;
+    std::vector<Image*> pointers;
+
+    ImageStack(size_t count, size_t width, size_t height) {
+        for (size_t i = 0; i < count; ++i) {
+            images.push_back(std::make_unique<Image>(width, height));
+            pointers.push_back(images.back().get());
+        }
+    }
+};
+
+// Scale-space octave: sigma0 * 2^(i/3)
+static const float sigmas[] = { 1.0f, 1.26f, 1.59f, 2.0f, 2.52f };
+
+TEST(multi_matches_separate_blurs) {
+    const IsaLevel original = active_isa_level();
+    float worst = 0.0f;
+
+    for (IsaLevel isa : { IsaLevel::Scalar, IsaLevel::SSE42, IsaLevel::AVX2, IsaLevel::AVX512 }) {
+        set_isa_level(isa);
+        for (BorderMode border : { BorderMode::Clamp, BorderMode::Mirror,
+                                   BorderMode::Wrap, BorderMode::Constant }) {
+            Image input = make_pattern(203, 117);
+            ImageStack stack(std::size(sigmas), 203, 117);
+            gaussian_blur_multi(input, stack.pointers, sigmas, border);
+
+            Image reference(203, 117);
+            for (size_t i = 0; i < std::size(sigmas); ++i) {
+                gaussian_blur_tiled(input, reference, sigmas[i], border);
+                const float diff = max_difference(*stack.images[i], reference);
+                ASSERT_TRUE(diff < 1e-6f);
+                worst = std::max(worst, diff);
+            }
+        }
+    }
+
+    // A small L2 share forces many narrow strips
+    set_isa_level(original);
+    TilePolicy narrow;
+    narrow.l2_fraction = 0.01f;
+    set_tile_policy(narrow);
+    {
+        Image input = make_pattern(203, 117);
+        ImageStack stack(std::size(sigmas), 203, 117);
+        gaussian_blur_multi(input, stack.pointers, sigmas, BorderMode::Mirror);
+        Image reference(203, 117);
+        for (size_t i = 0; i < std::size(sigmas); ++i) {
+            gaussian_blur_tiled(input, reference, sigmas[i], BorderMode::Mirror);
+            ASSERT_TRUE(max_difference(*stack.images[i], reference) < 1e-6f);
+        }
+    }
+    set_tile_policy(TilePolicy{});
+
+    printf("✓ Multi-sigma blur matches separate tiled blurs (max diff %.2e)\n", worst);
+    return true;
+}
+
+TEST(dog_matches_differences) {
+    const IsaLevel original = active_isa_level();
+    float worst = 0.0f;
+
+    for (IsaLevel isa : { IsaLevel::Scalar, IsaLevel::AVX2, IsaLevel::AVX512 }) {
+        set_isa_level(isa);
+        for (BorderMode border : { BorderMode::Clamp, BorderMode::Constant }) {
+            // Tall enough for several bands
+            Image input = make_pattern(157, 613);
+            ImageStack dog(std::size(sigmas) - 1, 157, 613);
+            difference_of_gaussians(input, dog.pointers, sigmas, border);
+
+            Image lower(157, 613), upper(157, 613);
+            for (size_t i = 0; i + 1 < std::size(sigmas); ++i) {
+                gaussian_blur_tiled(input, lower, sigmas[i], border);
+                gaussian_blur_tiled(input, upper, sigmas[i + 1], border);
+                for (size_t p = 0; p < upper.width * upper.height * 4; ++p) {
+                    upper.data[p] -= lower.data[p];
+                }
+                const float diff = max_difference(*dog.images[i], upper);
+                ASSERT_TRUE(diff < 1e-6f);
+                worst = std::max(worst, diff);
+            }
+        }
+    }
+
+    set_isa_level(original);
+    printf("✓ Difference-of-Gaussians matches differenced blurs (max diff %.2e)\n", worst);
+    return true;
+}
+
+TEST(invalid_arguments_write_nothing) {
+    Image input = make_pattern(64, 48);
+    ImageStack stack(3, 64, 48);
+    Image wrong(32, 48);
+
+    // Count mismatch
+    gaussian_blur_multi(input, stack.pointers, std::span<const float>(sigmas, 2));
+    difference_of_gaussians(input, stack.pointers, std::span<const float>(sigmas, 3));
+    // Size mismatch
+    stack.pointers[1] = &wrong;
+    gaussian_blur_multi(input, stack.pointers, std::span<const float>(sigmas, 3));
+    difference_of_gaussians(input, std::span<Image* const>(stack.pointers.data(), 2),
+                            std::span<const float>(sigmas, 3));
+
+    for (const auto& image : stack.images) {
+        for (size_t i = 0; i < image->width * image->height * 4; ++i) {
+            ASSERT_TRUE(image->data[i] == 0.0f);
+        }
+    }
+
+    printf("✓ Mismatched counts or sizes leave the outputs untouched\n");
+    return true;
+}
+
+int main() {
+    printf("=== ARES Scale Space Tests ===\n\n");
+
+    bool all_passed = true;
+    all_passed &= test_multi_matches_separate_blurs();
+    all_passed &= test_dog_matches_differences();
+    all_passed &= test_invalid_arguments_write_nothing();
+
+    printf("\n");
+    if (all_passed) {
+        printf("✓ All scale space tests passed!\n");
+        return 0;
+    } else {
+        printf("✗ Some tests failed\n");
+        return 1;
+    }
+}
@@ -0,0 +1,368 @@
+#include "ares/separable_filter.hpp"
+#include "ares/gaussian_blur.hpp"
+#include "ares/cpu_dispatch.hpp"
+#include "test_util.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        printf("FAILED: %s (line %d)\n", #cond, __LINE__); \
+        return false; \
+    }
+
+#define TEST(name) \
+    bool test_##name(); \
+    bool test_##name()
+
+using namespace ares;
+using namespace ares_test;
+
+// Deterministic taps in [-1, 1)
+static std::vector<float> random_taps(size_t n, unsigned int seed) {
+    std::vector<float> taps(n);
+    for (float& t : taps) {
+        seed = seed * 1664525u + 1013904223u;
+        t = static_cast<float>(seed >> 8) / static_cast<float>(1u << 23) - 1.0f;
+    }
+    return taps;
+}
+
+static std::vector<float> symmetric_taps(size_t n, unsigned int seed) {
+    std::vector<float> taps = random_taps(n, seed);
+    for (size_t k = 0; k < n / 2; ++k) {
+        taps[n - 1 - k] = taps[k];
+    }
+    return taps;
+}
+
+static std::vector<float> antisymmetric_taps(size_t n, unsigned int seed) {
+    std::vector<float> taps = random_taps(n, seed);
+    for (size_t k = 0; k < n / 2; ++k) {
+        taps[n - 1 - k] = -taps[k];
+    }
+    taps[n / 2] = 0.0f;
+    return taps;
+}
+
+// Border mapping as documented on BorderMode; -1 means zero
+static int reference_index(BorderMode border, int i, int n) {
+    if (i >= 0 && i < n) {
+        return i;
+    }
+    switch (border) {
+        case BorderMode::Clamp:
+            return i < 0 ? 0 : n - 1;
+        case BorderMode::Mirror: {
+            if (n == 1) {
+                return 0;
+            }
+            const int period = 2 * n - 2;
+            int m = ((i % period) + period) % period;
+            return m < n ? m : period - m;
+        }
+        case BorderMode::Wrap:
+            return ((i % n) + n) % n;
+        case BorderMode::Constant:
+            break;
+    }
+    return -1;
+}
+
+// Two-pass correlation in double precision over pixels of `channels` floats
+static std::vector<float> reference_filter(
+    const float* src,
+    size_t width,
+    size_t height,
+    int channels,
+    const std::vector<float>& horizontal,
+    const std::vector<float>& vertical,
+    BorderMode border
+) {
+    const int w = static_cast<int>(width);
+    const int h = static_cast<int>(height);
+    const int hr = static_cast<int>(horizontal.size() / 2);
+    const int vr = static_cast<int>(vertical.size() / 2);
+    std::vector<double> temp(width * height * channels);
+    std::vector<float> out(width * height * channels);
+
+    for (int y = 0; y < h; ++y) {
+        for (int x = 0; x < w; ++x) {
+            for (int c = 0; c < channels; ++c) {
+                double sum = 0.0;
+                for (int k = -hr; k <= hr; ++k) {
+                    const int sx = reference_index(border, x + k, w);
+                    if (sx >= 0) {
+                        sum += horizontal[k + hr] * src[(y * w + sx) * channels + c];
+                    }
+                }
+                temp[(y * w + x) * channels + c] = sum;
+            }
+        }
+    }
+    for (int y = 0; y < h; ++y) {
+        for (int x = 0; x < w; ++x) {
+            for (int c = 0; c < channels; ++c) {
+                double sum = 0.0;
+                for (int k = -vr; k <= vr; ++k) {
+                    const int sy = reference_index(border, y + k, h);
+                    if (sy >= 0) {
+                        sum += vertical[k + vr] * temp[(sy * w + x) * channels + c];
+                    }
+                }
+                out[(y * w + x) * channels + c] = static_cast<float>(sum);
+            }
+        }
+    }
+    return out;
+}
+
+TEST(symmetry_detection) {
+    ASSERT_TRUE(SeparableFilter::gaussian(1.5f).horizontal_symmetry() == TapSymmetry::Even);
+    ASSERT_TRUE(SeparableFilter::gaussian(1.5f).horizontal_radius() == 5);
+    ASSERT_TRUE(SeparableFilter::box(2).vertical_symmetry() == TapSymmetry::Even);
+    ASSERT_TRUE(SeparableFilter::box(2).vertical().size() == 5);
+
+    const SeparableFilter sobel = SeparableFilter::sobel_x();
+    ASSERT_TRUE(sobel.horizontal_symmetry() == TapSymmetry::Odd);
+    ASSERT_TRUE(sobel.vertical_symmetry() == TapSymmetry::Even);
+    ASSERT_TRUE(SeparableFilter::scharr_y().vertical_symmetry() == TapSymmetry::Odd);
+
+    const std::vector<float> taps = random_taps(7, 1);
+    const SeparableFilter custom(taps, antisymmetric_taps(9, 2));
+    ASSERT_TRUE(custom.valid());
+    ASSERT_TRUE(custom.horizontal_symmetry() == TapSymmetry::None);
+    ASSERT_TRUE(custom.vertical_symmetry() == TapSymmetry::Odd);
+    ASSERT_TRUE(custom.horizontal_radius() == 3 && custom.vertical_radius() == 4);
+
+    // Even lengths and empty kernels are rejected
+    const std::vector<float> even(4, 0.25f);
+    ASSERT_TRUE(!SeparableFilter(even, taps).valid());
+    ASSERT_TRUE(!SeparableFilter(taps, std::span<const float>()).valid());
+    ASSERT_TRUE(!SeparableFilter().valid());
+
+    printf("✓ Tap symmetry detected; even-length kernels rejected\n");
+    return true;
+}
+
+TEST(matches_reference) {
+    const IsaLevel original = active_isa_level();
+
+    // Fixed (3, 5, 7) and runtime (1, 9, 11) tap counts, every symmetry,
+    // and different lengths per axis
+    struct Case {
+        std::vector<float> horizontal;
+        std::vector<float> vertical;
+    };
+    const Case cases[] = {
+        { random_taps(5, 10), random_taps(3, 11) },
+        { random_taps(9, 12), random_taps(7, 13) },
+        { symmetric_taps(7, 14), symmetric_taps(11, 15) },
+        { antisymmetric_taps(5, 16), symmetric_taps(3, 17) },
+        { symmetric_taps(3, 18), antisymmetric_taps(9, 19) },
+        { random_taps(1, 20), random_taps(11, 21) },
+    };
+    // Odd widths leave partial vectors in every layout
+    const size_t width = 53;
+    const size_t height = 29;
+    Image input = make_pattern(width, height);
+    Image output(width, height);
+    std::vector<float> plane_in(width * height);
+    std::vector<float> plane_out(width * height);
+    for (size_t i = 0; i < plane_in.size(); ++i) {
+        plane_in[i] = input.data[i * 4 + 1];
+    }
+    float worst = 0.0f;
+
+    for (IsaLevel isa : { IsaLevel::Scalar, IsaLevel::SSE42, IsaLevel::AVX2, IsaLevel::AVX512 }) {
+        set_isa_level(isa);
+        for (const Case& c : cases) {
+            const SeparableFilter filter(c.horizontal, c.vertical);
+            ASSERT_TRUE(filter.valid());
+            for (BorderMode border : { BorderMode::Clamp, BorderMode::Mirror,
+                                       BorderMode::Wrap, BorderMode::Constant }) {
+                const std::vector<float> rgba = reference_filter(
+                    input.data, width, height, 4, c.horizontal, c.vertical, border);
+                const size_t floats = width * height * 4;
+
+                separable_filter_simd(input, output, filter, border);
+                float diff = max_difference(output.data, rgba.data(), floats);
+                ASSERT_TRUE(diff < 1e-4f);
+                worst = std::max(worst, diff);
+
+                separable_filter_tiled(input, output, filter, border);
+                diff = max_difference(output.data, rgba.data(), floats);
+                ASSERT_TRUE(diff < 1e-4f);
+                worst = std::max(worst, diff);
+
+                separable_filter_multithreaded(input, output, filter, border);
+                diff = max_difference(output.data, rgba.data(), floats);
+                ASSERT_TRUE(diff < 1e-4f);
+                worst = std::max(worst, diff);
+
+                separable_filter_transposed(input, output, filter, border);
+                diff = max_difference(output.data, rgba.data(), floats);
+                ASSERT_TRUE(diff < 1e-4f);
+                worst = std::max(worst, diff);
+
+                const std::vector<float> plane = reference_filter(
+                    plane_in.data(), width, height, 1, c.horizontal, c.vertical, border);
+                separable_filter_plane(plane_in.data(), plane_out.data(), width, height, filter, border);
+                diff = max_difference(plane_out.data(), plane.data(), plane.size());
+                ASSERT_TRUE(diff < 1e-4f);
+                worst = std::max(worst, diff);
+            }
+        }
+    }
+
+    set_isa_level(original);
+    printf("✓ Engine matches a double-precision reference at every ISA level (max diff %.2e)\n", worst);
+    return true;
+}
+
+TEST(derivative_values) {
+    // Horizontal ramp: every channel equals x
+    const size_t width = 24;
+    const size_t height = 9;
+    Image ramp(width, height);
+    for (size_t y = 0; y < height; ++y) {
+        for (size_t x = 0; x < width; ++x) {
+            for (int c = 0; c < 4; ++c) {
+                ramp.data[(y * width + x) * 4 + c] = static_cast<float>(x);
+            }
+        }
+    }
+    Image gx(width, height);
+    Image gy(width, height);
+    Image sx(width, height);
+    separable_filter_simd(ramp, gx, SeparableFilter::sobel_x());
+    separable_filter_simd(ramp, gy, SeparableFilter::sobel_y());
+    separable_filter_simd(ramp, sx, SeparableFilter::scharr_x());
+
+    // Interior columns: slope 2 across, weights 4 (Sobel) / 16 (Scharr) along
+    for (size_t y = 0; y < height; ++y) {
+        for (size_t x = 1; x + 1 < width; ++x) {
+            const size_t i = (y * width + x) * 4;
+            ASSERT_TRUE(gx.data[i] == 8.0f);
+            ASSERT_TRUE(gy.data[i] == 0.0f);
+            ASSERT_TRUE(sx.data[i + 3] == 32.0f);
+        }
+    }
+
+    // Box of a constant image is the constant
+    Image flat(width, height);
+    std::fill(flat.data, flat.data + width * height * 4, 0.5f);
+    Image boxed(width, height);
+    separable_filter_tiled(flat, boxed, SeparableFilter::box(3), BorderMode::Mirror);
+    ASSERT_TRUE(max_difference(boxed.data, flat.data, width * height * 4) < 1e-6f);
+
+    printf("✓ Sobel, Scharr and box filters give their textbook responses\n");
+    return true;
+}
+
+TEST(gaussian_front_ends_use_engine) {
+    Image input = make_pattern(97, 61);
+    Image expected(97, 61);
+    Image actual(97, 61);
+
+    for (float sigma : { 0.6f, 1.0f, 2.5f }) {
+        const SeparableFilter filter = SeparableFilter::gaussian(sigma);
+        const size_t bytes = input.size_bytes();
+
+        separable_filter_simd(input, expected, filter, BorderMode::Wrap);
+        gaussian_blur_simd(input, actual, sigma, BorderMode::Wrap);
+        ASSERT_TRUE(std::memcmp(expected.data, actual.data, bytes) == 0);
+
+        separable_filter_tiled(input, expected, filter, BorderMode::Wrap);
+        gaussian_blur_tiled(input, actual, sigma, BorderMode::Wrap);
+        ASSERT_TRUE(std::memcmp(expected.data, actual.data, bytes) == 0);
+
+        separable_filter_multithreaded(input, expected, filter, BorderMode::Wrap);
+        gaussian_blur_multithreaded(input, actual, sigma, BorderMode::Wrap);
+        ASSERT_TRUE(std::memcmp(expected.data, actual.data, bytes) == 0);
+
+        separable_filter_transposed(input, expected, filter, BorderMode::Wrap);
+        gaussian_blur_transposed(input, actual, sigma, BorderMode::Wrap);
+        ASSERT_TRUE(std::memcmp(expected.data, actual.data, bytes) == 0);
+    }
+
+    printf("✓ Gaussian front-ends are bitwise identical to the engine\n");
+    return true;
+}
+
+TEST(transposed_matches_tiled) {
+    const IsaLevel original = active_isa_level();
+
+    // Several tiles across and down, sizes that are not a multiple of the
+    // transpose blocks, and a kernel taller than the image
+    const struct {
+        size_t width;
+        size_t height;
+        float sigma;
+    } cases[] = {
+        { 150, 37, 1.0f },
+        { 1100, 300, 3.0f },
+        { 70, 5, 4.0f },
+    };
+
+    for (IsaLevel isa : { IsaLevel::Scalar, IsaLevel::SSE42, IsaLevel::AVX2, IsaLevel::AVX512 }) {
+        set_isa_level(isa);
+        for (const auto& c : cases) {
+            Image input = make_pattern(c.width, c.height);
+            Image expected(c.width, c.height);
+            Image actual(c.width, c.height);
+            for (BorderMode border : { BorderMode::Clamp, BorderMode::Mirror,
+                                       BorderMode::Wrap, BorderMode::Constant }) {
+                gaussian_blur_tiled(input, expected, c.sigma, border);
+                gaussian_blur_transposed(input, actual, c.sigma, border);
+                ASSERT_TRUE(std::memcmp(actual.data, expected.data, input.size_bytes()) == 0);
+            }
+        }
+    }
+
+    set_isa_level(original);
+    printf("✓ Transposed vertical pass is bitwise identical to the tiled blur at every ISA level\n");
+    return true;
+}
+
+TEST(invalid_filter_writes_nothing) {
+    Image input = make_pattern(16, 8);
+    Image output(16, 8);
+    std::fill(output.data, output.data + 16 * 8 * 4, 7.0f);
+
+    const SeparableFilter empty;
+    separable_filter_simd(input, output, empty);
+    separable_filter_tiled(input, output, empty);
+    separable_filter_multithreaded(input, output, empty);
+    separable_filter_transposed(input, output, empty);
+    for (size_t i = 0; i < 16 * 8 * 4; ++i) {
+        ASSERT_TRUE(output.data[i] == 7.0f);
+    }
+
+    printf("✓ Invalid filters leave the output untouched\n");
+    return true;
+}
+
+int main() {
+    printf("=== ARES Separable Filter Tests ===\n\n");
+
+    bool all_passed = true;
+    all_passed &= test_symmetry_detection();
+    all_passed &= test_matches_reference();
+    all_passed &= test_derivative_values();
+    all_passed &= test_gaussian_front_ends_use_engine();
+    all_passed &= test_transposed_matches_tiled();
+    all_passed &= test_invalid_filter_writes_nothing();
+
+    printf("\n");
+    if (all_passed) {
+        printf("✓ All separable filter tests passed!\n");
+        return 0;
+    } else {
+        printf("✗ Some tests failed\n");
+        return 1;
+    }
+}
@@ -0,0 +1,134 @@
+#include "ares/gaussian_sharpen.hpp"
+#include "ares/gaussian_blur.hpp"
+#include "ares/cpu_dispatch.hpp"
+#include "test_util.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        printf("FAILED: %s (line %d)\n", #cond, __LINE__); \
+        return false; \
+    }
+
+#define TEST(name) \
+    bool test_##name(); \
+    bool test_##name()
+
+using namespace ares;
+using namespace ares_test;
+
+// Blur, subtract, scale and clamp as separate passes
+static void reference_unsharp(const Image& input, Image& output, float sigma, float amount,
+                              float threshold, BorderMode border) {
+    Image blurred(input.width, input.height);
+    gaussian_blur_tiled(input, blurred, sigma, border);
+    for (size_t i = 0; i < input.width * input.height * 4; ++i) {
+        const float s = input.data[i];
+        const float detail = s - blurred.data[i];
+        const bool sharpen = i % 4 != 3 && std::fabs(detail) >= threshold;
+        output.data[i] = std::clamp(sharpen ? s + amount * detail : s, 0.0f, 1.0f);
+    }
+}
+
+TEST(matches_blur_then_mask) {
+    // 67 pixels: rows end mid-vector at every width
+    const BorderMode borders[] = { BorderMode::Clamp, BorderMode::Mirror, BorderMode::Wrap, BorderMode::Constant };
+    const float sigmas[] = { 0.6f, 1.0f, 3.0f };  // 5 and 7 unrolled taps, runtime taps
+    Image img = make_pattern(67, 45);
+    Image expected(67, 45);
+    Image output(67, 45);
+
+    const IsaLevel original = active_isa_level();
+    float worst = 0.0f;
+    for (IsaLevel isa : { IsaLevel::Scalar, IsaLevel::SSE42, IsaLevel::AVX2, IsaLevel::AVX512 }) {
+        set_isa_level(isa);
+        for (BorderMode border : borders) {
+            for (float sigma : sigmas) {
+                reference_unsharp(img, expected, sigma, 1.5f, 0.05f, border);
+                unsharp_mask(img, output, sigma, 1.5f, 0.05f, border);
+                worst = std::max(worst, max_difference(output, expected));
+            }
+        }
+    }
+    set_isa_level(original);
+    ASSERT_TRUE(worst < 1e-5f);
+
+    printf("✓ unsharp_mask() matches blur + subtract + scale + clamp on every ISA level (max diff %.2e)\n", worst);
+    return true;
+}
+
+TEST(threshold_amount_and_alpha) {
+    Image img = make_pattern(40, 30);
+    Image output(40, 30);
+    const size_t bytes = 40 * 30 * 4 * sizeof(float);
+
+    // Nothing reaches the threshold, or there is no gain: exact copies
+    unsharp_mask(img, output, 2.0f, 3.0f, 2.0f);
+    ASSERT_TRUE(std::memcmp(output.data, img.data, bytes) == 0);
+    unsharp_mask(img, output, 2.0f, 0.0f, 0.0f);
+    ASSERT_TRUE(std::memcmp(output.data, img.data, bytes) == 0);
+
+    // Strong sharpening moves colour but never alpha, and stays in [0, 1]
+    unsharp_mask(img, output, 2.0f, 4.0f, 0.0f);
+    size_t changed = 0;
+    for (size_t i = 0; i < 40 * 30 * 4; ++i) {
+        ASSERT_TRUE(output.data[i] >= 0.0f && output.data[i] <= 1.0f);
+        if (i % 4 == 3) {
+            ASSERT_TRUE(output.data[i] == img.data[i]);
+        } else {
+            changed += output.data[i] != img.data[i];
+        }
+    }
+    ASSERT_TRUE(changed > 40 * 30);
+
+    printf("✓ Threshold and zero amount copy the input; alpha is never sharpened\n");
+    return true;
+}
+
+TEST(edge_contrast) {
+    // Vertical step from 0.25 to 0.75: sharpening darkens the dark side
+    // and brightens the bright side next to the edge, flat areas stay put
+    Image img(32, 8);
+    for (size_t y = 0; y < 8; ++y) {
+        for (size_t x = 0; x < 32; ++x) {
+            for (int c = 0; c < 4; ++c) {
+                img.data[(y * 32 + x) * 4 + c] = x < 16 ? 0.25f : 0.75f;
+            }
+        }
+    }
+    Image output(32, 8);
+    unsharp_mask(img, output, 1.0f, 1.0f, 0.0f);
+    const float* row = output.data + 4 * 32 * 4;
+    ASSERT_TRUE(row[15 * 4] < 0.2f && row[16 * 4] > 0.8f);
+    ASSERT_TRUE(std::fabs(row[2 * 4] - 0.25f) < 1e-6f && std::fabs(row[29 * 4] - 0.75f) < 1e-6f);
+
+    // Mismatched sizes write nothing
+    Image wrong(31, 8);
+    wrong.data[0] = 0.5f;
+    unsharp_mask(img, wrong, 1.0f);
+    ASSERT_TRUE(wrong.data[0] == 0.5f);
+
+    printf("✓ A step edge gains contrast on both sides; flat regions are untouched\n");
+    return true;
+}
+
+int main() {
+    printf("=== ARES Sharpen Tests ===\n\n");
+
+    bool all_passed = true;
+    all_passed &= test_matches_blur_then_mask();
+    all_passed &= test_threshold_amount_and_alpha();
+    all_passed &= test_edge_contrast();
+
+    printf("\n");
+    if (all_passed) {
+        printf("✓ All sharpen tests passed!\n");
+        return 0;
+    } else {
+        printf("✗ Some tests failed\n");
+        return 1;
+    }
+}
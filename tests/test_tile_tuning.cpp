@@ -0,0 +1,274 @@
+#include "ares/tile_tuning.hpp"
+#include "ares/gaussian_blur.hpp"
+#include "ares/cpu_dispatch.hpp"
+#include "test_util.hpp"
+#include <cstdio>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <span>
+#include <string>
+#include <vector>
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        printf("FAILED: %s (line %d)\n", #cond, __LINE__); \
+        return false; \
+    }
+
+#define TEST(name) \
+    bool test_##name(); \
+    bool test_##name()
+
+using namespace ares;
+using namespace ares_test;
+
+TEST(cache_detection) {
+    const CacheInfo& c = cache_info();
+    ASSERT_TRUE(c.l1d_bytes >= 8 * 1024);
+    ASSERT_TRUE(c.l2_bytes >= c.l1d_bytes);
+    ASSERT_TRUE(c.line_bytes >= 32 && (c.line_bytes & (c.line_bytes - 1)) == 0);
+    ASSERT_TRUE(std::strcmp(c.source, "sysfs") == 0 || std::strcmp(c.source, "cpuid") == 0 ||
+                std::strcmp(c.source, "default") == 0);
+
+    printf("✓ Cache sizes detected (%s: L1d %zu KB, L2 %zu KB, line %zu B)\n",
+           c.source, c.l1d_bytes >> 10, c.l2_bytes >> 10, c.line_bytes);
+    return true;
+}
+
+TEST(tile_config_follows_caches) {
+    set_tile_policy(TilePolicy{});
+    const CacheInfo& c = cache_info();
+    const size_t line_pixels = c.line_bytes / 16;
+
+    size_t previous_width = SIZE_MAX;
+    for (int radius : { 1, 3, 6, 12, 24 }) {
+        TileConfig t = gaussian_tile_config(radius, 3840);
+        // Whole cache lines, kernel window within half of L1
+        ASSERT_TRUE(t.width >= line_pixels && t.width % line_pixels == 0);
+        ASSERT_TRUE(t.width == line_pixels || (2 * radius + 1) * t.width * 16 <= c.l1d_bytes / 2);
+        ASSERT_TRUE(t.height >= 8 && t.height <= 512);
+        ASSERT_TRUE(t.prefetch_rows == TilePolicy{}.prefetch_rows);
+        // Wider kernels get narrower tiles
+        ASSERT_TRUE(t.width <= previous_width);
+        previous_width = t.width;
+    }
+
+    // Narrow regions: no wider than the region, taller bands
+    TileConfig narrow = gaussian_tile_config(6, 20);
+    TileConfig wide = gaussian_tile_config(6, 3840);
+    ASSERT_TRUE(narrow.width <= (20 + line_pixels - 1) / line_pixels * line_pixels);
+    ASSERT_TRUE(narrow.height >= wide.height);
+
+    // A larger L1 share widens the tile
+    TilePolicy big;
+    big.l1_fraction = 1.0f;
+    set_tile_policy(big);
+    ASSERT_TRUE(gaussian_tile_config(6, 3840).width >= wide.width);
+
+    // Fixed sizes bypass the model
+    TilePolicy fixed;
+    fixed.fixed_width = 32;
+    fixed.fixed_height = 32;
+    fixed.prefetch_rows = 0;
+    set_tile_policy(fixed);
+    TileConfig f = gaussian_tile_config(6, 3840);
+    ASSERT_TRUE(f.width == 32 && f.height == 32 && f.prefetch_rows == 0);
+
+    // Invalid policies are ignored
+    TilePolicy invalid;
+    invalid.l1_fraction = 0.0f;
+    set_tile_policy(invalid);
+    ASSERT_TRUE(tile_policy().fixed_width == 32);
+
+    set_tile_policy(TilePolicy{});
+    printf("✓ Tile geometry follows radius, region width and cache sizes\n");
+    return true;
+}
+
+TEST(tiled_output_independent_of_tiles) {
+    Image input = make_pattern(203, 117);
+    Image reference(203, 117);
+    Image output(203, 117);
+
+    set_tile_policy(TilePolicy{});
+    gaussian_blur_tiled(input, reference, 2.5f);
+
+    std::vector<TilePolicy> policies;
+    TilePolicy p;
+    p.fixed_width = 4; p.fixed_height = 8; p.prefetch_rows = 0;
+    policies.push_back(p);
+    p.fixed_width = 7; p.fixed_height = 3; p.prefetch_rows = 1;
+    policies.push_back(p);
+    p.fixed_width = 32; p.fixed_height = 32; p.prefetch_rows = 2;
+    policies.push_back(p);
+    p = TilePolicy{};
+    p.l1_fraction = 0.25f; p.l2_fraction = 1.0f; p.prefetch_rows = 8;
+    policies.push_back(p);
+
+    const Rect rois[] = { { 0, 0, 50, 40 }, { 150, 90, 60, 40 }, { 70, 30, 64, 64 } };
+    Image roi_reference = make_pattern(203, 117);
+    gaussian_blur_rois(input, roi_reference, rois, 2.5f, BorderMode::Mirror);
+
+    for (const TilePolicy& policy : policies) {
+        set_tile_policy(policy);
+        gaussian_blur_tiled(input, output, 2.5f);
+        ASSERT_TRUE(same_pixels(output, reference));
+
+        Image roi_output = make_pattern(203, 117);
+        gaussian_blur_rois(input, roi_output, rois, 2.5f, BorderMode::Mirror);
+        ASSERT_TRUE(same_pixels(roi_output, roi_reference));
+    }
+
+    set_tile_policy(TilePolicy{});
+    printf("✓ Tiled and ROI output identical for every tile geometry\n");
+    return true;
+}
+
+TEST(policy_persistence) {
+    const std::string path = "test_tile_policy.txt";
+    TilePolicy saved;
+    saved.l1_fraction = 0.75f;
+    saved.l2_fraction = 0.25f;
+    saved.prefetch_rows = 4;
+    ASSERT_TRUE(save_tile_policy(path, saved));
+
+    TilePolicy loaded;
+    ASSERT_TRUE(load_tile_policy(path, loaded));
+    ASSERT_TRUE(loaded.l1_fraction == 0.75f && loaded.l2_fraction == 0.25f);
+    ASSERT_TRUE(loaded.prefetch_rows == 4 && loaded.fixed_width == 0);
+
+    // A policy tuned on different caches is rejected
+    {
+        std::ofstream file(path);
+        file << "l1d_bytes " << cache_info().l1d_bytes << "\n";
+        file << "l2_bytes " << cache_info().l2_bytes * 2 << "\n";
+        file << "l1_fraction 0.5\nl2_fraction 0.5\nprefetch_rows 2\n";
+    }
+    TilePolicy untouched = loaded;
+    ASSERT_TRUE(!load_tile_policy(path, untouched));
+    ASSERT_TRUE(untouched.prefetch_rows == 4);
+
+    // Missing keys and missing files
+    {
+        std::ofstream file(path);
+        file << "l1d_bytes " << cache_info().l1d_bytes << "\n";
+    }
+    ASSERT_TRUE(!load_tile_policy(path, untouched));
+    std::remove(path.c_str());
+    ASSERT_TRUE(!load_tile_policy(path, untouched));
+
+    printf("✓ Tile policy saved, reloaded, and rejected on other caches\n");
+    return true;
+}
+
+TEST(one_shot_tuner) {
+    const std::string path = "test_tile_tuner.txt";
+    std::remove(path.c_str());
+
+    TilePolicy tuned = tune_tile_policy(path);
+    TilePolicy active = tile_policy();
+    ASSERT_TRUE(active.l1_fraction == tuned.l1_fraction);
+    ASSERT_TRUE(active.l2_fraction == tuned.l2_fraction);
+    ASSERT_TRUE(active.prefetch_rows == tuned.prefetch_rows);
+
+    // Persisted, and the second call loads instead of measuring
+    TilePolicy from_file;
+    ASSERT_TRUE(load_tile_policy(path, from_file));
+    set_tile_policy(TilePolicy{});
+    TilePolicy again = tune_tile_policy(path);
+    ASSERT_TRUE(again.l1_fraction == tuned.l1_fraction);
+    ASSERT_TRUE(again.l2_fraction == tuned.l2_fraction);
+    ASSERT_TRUE(again.prefetch_rows == tuned.prefetch_rows);
+    ASSERT_TRUE(tile_policy().prefetch_rows == tuned.prefetch_rows);
+
+    std::remove(path.c_str());
+    set_tile_policy(TilePolicy{});
+    printf("✓ Tuner picks a policy (L1 %.2f, L2 %.2f, prefetch %d rows) and persists it\n",
+           tuned.l1_fraction, tuned.l2_fraction, tuned.prefetch_rows);
+    return true;
+}
+
+TEST(streaming_store_policy) {
+    const StreamingStores initial = streaming_stores();
+    const size_t threshold = streaming_store_threshold();
+    const CacheInfo& c = cache_info();
+    ASSERT_TRUE(threshold == (c.l3_bytes > 0 ? c.l3_bytes : c.l2_bytes));
+
+    set_streaming_stores(StreamingStores::Auto);
+    ASSERT_TRUE(!gaussian_streams_output(threshold));
+    ASSERT_TRUE(gaussian_streams_output(threshold + 1));
+    set_streaming_stores(StreamingStores::Always);
+    ASSERT_TRUE(gaussian_streams_output(16));
+    set_streaming_stores(StreamingStores::Never);
+    ASSERT_TRUE(!gaussian_streams_output(SIZE_MAX));
+
+    set_streaming_stores(initial);
+    printf("✓ Streaming stores past the LLC (%zu KB), overridable\n", threshold >> 10);
+    return true;
+}
+
+TEST(streaming_output_identical) {
+    const StreamingStores initial = streaming_stores();
+    const IsaLevel original = active_isa_level();
+    // Odd width: rows start at every alignment, exercising head and tail
+    Image input = make_pattern(203, 117);
+    Image reference(203, 117);
+    Image output(203, 117);
+    const Rect rois[] = { { 1, 3, 37, 20 }, { 150, 90, 53, 27 } };
+
+    for (IsaLevel level : { IsaLevel::Scalar, IsaLevel::SSE42, IsaLevel::AVX2, IsaLevel::AVX512 }) {
+        set_isa_level(level);
+        auto run_all = [&](Image& out, Image& roi_out, Image& batch_out) {
+            gaussian_blur_simd(input, out, 2.0f, BorderMode::Mirror);
+            Image tiled(203, 117), threaded(203, 117);
+            gaussian_blur_tiled(input, tiled, 2.0f, BorderMode::Mirror);
+            gaussian_blur_multithreaded(input, threaded, 2.0f, BorderMode::Mirror);
+            gaussian_blur_rois(input, roi_out, rois, 2.0f, BorderMode::Mirror);
+            const BlurJob job{ &input, &batch_out, 2.0f, BorderMode::Mirror };
+            gaussian_blur_batch(std::span<const BlurJob>(&job, 1));
+            return same_pixels(tiled, out) && same_pixels(threaded, out);
+        };
+
+        set_streaming_stores(StreamingStores::Never);
+        Image roi_reference = make_pattern(203, 117);
+        Image batch_reference(203, 117);
+        ASSERT_TRUE(run_all(reference, roi_reference, batch_reference));
+
+        set_streaming_stores(StreamingStores::Always);
+        Image roi_output = make_pattern(203, 117);
+        Image batch_output(203, 117);
+        ASSERT_TRUE(run_all(output, roi_output, batch_output));
+        ASSERT_TRUE(same_pixels(output, reference));
+        ASSERT_TRUE(same_pixels(roi_output, roi_reference));
+        ASSERT_TRUE(same_pixels(batch_output, batch_reference));
+    }
+
+    set_isa_level(original);
+    set_streaming_stores(initial);
+    printf("✓ Streaming and regular stores give identical output at every ISA level\n");
+    return true;
+}
+
+int main() {
+    printf("=== ARES Tile Tuning Tests ===\n\n");
+
+    bool all_passed = true;
+    all_passed &= test_cache_detection();
+    all_passed &= test_tile_config_follows_caches();
+    all_passed &= test_tiled_output_independent_of_tiles();
+    all_passed &= test_policy_persistence();
+    all_passed &= test_one_shot_tuner();
+    all_passed &= test_streaming_store_policy();
+    all_passed &= test_streaming_output_identical();
+
+    printf("\n");
+    if (all_passed) {
+        printf("✓ All tile tuning tests passed!\n");
+        return 0;
+    } else {
+        printf("✗ Some tests failed\n");
+        return 1;
+    }
+}
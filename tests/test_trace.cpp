@@ -0,0 +1,228 @@
+#include "ares/trace.hpp"
+#include "ares/aes.hpp"
+#include "ares/gaussian_blur.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        printf("FAILED: %s (line %d)\n", #cond, __LINE__); \
+        return false; \
+    }
+
+#define TEST(name) \
+    bool test_##name(); \
+    bool test_##name()
+
+using namespace ares;
+
+// The tests drive detail::TraceScope directly, so they exercise the
+// recorder whether or not ARES_TRACE_SCOPE is compiled in
+static std::vector<TraceEvent> named(const std::vector<TraceEvent>& events, const char* name) {
+    std::vector<TraceEvent> out;
+    for (const TraceEvent& e : events) {
+        if (std::strcmp(e.name, name) == 0) {
+            out.push_back(e);
+        }
+    }
+    return out;
+}
+
+TEST(idle_records_nothing) {
+    trace_start();
+    trace_stop();
+    {
+        detail::TraceScope scope("test.idle");
+    }
+    ASSERT_TRUE(named(trace_events(), "test.idle").empty());
+
+    // Resuming keeps what was recorded before the pause
+    trace_resume();
+    {
+        detail::TraceScope scope("test.resumed");
+    }
+    trace_stop();
+    trace_resume();
+    {
+        detail::TraceScope scope("test.resumed");
+    }
+    trace_stop();
+    ASSERT_TRUE(named(trace_events(), "test.resumed").size() == 2);
+
+    printf("✓ Scopes record nothing while tracing is stopped, resume keeps spans\n");
+    return true;
+}
+
+TEST(nested_scopes_per_thread) {
+    trace_start();
+    {
+        detail::TraceScope outer("test.outer");
+        {
+            detail::TraceScope inner("test.inner");
+        }
+    }
+    std::thread worker([] {
+        trace_thread_name("test worker");
+        detail::TraceScope scope("test.worker");
+    });
+    worker.join();
+    trace_stop();
+
+    std::vector<TraceEvent> events = trace_events();
+    std::vector<TraceEvent> outer = named(events, "test.outer");
+    std::vector<TraceEvent> inner = named(events, "test.inner");
+    std::vector<TraceEvent> other = named(events, "test.worker");
+    ASSERT_TRUE(outer.size() == 1 && inner.size() == 1 && other.size() == 1);
+
+    // Inner span lies within the outer one, on the same thread
+    ASSERT_TRUE(inner[0].thread == outer[0].thread);
+    ASSERT_TRUE(inner[0].start_ns >= outer[0].start_ns);
+    ASSERT_TRUE(inner[0].start_ns + inner[0].duration_ns <= outer[0].start_ns + outer[0].duration_ns);
+    ASSERT_TRUE(other[0].thread != outer[0].thread);
+
+    // Ordered by start time
+    for (size_t i = 1; i < events.size(); ++i) {
+        ASSERT_TRUE(events[i - 1].start_ns <= events[i].start_ns);
+    }
+
+    printf("✓ Nested scopes and threads recorded separately\n");
+    return true;
+}
+
+TEST(ring_buffer_wraps) {
+    trace_start(16);
+    for (int i = 0; i < 40; ++i) {
+        detail::TraceScope scope("test.wrap");
+    }
+    trace_stop();
+
+    ASSERT_TRUE(named(trace_events(), "test.wrap").size() == 16);
+    ASSERT_TRUE(trace_dropped_events() == 24);
+
+    // Restarting clears the buffers
+    trace_start();
+    trace_stop();
+    ASSERT_TRUE(trace_events().empty());
+    ASSERT_TRUE(trace_dropped_events() == 0);
+
+    printf("✓ Ring buffer keeps the newest spans and counts the dropped ones\n");
+    return true;
+}
+
+TEST(buffers_reused_across_threads) {
+    trace_start();
+    // Many short-lived threads, as gaussian_blur_multithreaded creates
+    for (int round = 0; round < 8; ++round) {
+        std::thread t([] { detail::TraceScope scope("test.short_lived"); });
+        t.join();
+    }
+    trace_stop();
+
+    std::vector<TraceEvent> events = named(trace_events(), "test.short_lived");
+    ASSERT_TRUE(events.size() == 8);
+    std::set<uint32_t> threads;
+    for (const TraceEvent& e : events) {
+        threads.insert(e.thread);
+    }
+    ASSERT_TRUE(threads.size() == 8);
+
+    printf("✓ Exited threads hand their buffer on, spans keep their thread id\n");
+    return true;
+}
+
+TEST(chrome_trace_export) {
+    trace_start();
+    std::thread worker([] {
+        trace_thread_name("export worker");
+        detail::TraceScope scope("test.\"quoted\"");
+    });
+    worker.join();
+    trace_stop();
+
+    const std::string json = chrome_trace_json();
+    ASSERT_TRUE(json.find("\"traceEvents\"") != std::string::npos);
+    ASSERT_TRUE(json.find("\"ph\":\"X\"") != std::string::npos);
+    ASSERT_TRUE(json.find("\"name\":\"test.\\\"quoted\\\"\"") != std::string::npos);
+    ASSERT_TRUE(json.find("\"args\":{\"name\":\"export worker\"}") != std::string::npos);
+    ASSERT_TRUE(json.find("\"dropped_events\":0") != std::string::npos);
+
+    const std::string path = "test_trace.json";
+    ASSERT_TRUE(write_chrome_trace(path));
+    std::ifstream file(path);
+    std::string written((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    ASSERT_TRUE(written == json);
+    file.close();
+    std::remove(path.c_str());
+
+    printf("✓ Chrome trace-event JSON exported\n");
+    return true;
+}
+
+TEST(library_phases) {
+    if (!tracing_compiled_in()) {
+        printf("✓ Library phases skipped (built without ARES_ENABLE_TRACING)\n");
+        return true;
+    }
+
+    Image input(96, 64);
+    Image output(96, 64);
+    std::vector<uint8_t> plain(64, 0x5a), cipher(64);
+    const uint8_t key[16] = {};
+
+    trace_start();
+    gaussian_blur_simd(input, output, 1.5f);
+    gaussian_blur_multithreaded(input, output, 1.5f);
+    gaussian_blur_tiled(input, output, 1.5f);
+    aes_encrypt_baseline(plain.data(), cipher.data(), key, 4);
+    trace_stop();
+
+    std::vector<TraceEvent> events = trace_events();
+    for (const char* name : { "gaussian_blur_simd", "gaussian_blur_multithreaded", "gaussian_blur_tiled",
+                              "blur.kernel", "image.alloc", "blur.temp_alloc", "blur.horizontal",
+                              "blur.vertical", "blur.join", "aes.expand_key", "aes.blocks" }) {
+        ASSERT_TRUE(!named(events, name).empty());
+    }
+
+    // One horizontal span per worker in the multithreaded blur, each
+    // inside the top-level call
+    TraceEvent mt = named(events, "gaussian_blur_multithreaded")[0];
+    size_t workers = 0;
+    for (const TraceEvent& e : named(events, "blur.horizontal")) {
+        if (e.start_ns >= mt.start_ns && e.start_ns + e.duration_ns <= mt.start_ns + mt.duration_ns) {
+            ASSERT_TRUE(e.thread != mt.thread);
+            ++workers;
+        }
+    }
+    unsigned int expected = std::thread::hardware_concurrency();
+    ASSERT_TRUE(workers == (expected == 0 ? 4 : expected));
+
+    printf("✓ Library phases recorded (%zu spans)\n", events.size());
+    return true;
+}
+
+int main() {
+    printf("=== ARES Trace Tests ===\n\n");
+
+    bool all_passed = true;
+    all_passed &= test_idle_records_nothing();
+    all_passed &= test_nested_scopes_per_thread();
+    all_passed &= test_ring_buffer_wraps();
+    all_passed &= test_buffers_reused_across_threads();
+    all_passed &= test_chrome_trace_export();
+    all_passed &= test_library_phases();
+
+    printf("\n");
+    if (all_passed) {
+        printf("✓ All trace tests passed!\n");
+        return 0;
+    } else {
+        printf("✗ Some tests failed\n");
+        return 1;
+    }
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+// Fixtures and comparisons shared by the test programs
+
+#include "ares/gaussian_blur.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+
+namespace ares_test {
+
+/**
+ * Deterministic RGBA image with values in [0, 1]. The 251-periodic
+ * sequence does not line up with rows, tiles or vector widths, so a
+ * misplaced tap or pixel shows up as a difference.
+ */
+inline ares::Image make_pattern(size_t width, size_t height) {
+    ares::Image img(width, height);
+    for (size_t i = 0; i < width * height * 4; ++i) {
+        img.data[i] = static_cast<float>((i * 37) % 251) / 250.0f;
+    }
+    return img;
+}
+
+/**
+ * Same dimensions and bitwise identical pixels
+ */
+inline bool same_pixels(const ares::Image& a, const ares::Image& b) {
+    return a.width == b.width && a.height == b.height &&
+           std::memcmp(a.data, b.data, a.size_bytes()) == 0;
+}
+
+/**
+ * Largest absolute difference between two float arrays
+ */
+inline float max_difference(const float* a, const float* b, size_t count) {
+    float max_diff = 0.0f;
+    for (size_t i = 0; i < count; ++i) {
+        max_diff = std::max(max_diff, std::fabs(a[i] - b[i]));
+    }
+    return max_diff;
+}
+
+/**
+ * Largest absolute difference over every channel of two same-sized images
+ */
+inline float max_difference(const ares::Image& a, const ares::Image& b) {
+    return max_difference(a.data, b.data, a.width * a.height * 4);
+}
+
+} // namespace ares_test
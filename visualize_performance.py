@@ -2,126 +2,245 @@
 """
 Performance Visualization Script for ARES Project
 Generates comparison charts from benchmark results
+
+Usage:
+    ./build/benchmarks/bench_aes --json=aes.json
+    ./build/benchmarks/bench_gaussian --json=gaussian.json
+    python3 visualize_performance.py aes.json gaussian.json [batch.csv ...]
+
+Accepts the --json and --csv output of any bench_* executable. Produces
+one chart per benchmark group (median time with p5-p95 range, speedup vs
+the "baseline" variant) in performance_charts.png, and the best speedup per
+group and size in speedup_summary.png. JSON from bench_roofline also gives
+roofline.png: achieved GFLOP/s against arithmetic intensity under the
+measured bandwidth roof and compute ceilings.
 """
 
+import csv
+import json
+import sys
+from collections import OrderedDict
+
 import matplotlib.pyplot as plt
 import numpy as np
 
-# AES Encryption Results (example data - replace with actual benchmark results)
-aes_data_sizes = ['4 KB', '64 KB', '1 MB', '10 MB']
-aes_baseline = [91, 917, 13356, 139358]  # microseconds
-aes_simd = [0.1, 0.1, 108, 2079]         # microseconds (very fast!)
-
-# Gaussian Blur Results
-blur_sizes = ['512²', '1024²', '2048²', '4K']
-blur_baseline = [41, 167, 633, 1388]     # milliseconds
-blur_simd = [59, 227, 983, 1567]         # milliseconds
-blur_tiled = [58, 238, 1077, 1465]       # milliseconds
-blur_multithreaded = [15, 60, 250, 450]  # milliseconds (estimated improvement)
-
-# Create figure with subplots
-fig, ((ax1, ax2), (ax3, ax4)) = plt.subplots(2, 2, figsize=(14, 10))
-fig.suptitle('ARES Project Performance Analysis', fontsize=16, fontweight='bold')
-
-# 1. AES Encryption Time Comparison
-x = np.arange(len(aes_data_sizes))
-width = 0.35
-
-ax1.bar(x - width/2, aes_baseline, width, label='Baseline', color='#3498db')
-ax1.bar(x + width/2, aes_simd, width, label='SIMD (AES-NI)', color='#2ecc71')
-ax1.set_ylabel('Time (μs, log scale)')
-ax1.set_title('AES-128 Encryption Performance')
-ax1.set_xticks(x)
-ax1.set_xticklabels(aes_data_sizes)
-ax1.legend()
-ax1.set_yscale('log')
-ax1.grid(True, alpha=0.3)
-
-# 2. AES Speedup
-speedups = [b/s if s > 0 else 100 for b, s in zip(aes_baseline, aes_simd)]
-colors = ['#2ecc71' if s > 10 else '#f39c12' for s in speedups]
-ax2.bar(aes_data_sizes, speedups, color=colors)
-ax2.set_ylabel('Speedup (x)')
-ax2.set_title('AES-NI Speedup Over Baseline')
-ax2.axhline(y=1, color='r', linestyle='--', alpha=0.5, label='No speedup')
-ax2.legend()
-ax2.grid(True, alpha=0.3)
-
-# 3. Gaussian Blur Performance Comparison
-x = np.arange(len(blur_sizes))
-width = 0.2
-
-ax3.bar(x - 1.5*width, blur_baseline, width, label='Baseline', color='#3498db')
-ax3.bar(x - 0.5*width, blur_simd, width, label='SIMD', color='#9b59b6')
-ax3.bar(x + 0.5*width, blur_tiled, width, label='Tiled', color='#e74c3c')
-ax3.bar(x + 1.5*width, blur_multithreaded, width, label='Multi-threaded', color='#2ecc71')
-ax3.set_ylabel('Time (ms)')
-ax3.set_title('Gaussian Blur Performance')
-ax3.set_xticks(x)
-ax3.set_xticklabels(blur_sizes)
-ax3.legend()
-ax3.grid(True, alpha=0.3)
-
-# 4. Processing Throughput
-aes_throughput = [1000 / (t/1000) if t > 0 else 0 for t in aes_simd]  # MB/s
-blur_throughput = [((512**2)*i / (t/1000)) / 1e6 for i, t in zip([1, 4, 16, 33.2], blur_multithreaded)]  # Mpixels/s
-
-ax4_twin = ax4.twinx()
-x1 = np.arange(len(aes_data_sizes))
-x2 = np.arange(len(blur_sizes)) + len(aes_data_sizes) + 1
-
-bars1 = ax4.bar(x1, aes_throughput, color='#2ecc71', alpha=0.7, label='AES (MB/s)')
-bars2 = ax4_twin.bar(x2, blur_throughput, color='#3498db', alpha=0.7, label='Blur (Mpix/s)')
-
-ax4.set_ylabel('AES Throughput (MB/s)', color='#2ecc71')
-ax4_twin.set_ylabel('Blur Throughput (Mpixels/s)', color='#3498db')
-ax4.set_title('Best-Case Throughput')
-ax4.set_xticks(list(x1) + list(x2))
-ax4.set_xticklabels(aes_data_sizes + blur_sizes, rotation=45, ha='right')
-ax4.tick_params(axis='y', labelcolor='#2ecc71')
-ax4_twin.tick_params(axis='y', labelcolor='#3498db')
-ax4.grid(True, alpha=0.3)
-
-# Add legend combining both axes
-lines1, labels1 = ax4.get_legend_handles_labels()
-lines2, labels2 = ax4_twin.get_legend_handles_labels()
-ax4.legend(lines1 + lines2, labels1 + labels2, loc='upper left')
-
-plt.tight_layout()
-plt.savefig('performance_charts.png', dpi=300, bbox_inches='tight')
-print("✓ Performance charts saved to 'performance_charts.png'")
-
-# Create a separate speedup summary chart
-fig2, ax = plt.subplots(figsize=(10, 6))
-
-categories = ['AES\n(64KB)', 'AES\n(1MB)', 'AES\n(10MB)', 'Blur\n(512²)', 'Blur\n(1024²)', 'Blur\n(4K)']
-baseline_times = [917, 13356, 139358, 41, 167, 1388]
-optimized_times = [0.1, 108, 2079, 15, 60, 450]
-speedups_all = [b/o if o > 0 else 0 for b, o in zip(baseline_times, optimized_times)]
-
-colors_gradient = ['#27ae60' if s > 50 else '#2ecc71' if s > 10 else '#f39c12' if s > 2 else '#e74c3c' 
-                   for s in speedups_all]
-
-bars = ax.bar(categories, speedups_all, color=colors_gradient, edgecolor='black', linewidth=1.5)
-
-# Add value labels on bars
-for bar, speedup in zip(bars, speedups_all):
-    height = bar.get_height()
-    ax.text(bar.get_x() + bar.get_width()/2., height,
-            f'{speedup:.1f}x',
-            ha='center', va='bottom', fontweight='bold', fontsize=11)
-
-ax.axhline(y=1, color='red', linestyle='--', linewidth=2, alpha=0.7, label='No speedup (1x)')
-ax.set_ylabel('Speedup Factor', fontsize=12, fontweight='bold')
-ax.set_title('ARES Optimization Results: Speedup Summary', fontsize=14, fontweight='bold')
-ax.legend(fontsize=10)
-ax.grid(True, alpha=0.3, axis='y')
-ax.set_ylim(0, max(speedups_all) * 1.2)
-
-plt.tight_layout()
-plt.savefig('speedup_summary.png', dpi=300, bbox_inches='tight')
-print("✓ Speedup summary saved to 'speedup_summary.png'")
-
-print("\n📊 Performance visualization complete!")
-print("  - performance_charts.png (4-panel analysis)")
-print("  - speedup_summary.png (overall speedup)")
+NUMERIC_FIELDS = ('median_us', 'mean_us', 'stddev_us', 'min_us', 'max_us',
+                  'p5_us', 'p95_us', 'bytes', 'items',
+                  'bytes_per_second', 'items_per_second')
+
+
+def load_results(path):
+    """Return the benchmark records of one --json or --csv file."""
+    if path.endswith('.csv'):
+        with open(path, newline='') as f:
+            records = list(csv.DictReader(f))
+        for r in records:
+            for key in NUMERIC_FIELDS:
+                r[key] = float(r[key])
+            r['multithreaded'] = r['multithreaded'] in ('1', 'true')
+        return records
+    with open(path) as f:
+        data = json.load(f)
+    for r in data['benchmarks']:
+        r['context'] = data.get('context', {})
+    return data['benchmarks']
+
+
+def group_results(records):
+    """{group: {size: {variant: record}}}, keeping the order of the run."""
+    groups = OrderedDict()
+    for r in records:
+        sizes = groups.setdefault(r['group'], OrderedDict())
+        sizes.setdefault(r['size'], OrderedDict())[r['variant']] = r
+    return groups
+
+
+def time_scale(records):
+    """Pick a readable unit for a set of records."""
+    largest = max(r['median_us'] for r in records)
+    if largest >= 1e6:
+        return 1e6, 's'
+    if largest >= 1e3:
+        return 1e3, 'ms'
+    return 1.0, 'μs'
+
+
+def plot_group(ax_time, ax_speedup, name, sizes):
+    variants = []
+    for by_variant in sizes.values():
+        for variant in by_variant:
+            if variant not in variants:
+                variants.append(variant)
+
+    all_records = [r for by_variant in sizes.values() for r in by_variant.values()]
+    scale, unit = time_scale(all_records)
+    colors = plt.cm.tab10(np.linspace(0, 1, 10))
+
+    x = np.arange(len(sizes))
+    width = 0.8 / len(variants)
+    for i, variant in enumerate(variants):
+        medians, lower, upper, speedups = [], [], [], []
+        for by_variant in sizes.values():
+            r = by_variant.get(variant)
+            base = by_variant.get('baseline')
+            if r is None:
+                medians.append(np.nan)
+                lower.append(0.0)
+                upper.append(0.0)
+                speedups.append(np.nan)
+                continue
+            medians.append(r['median_us'] / scale)
+            lower.append((r['median_us'] - r['p5_us']) / scale)
+            upper.append((r['p95_us'] - r['median_us']) / scale)
+            speedups.append(base['median_us'] / r['median_us'] if base else np.nan)
+
+        offset = (i - (len(variants) - 1) / 2) * width
+        color = colors[i % len(colors)]
+        ax_time.bar(x + offset, medians, width, yerr=[lower, upper], capsize=2,
+                    label=variant, color=color)
+        if variant != 'baseline':
+            ax_speedup.bar(x + offset, speedups, width, label=variant, color=color)
+
+    ax_time.set_title(f'{name}: median time (p5-p95)')
+    ax_time.set_ylabel(f'Time ({unit}, log scale)')
+    ax_time.set_yscale('log')
+    ax_speedup.set_title(f'{name}: speedup over baseline')
+    ax_speedup.set_ylabel('Speedup (x)')
+    ax_speedup.axhline(y=1, color='r', linestyle='--', alpha=0.5)
+    for ax in (ax_time, ax_speedup):
+        ax.set_xticks(x)
+        ax.set_xticklabels(list(sizes.keys()), rotation=20, ha='right')
+        ax.grid(True, alpha=0.3)
+        ax.legend(fontsize=7)
+
+
+def plot_summary(groups):
+    categories, speedups = [], []
+    for name, sizes in groups.items():
+        for size, by_variant in sizes.items():
+            base = by_variant.get('baseline')
+            others = [r for v, r in by_variant.items() if v != 'baseline']
+            if not base or not others:
+                continue
+            best = min(others, key=lambda r: r['median_us'])
+            categories.append(f"{name}\n{size}\n({best['variant']})")
+            speedups.append(base['median_us'] / best['median_us'])
+
+    if not categories:
+        return False
+
+    fig, ax = plt.subplots(figsize=(max(10, len(categories) * 1.1), 6))
+    colors_gradient = ['#27ae60' if s > 50 else '#2ecc71' if s > 10 else '#f39c12' if s > 2 else '#e74c3c'
+                       for s in speedups]
+    bars = ax.bar(categories, speedups, color=colors_gradient, edgecolor='black', linewidth=1.5)
+
+    # Add value labels on bars
+    for bar, speedup in zip(bars, speedups):
+        ax.text(bar.get_x() + bar.get_width() / 2., bar.get_height(),
+                f'{speedup:.1f}x',
+                ha='center', va='bottom', fontweight='bold', fontsize=9)
+
+    ax.axhline(y=1, color='red', linestyle='--', linewidth=2, alpha=0.7, label='No speedup (1x)')
+    ax.set_ylabel('Speedup Factor', fontsize=12, fontweight='bold')
+    ax.set_title('ARES Optimization Results: Best Speedup per Size', fontsize=14, fontweight='bold')
+    ax.tick_params(axis='x', labelsize=8)
+    ax.legend(fontsize=10)
+    ax.grid(True, alpha=0.3, axis='y')
+    ax.set_ylim(0, max(speedups) * 1.2)
+
+    plt.tight_layout()
+    plt.savefig('speedup_summary.png', dpi=300, bbox_inches='tight')
+    print("✓ Speedup summary saved to 'speedup_summary.png'")
+    return True
+
+
+def plot_roofline(records):
+    points = [r for r in records if 'arithmetic_intensity' in r.get('metrics', {})]
+    if not points:
+        return False
+
+    context = points[0]['context']
+    bandwidth = context['bandwidth_gbs']
+    ceilings = [(name, context.get(f'peak_gflops_{name}', 0.0)) for name in ('sse2', 'avx2', 'avx512')]
+    ceilings = [(name, peak) for name, peak in ceilings if peak > 0]
+    all_cores = context.get('peak_gflops_all_cores', 0.0)
+    bandwidth_all = context.get('bandwidth_all_cores_gbs', bandwidth)
+
+    fig, ax = plt.subplots(figsize=(10, 7))
+    intensity = np.logspace(-2, 3, 200)
+    ax.plot(intensity, np.minimum(intensity * bandwidth, max(p for _, p in ceilings)),
+            color='black', linewidth=2, label=f'1 thread: {bandwidth:.1f} GB/s')
+    for name, peak in ceilings:
+        ax.axhline(y=peak, color='gray', linestyle=':', alpha=0.8)
+        ax.text(1e3, peak, f' {name} {peak:.0f} GFLOP/s', va='bottom', ha='right', fontsize=8)
+    if all_cores > max(p for _, p in ceilings):
+        ax.plot(intensity, np.minimum(intensity * bandwidth_all, all_cores), color='black',
+                linestyle='--', alpha=0.6, label=f'all cores: {bandwidth_all:.1f} GB/s')
+
+    variants = []
+    for r in points:
+        if r['variant'] not in variants:
+            variants.append(r['variant'])
+    colors = plt.cm.tab10(np.linspace(0, 1, 10))
+    markers = 'os^Dvp*hX'
+    labelled = set()
+    for r in points:
+        i = variants.index(r['variant'])
+        m = r['metrics']
+        ax.scatter(m['arithmetic_intensity'], m['gflops'], color=colors[i % len(colors)],
+                   marker=markers[i % len(markers)], s=50, zorder=3,
+                   label=None if r['variant'] in labelled else r['variant'])
+        labelled.add(r['variant'])
+        ax.annotate(r['group'].replace('blur-', ''), (m['arithmetic_intensity'], m['gflops']),
+                    fontsize=6, xytext=(3, -8), textcoords='offset points')
+
+    ax.set_xscale('log')
+    ax.set_yscale('log')
+    ax.set_xlabel('Arithmetic intensity (FLOP/byte)')
+    ax.set_ylabel('Performance (GFLOP/s)')
+    ax.set_title('ARES Roofline: Gaussian blur variants', fontsize=14, fontweight='bold')
+    ax.grid(True, which='both', alpha=0.3)
+    ax.legend(fontsize=8, loc='lower right')
+
+    plt.tight_layout()
+    plt.savefig('roofline.png', dpi=300, bbox_inches='tight')
+    print("✓ Roofline saved to 'roofline.png'")
+    return True
+
+
+def main(paths):
+    if not paths:
+        print(__doc__.strip())
+        return 1
+
+    records = []
+    for path in paths:
+        records.extend(load_results(path))
+    groups = group_results(records)
+    if not groups:
+        print('No benchmark results found')
+        return 1
+
+    fig, axes = plt.subplots(len(groups), 2, figsize=(14, 4.5 * len(groups)), squeeze=False)
+    fig.suptitle('ARES Project Performance Analysis', fontsize=16, fontweight='bold')
+    for (name, sizes), (ax_time, ax_speedup) in zip(groups.items(), axes):
+        plot_group(ax_time, ax_speedup, name, sizes)
+
+    plt.tight_layout()
+    plt.savefig('performance_charts.png', dpi=300, bbox_inches='tight')
+    print("✓ Performance charts saved to 'performance_charts.png'")
+
+    summary = plot_summary(groups)
+    roofline = plot_roofline(records)
+
+    print("\n📊 Performance visualization complete!")
+    print(f"  - performance_charts.png ({len(groups)} benchmark groups)")
+    if summary:
+        print("  - speedup_summary.png (overall speedup)")
+    if roofline:
+        print("  - roofline.png (achieved vs attainable GFLOP/s)")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))